@@ -0,0 +1,162 @@
+/*
+ * File: BENCH_APP.c
+ *
+ * Description:
+ *     Benchmark program for the public driver APIs (DIO, LCD, SEV_SEG, ADC, LM35, HC595).
+ *     Every call is measured BENCH_APP_RUNS times (calls that take hundreds of
+ *     milliseconds fewer times) and the report is written once at the end.
+ *
+ *     Target / simavr: build for the atmega32 and run e.g.
+ *         simavr -m atmega32 -f 8000000 bench.elf
+ *     The report is sent on the USART; simavr prints it on its console. Running the
+ *     same program built -O0 (Debug) and -Os gives two comparable reports, and
+ *     bench_footprint.sh adds the flash/RAM size of each API from the same ELF.
+ *
+ *     Host: compile with the HOST build line (HOST/HOST_interface.h) plus
+ *     BENCH/BENCH_program.c, HAL/HC595/HC595_program.c and this file instead of
+ *     HOST/HOST_APP.c. The report is
+ *     written on stdout and the cycles are the HOST estimate.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <avr/interrupt.h>
+
+/* UTILS_LIB */
+#include "../UTIL_LIB/STD_TYPES.h"
+#include "../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../MCAL/DIO/DIO_interface.h"
+#include "../MCAL/DIO/DIO_private.h"
+#include "../MCAL/DIO/DIO_config.h"
+#include "../MCAL/ADC/ADC_interface.h"
+
+/* HAL */
+#include "../HAL/LCD_4x20/LCD_interface.h"
+#include "../HAL/SEV_SEG/SEV_SEG_interface.h"
+#include "../HAL/LM35/LM35_interface.h"
+#include "../HAL/HC595/HC595_interface.h"
+
+/* BENCH */
+#include "./BENCH_interface.h"
+
+#ifdef HOST_BUILD
+#include <stdio.h>
+#include "../HOST/HOST_interface.h"
+#endif
+
+/* Measurements per API (long-running display calls use BENCH_APP_SLOW_RUNS) */
+#define BENCH_APP_RUNS          16
+#define BENCH_APP_SLOW_RUNS     2
+
+#ifdef HOST_BUILD
+/* ADC model: a started conversion completes on the next ADCSRA access with mid-scale */
+static u8 BENCH_u8AdcsraHook(u16 Copy_u16Address, u8 Copy_u8Value)
+{
+	(void)Copy_u16Address;
+
+	if (GET_BIT(Copy_u8Value, 6))
+	{
+		HOST_voidSetRegister(0x24, 0x00);   // ADCL
+		HOST_voidSetRegister(0x25, 0x02);   // ADCH
+		CLR_BIT(Copy_u8Value, 6);           // ADSC
+		SET_BIT(Copy_u8Value, 4);           // ADIF
+	}
+	else
+	{
+		CLR_BIT(Copy_u8Value, 4);
+	}
+
+	return Copy_u8Value;
+}
+
+static void BENCH_voidStdoutPutChar(u8 Copy_u8Char)
+{
+	putchar(Copy_u8Char);
+}
+#endif
+
+int main(void)
+{
+	u8 Local_u8Value;
+	Dio_BUS Local_strBus;
+	static const Dio_CHANNEL_NUM Local_AChannels[4] = {Dio_PINA_4, Dio_PINA_5, Dio_PINA_6, Dio_PINB_7};
+
+#ifdef HOST_BUILD
+	HOST_voidReset();
+	HOST_voidSetReadHook(0x26, BENCH_u8AdcsraHook);
+#else
+	BENCH_voidUartInit();
+#endif
+
+	BENCH_voidInit();
+	sei();
+
+	/* DIO: LED pins PA4..PA6 and PB7 */
+	BENCH_RUN("DIO_setPinDirection", BENCH_APP_RUNS, DIO_setPinDirection(DIO_PORTA, DIO_PIN4, DIO_PIN_OUTPUT));
+	BENCH_RUN("DIO_setPinValue", BENCH_APP_RUNS, DIO_setPinValue(DIO_PORTA, DIO_PIN4, DIO_PIN_HIGH));
+	BENCH_RUN("DIO_getPinValue", BENCH_APP_RUNS, DIO_getPinValue(DIO_PORTA, DIO_PIN4, &Local_u8Value));
+	BENCH_RUN("DIO_togglePinValue", BENCH_APP_RUNS, DIO_togglePinValue(DIO_PORTA, DIO_PIN4));
+	BENCH_RUN("DIO_SET_PIN_VALUE", BENCH_APP_RUNS, DIO_SET_PIN_VALUE(DIO_PORTA, DIO_PIN4, DIO_PIN_LOW));
+	BENCH_RUN("DIO_setPortValue", BENCH_APP_RUNS, DIO_setPortValue(DIO_PORTC, 0x00));
+	BENCH_RUN("DIO_getPortValue", BENCH_APP_RUNS, DIO_getPortValue(DIO_PORTC, &Local_u8Value));
+	BENCH_RUN("DIO_writePortMasked", BENCH_APP_RUNS, DIO_writePortMasked(DIO_PORTA, 0x70, 0x50));
+	BENCH_RUN("DIO_setChannelDirection", BENCH_APP_RUNS, DIO_setChannelDirection(Dio_PINB_7, DIO_PIN_OUTPUT));
+	BENCH_RUN("DIO_setChannelValue", BENCH_APP_RUNS, DIO_setChannelValue(Dio_PINB_7, DIO_PIN_HIGH));
+	BENCH_RUN("DIO_getChannelValue", BENCH_APP_RUNS, DIO_getChannelValue(Dio_PINB_7, &Local_u8Value));
+	BENCH_RUN("DIO_toggleChannelValue", BENCH_APP_RUNS, DIO_toggleChannelValue(Dio_PINB_7));
+	BENCH_RUN("DIO_initBus", BENCH_APP_RUNS, DIO_initBus(&Local_strBus, Local_AChannels, 4));
+	BENCH_RUN("DIO_writeBus", BENCH_APP_RUNS, DIO_writeBus(&Local_strBus, 0x0A));
+	BENCH_RUN("DIO_readBus", BENCH_APP_RUNS, DIO_readBus(&Local_strBus, &Local_u8Value));
+
+	/* LCD */
+	BENCH_RUN("LCD_voidInit", BENCH_APP_SLOW_RUNS, LCD_voidInit());
+	BENCH_RUN("LCD_voidSendCmnd", BENCH_APP_RUNS, LCD_voidSendCmnd(0x80));
+	BENCH_RUN("LCD_voidSendChar", BENCH_APP_RUNS, LCD_voidSendChar('A'));
+	BENCH_RUN("LCD_voidWriteString", BENCH_APP_RUNS, LCD_voidWriteString((u8*)"BENCH"));
+	BENCH_RUN("LCD_voidWriteNumber", BENCH_APP_RUNS, LCD_voidWriteNumber(-12345));
+	BENCH_RUN("LCD_voidWriteNumber4Digits", BENCH_APP_RUNS, LCD_voidWriteNumber4Digits(1234));
+	BENCH_RUN("LCD_voidDisplayFloat", BENCH_APP_RUNS, LCD_voidDisplayFloat(24.9f));
+	BENCH_RUN("LCD_voidWriteBinary", BENCH_APP_RUNS, LCD_voidWriteBinary(0xA5));
+	BENCH_RUN("LCD_voidWriteHex", BENCH_APP_RUNS, LCD_voidWriteHex(0xA5));
+	BENCH_RUN("LCD_voidGoTo", BENCH_APP_RUNS, LCD_voidGoTo(LCD_LINE_TWO, 5));
+	BENCH_RUN("LCD_voidGoToClear", BENCH_APP_RUNS, LCD_voidGoToClear(LCD_LINE_TWO, 0, 20));
+	BENCH_RUN("LCD_voidClear", BENCH_APP_RUNS, LCD_voidClear());
+
+	/* SEV_SEG */
+	BENCH_RUN("SEV_SEG_voidInitialize", BENCH_APP_RUNS, SEV_SEG_voidInitialize());
+	BENCH_RUN("SEV_SEG_voidDisplayDigit", BENCH_APP_RUNS, SEV_SEG_voidDisplayDigit(3, 7));
+	BENCH_RUN("SEV_SEG_voidDisableDisplay", BENCH_APP_RUNS, SEV_SEG_voidDisableDisplay());
+	BENCH_RUN("SEV_SEG_voidDisplayNumber", BENCH_APP_SLOW_RUNS, SEV_SEG_voidDisplayNumber(1234));
+
+	/* ADC / LM35 */
+	BENCH_RUN("ADC_voidInit", BENCH_APP_RUNS, ADC_voidInit());
+	BENCH_RUN("ADC_u16Read", BENCH_APP_RUNS, ADC_u16Read(1));
+	BENCH_RUN("LM35_voidInit", BENCH_APP_RUNS, LM35_voidInit());
+	BENCH_RUN("LM35_f32GetTemperature", BENCH_APP_RUNS, LM35_f32GetTemperature());
+
+	/* HC595: two chips; a virtual channel write shifts 16 bits and latches */
+	BENCH_RUN("HC595_voidInit", BENCH_APP_RUNS, HC595_voidInit());
+	BENCH_RUN("HC595_voidUpdate", BENCH_APP_RUNS, HC595_voidUpdate());
+	BENCH_RUN("DIO_toggleChannelValue(VPIN)", BENCH_APP_RUNS, DIO_toggleChannelValue(Dio_VPIN_3));
+	BENCH_RUN("HC595_voidEndUpdate(8 pins)", BENCH_APP_RUNS,
+	          HC595_voidBeginUpdate();
+	          for(Local_u8Value = 0; Local_u8Value < 8; Local_u8Value++) { HC595_voidTogglePinValue(Local_u8Value); }
+	          HC595_voidEndUpdate());
+
+#ifdef HOST_BUILD
+	BENCH_voidReport(BENCH_voidStdoutPutChar);
+	return 0;
+#else
+	BENCH_voidReport(BENCH_voidUartPutChar);
+
+	while (1)
+	{
+	}
+
+	return 0;
+#endif
+}
@@ -0,0 +1,28 @@
+/*
+ * File: BENCH_config.h
+ *
+ * Description:
+ *     Configuration header file for the BENCH module.
+ *
+ * Usage:
+ *     - BENCH_RESULTS_MAX: Number of distinct APIs the result table holds (RAM use is
+ *       18 bytes per entry on target).
+ *     - BENCH_UART_BAUD: Baud rate of the report on target. The report is sent on TXD
+ *       (PD1), which the board pin map must list as BENCH TXD with DIO_PIN_MAP_GENERATED.
+ *     - BENCH_HOST_ACCESS_CYCLES: Cycles charged per register access by the host
+ *       estimate (LDS/STS cost).
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef BENCH_CONFIG_H_
+#define BENCH_CONFIG_H_
+
+#define BENCH_RESULTS_MAX            40
+
+#define BENCH_UART_BAUD              38400UL
+
+#define BENCH_HOST_ACCESS_CYCLES     2
+
+#endif /* BENCH_CONFIG_H_ */
@@ -0,0 +1,99 @@
+/*
+ * File: BENCH_interface.h
+ *
+ * Description:
+ *     Header file for the BENCH module: cycle-count measurement of driver calls and a
+ *     machine-readable report of the results.
+ *
+ *     Cycle source:
+ *       - Target (avr-gcc, or an instruction-set simulator such as simavr): Timer1 runs
+ *         at F_CPU and its overflow interrupt extends it to 32 bits, so global interrupts
+ *         must be enabled (sei()) while measuring. The Start/Stop overhead is measured in
+ *         BENCH_voidInit and subtracted from every result.
+ *       - Host (HOST_BUILD, see HOST/HOST_interface.h): an estimate made of the virtual
+ *         delay cycles plus BENCH_HOST_ACCESS_CYCLES per register access. It ignores the
+ *         instruction cost of the C code, so use it to compare variants and to catch
+ *         regressions, not as an absolute figure.
+ *
+ *     Report (BENCH_voidReport), one CSV record per line:
+ *         META,target,<avr|host>
+ *         META,f_cpu,<Hz>
+ *         META,optimize,<0|1|s>      (optimization level BENCH was compiled with)
+ *         META,overhead,<cycles>
+ *         META,dropped,<records that did not fit in BENCH_RESULTS_MAX>
+ *         API,<name>,<runs>,<min>,<max>,<average>
+ *         END
+ *
+ *     Flash/RAM footprint per API comes from the linked image, see bench_footprint.sh.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef BENCH_INTERFACE_H_
+#define BENCH_INTERFACE_H_
+
+/* Function: BENCH_voidInit
+ * Description:
+ *     Clears the results, starts the cycle counter and measures the Start/Stop overhead.
+ */
+void BENCH_voidInit(void);
+
+/* Function: BENCH_voidStart
+ * Description:
+ *     Marks the start of a measurement.
+ */
+void BENCH_voidStart(void);
+
+/* Function: BENCH_u32Stop
+ * Description:
+ *     Returns the cycles elapsed since BENCH_voidStart, minus the measurement overhead.
+ */
+u32 BENCH_u32Stop(void);
+
+/* Function: BENCH_voidRecord
+ * Description:
+ *     Adds one measurement to the result of Copy_pcName (runs, min, max, total).
+ *     Results are matched by name pointer, so pass the same string literal each time.
+ */
+void BENCH_voidRecord(const char* Copy_pcName, u32 Copy_u32Cycles);
+
+/* Function: BENCH_voidReport
+ * Description:
+ *     Writes the report described above one character at a time through Copy_pvPutChar.
+ */
+void BENCH_voidReport(void (*Copy_pvPutChar)(u8 Copy_u8Char));
+
+/* Function: BENCH_voidPutString / BENCH_voidPutNumber
+ * Description:
+ *     Write a string, or an unsigned number in decimal, through Copy_pvPutChar.
+ */
+void BENCH_voidPutString(void (*Copy_pvPutChar)(u8), const char* Copy_pcString);
+void BENCH_voidPutNumber(void (*Copy_pvPutChar)(u8), u32 Copy_u32Number);
+
+#ifndef HOST_BUILD
+/* Function: BENCH_voidUartInit / BENCH_voidUartPutChar
+ * Description:
+ *     Polled USART transmitter (8N1, BENCH_UART_BAUD) for BENCH_voidReport on target.
+ *     simavr prints the USART output of the simulated part on its console.
+ */
+void BENCH_voidUartInit(void);
+void BENCH_voidUartPutChar(u8 Copy_u8Char);
+#endif
+
+/* Macro: BENCH_RUN
+ * Description:
+ *     Measures Runs executions of the statement Call and records each under Name.
+ */
+#define BENCH_RUN(Name, Runs, Call)                                                   \
+	do {                                                                              \
+		u16 BENCH_u16Run;                                                             \
+		for (BENCH_u16Run = 0; BENCH_u16Run < (Runs); BENCH_u16Run++)                 \
+		{                                                                             \
+			BENCH_voidStart();                                                        \
+			Call;                                                                     \
+			BENCH_voidRecord((Name), BENCH_u32Stop());                                \
+		}                                                                             \
+	} while (0)
+
+#endif /* BENCH_INTERFACE_H_ */
@@ -0,0 +1,61 @@
+/*
+ * File: BENCH_private.h
+ *
+ * Description:
+ *     Private header file for the BENCH module.
+ *     It defines the Timer1 and USART registers used on target and the result record.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef BENCH_PRIVATE_H_
+#define BENCH_PRIVATE_H_
+
+/* Timer1 Registers */
+#define TCCR1A         HW_REG8(0x4F)
+#define TCCR1B         HW_REG8(0x4E)
+#define TCNT1          HW_REG16(0x4C)
+
+/* Timer Interrupt Registers (shared by all timers) */
+#define TIMSK          HW_REG8(0x59)
+#define TIFR           HW_REG8(0x58)
+
+/* TIMSK / TIFR Bits */
+#define TIMSK_TOIE1    2
+#define TIFR_TOV1      2
+
+/* TCCR1B: clock select CS12:0 = 001, no prescaling */
+#define BENCH_TIMER1_CLOCK_NO_PRESCALING   0x01
+
+/* USART Registers */
+#define UDR            HW_REG8(0x2C)
+#define UCSRA          HW_REG8(0x2B)
+#define UCSRB          HW_REG8(0x2A)
+#define UBRRL          HW_REG8(0x29)
+#define UCSRC          HW_REG8(0x40)    /* shared with UBRRH, selected by URSEL */
+
+/* USART Bits */
+#define UCSRA_UDRE     5
+#define UCSRB_TXEN     3
+#define UCSRC_URSEL    7
+#define UCSRC_UCSZ0    1
+#define UCSRC_UCSZ1    2
+
+/* Baud rate register value for normal speed (U2X = 0) */
+#define BENCH_UBRR_VALUE   ((F_CPU / (16UL * BENCH_UART_BAUD)) - 1)
+
+/* Runs used to measure the Start/Stop overhead */
+#define BENCH_CALIBRATION_RUNS   8
+
+/* Accumulated measurements of one API */
+typedef struct
+{
+	const char* Name;
+	u16 Runs;
+	u32 MinCycles;
+	u32 MaxCycles;
+	u32 TotalCycles;
+} Bench_RESULT;
+
+#endif /* BENCH_PRIVATE_H_ */
@@ -0,0 +1,292 @@
+/*
+ * File: BENCH_program.c
+ *
+ * Description:
+ *     Implementation of the BENCH module: cycle counter, result table and CSV report.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+/* UTILS_LIB */
+#include "../UTIL_LIB/STD_TYPES.h"
+#include "../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../MCAL/DIO/DIO_interface.h"
+#include "../MCAL/DIO/DIO_private.h"
+#include "../MCAL/DIO/DIO_config.h"
+
+/* BENCH */
+#include "./BENCH_interface.h"
+#include "./BENCH_private.h"
+#include "./BENCH_config.h"
+
+#ifdef HOST_BUILD
+#include "../HOST/HOST_interface.h"
+#elif BENCH_UBRR_VALUE > 255
+#error "BENCH_UART_BAUD is too low for F_CPU (UBRRH is not used)"
+#elif (DIO_PIN_MAP == DIO_PIN_MAP_GENERATED) && (PINMAP_BENCH_TXD_ID != DIO_PIN_ID(DIO_PORTD, DIO_PIN1))
+#error "BENCH: the pin map has no BENCH TXD on PD1 (USART transmitter)"
+#endif
+
+static Bench_RESULT BENCH_AstrResults[BENCH_RESULTS_MAX];
+static u8  BENCH_u8ResultsNum;
+static u16 BENCH_u16Dropped;
+
+static u32 BENCH_u32StartCount;
+static u32 BENCH_u32Overhead;
+
+#ifndef HOST_BUILD
+/* Upper 16 bits of the cycle counter */
+static volatile u16 BENCH_u16Overflows;
+
+ISR(TIMER1_OVF_vect)
+{
+	BENCH_u16Overflows++;
+}
+#endif
+
+/*
+ * Function: BENCH_u32ReadCounter
+ * Description:
+ *     Returns the free-running cycle count. On target an overflow that is pending but not
+ *     yet counted (low half already wrapped) is added before combining the halves.
+ */
+static u32 BENCH_u32ReadCounter(void)
+{
+#ifndef HOST_BUILD
+	u16 Local_u16Low;
+	u16 Local_u16High;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		Local_u16Low = TCNT1;
+		Local_u16High = BENCH_u16Overflows;
+
+		if (GET_BIT(TIFR, TIFR_TOV1) && (Local_u16Low < 0x8000))
+		{
+			Local_u16High++;
+		}
+	}
+
+	return ((u32)Local_u16High << 16) | Local_u16Low;
+#else
+	return HOST_u32GetCycles() + (HOST_u32GetAccessCount() * BENCH_HOST_ACCESS_CYCLES);
+#endif
+}
+
+/*
+ * Function: BENCH_voidInit
+ * Description:
+ *     Starts Timer1 with no prescaling and its overflow interrupt (target), clears the
+ *     table and keeps the smallest of BENCH_CALIBRATION_RUNS empty measurements as the
+ *     overhead.
+ */
+void BENCH_voidInit(void)
+{
+	u8 Local_u8Run;
+	u32 Local_u32Cycles;
+	u32 Local_u32Run;
+
+#ifndef HOST_BUILD
+	TCCR1A = 0;
+	TCCR1B = 0;
+	TCNT1 = 0;
+	BENCH_u16Overflows = 0;
+	SET_BIT(TIFR, TIFR_TOV1);      // Flag is cleared by writing one
+	SET_BIT(TIMSK, TIMSK_TOIE1);
+	TCCR1B = BENCH_TIMER1_CLOCK_NO_PRESCALING;
+#endif
+
+	BENCH_u8ResultsNum = 0;
+	BENCH_u16Dropped = 0;
+	BENCH_u32Overhead = 0;
+
+	Local_u32Cycles = 0xFFFFFFFFUL;
+	for (Local_u8Run = 0; Local_u8Run < BENCH_CALIBRATION_RUNS; Local_u8Run++)
+	{
+		BENCH_voidStart();
+		Local_u32Run = BENCH_u32Stop();
+		if (Local_u32Run < Local_u32Cycles)
+		{
+			Local_u32Cycles = Local_u32Run;
+		}
+	}
+	BENCH_u32Overhead = Local_u32Cycles;
+}
+
+void BENCH_voidStart(void)
+{
+	BENCH_u32StartCount = BENCH_u32ReadCounter();
+}
+
+u32 BENCH_u32Stop(void)
+{
+	u32 Local_u32Elapsed = BENCH_u32ReadCounter() - BENCH_u32StartCount;
+
+	return (Local_u32Elapsed > BENCH_u32Overhead) ? (Local_u32Elapsed - BENCH_u32Overhead) : 0;
+}
+
+/*
+ * Function: BENCH_voidRecord
+ * Description:
+ *     Finds the entry of Copy_pcName (or takes a free one) and accumulates the
+ *     measurement. When the table is full the measurement is counted as dropped.
+ */
+void BENCH_voidRecord(const char* Copy_pcName, u32 Copy_u32Cycles)
+{
+	u8 Local_u8Index;
+	Bench_RESULT* Local_pstrResult;
+
+	for (Local_u8Index = 0; Local_u8Index < BENCH_u8ResultsNum; Local_u8Index++)
+	{
+		if (BENCH_AstrResults[Local_u8Index].Name == Copy_pcName)
+		{
+			break;
+		}
+	}
+
+	if (Local_u8Index == BENCH_u8ResultsNum)
+	{
+		if (BENCH_u8ResultsNum == BENCH_RESULTS_MAX)
+		{
+			BENCH_u16Dropped++;
+			return;
+		}
+
+		Local_pstrResult = &BENCH_AstrResults[BENCH_u8ResultsNum++];
+		Local_pstrResult->Name = Copy_pcName;
+		Local_pstrResult->Runs = 0;
+		Local_pstrResult->MinCycles = 0xFFFFFFFFUL;
+		Local_pstrResult->MaxCycles = 0;
+		Local_pstrResult->TotalCycles = 0;
+	}
+
+	Local_pstrResult = &BENCH_AstrResults[Local_u8Index];
+	Local_pstrResult->Runs++;
+	Local_pstrResult->TotalCycles += Copy_u32Cycles;
+
+	if (Copy_u32Cycles < Local_pstrResult->MinCycles)
+	{
+		Local_pstrResult->MinCycles = Copy_u32Cycles;
+	}
+
+	if (Copy_u32Cycles > Local_pstrResult->MaxCycles)
+	{
+		Local_pstrResult->MaxCycles = Copy_u32Cycles;
+	}
+}
+
+/* Report formatting helpers (also used by DIO_captureDump) */
+void BENCH_voidPutString(void (*Copy_pvPutChar)(u8), const char* Copy_pcString)
+{
+	while (*Copy_pcString != '\0')
+	{
+		Copy_pvPutChar((u8)*Copy_pcString++);
+	}
+}
+
+void BENCH_voidPutNumber(void (*Copy_pvPutChar)(u8), u32 Copy_u32Number)
+{
+	u8 Local_Au8Digits[10];
+	u8 Local_u8Count = 0;
+
+	do
+	{
+		Local_Au8Digits[Local_u8Count++] = (u8)('0' + (Copy_u32Number % 10));
+		Copy_u32Number /= 10;
+	} while (Copy_u32Number != 0);
+
+	while (Local_u8Count != 0)
+	{
+		Copy_pvPutChar(Local_Au8Digits[--Local_u8Count]);
+	}
+}
+
+static void BENCH_voidPutMeta(void (*Copy_pvPutChar)(u8), const char* Copy_pcKey, u32 Copy_u32Value)
+{
+	BENCH_voidPutString(Copy_pvPutChar, "META,");
+	BENCH_voidPutString(Copy_pvPutChar, Copy_pcKey);
+	Copy_pvPutChar(',');
+	BENCH_voidPutNumber(Copy_pvPutChar, Copy_u32Value);
+	Copy_pvPutChar('\n');
+}
+
+/*
+ * Function: BENCH_voidReport
+ * Description:
+ *     Writes the META records, one API record per table entry in first-recorded order,
+ *     and the END marker.
+ */
+void BENCH_voidReport(void (*Copy_pvPutChar)(u8 Copy_u8Char))
+{
+	u8 Local_u8Index;
+	const Bench_RESULT* Local_pstrResult;
+
+	if (Copy_pvPutChar == NULL)
+	{
+		return;
+	}
+
+#ifndef HOST_BUILD
+	BENCH_voidPutString(Copy_pvPutChar, "META,target,avr\n");
+#else
+	BENCH_voidPutString(Copy_pvPutChar, "META,target,host\n");
+#endif
+	BENCH_voidPutMeta(Copy_pvPutChar, "f_cpu", F_CPU);
+#if defined(__OPTIMIZE_SIZE__)
+	BENCH_voidPutString(Copy_pvPutChar, "META,optimize,s\n");
+#elif defined(__OPTIMIZE__)
+	BENCH_voidPutString(Copy_pvPutChar, "META,optimize,1\n");
+#else
+	BENCH_voidPutString(Copy_pvPutChar, "META,optimize,0\n");
+#endif
+	BENCH_voidPutMeta(Copy_pvPutChar, "overhead", BENCH_u32Overhead);
+	BENCH_voidPutMeta(Copy_pvPutChar, "dropped", BENCH_u16Dropped);
+
+	for (Local_u8Index = 0; Local_u8Index < BENCH_u8ResultsNum; Local_u8Index++)
+	{
+		Local_pstrResult = &BENCH_AstrResults[Local_u8Index];
+
+		BENCH_voidPutString(Copy_pvPutChar, "API,");
+		BENCH_voidPutString(Copy_pvPutChar, Local_pstrResult->Name);
+		Copy_pvPutChar(',');
+		BENCH_voidPutNumber(Copy_pvPutChar, Local_pstrResult->Runs);
+		Copy_pvPutChar(',');
+		BENCH_voidPutNumber(Copy_pvPutChar, Local_pstrResult->MinCycles);
+		Copy_pvPutChar(',');
+		BENCH_voidPutNumber(Copy_pvPutChar, Local_pstrResult->MaxCycles);
+		Copy_pvPutChar(',');
+		BENCH_voidPutNumber(Copy_pvPutChar, Local_pstrResult->TotalCycles / Local_pstrResult->Runs);
+		Copy_pvPutChar('\n');
+	}
+
+	BENCH_voidPutString(Copy_pvPutChar, "END\n");
+}
+
+#ifndef HOST_BUILD
+/*
+ * Function: BENCH_voidUartInit
+ * Description:
+ *     Sets the baud rate, selects 8 data bits, 1 stop bit, no parity and enables the
+ *     transmitter only.
+ */
+void BENCH_voidUartInit(void)
+{
+	UBRRL = (u8)BENCH_UBRR_VALUE;
+	UCSRC = (1 << UCSRC_URSEL) | (1 << UCSRC_UCSZ1) | (1 << UCSRC_UCSZ0);
+	UCSRB = (1 << UCSRB_TXEN);
+}
+
+void BENCH_voidUartPutChar(u8 Copy_u8Char)
+{
+	while (GET_BIT(UCSRA, UCSRA_UDRE) == 0);
+
+	UDR = Copy_u8Char;
+}
+#endif
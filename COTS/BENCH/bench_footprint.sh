@@ -0,0 +1,55 @@
+#!/bin/sh
+#
+# File: bench_footprint.sh
+#
+# Description:
+#     Flash/RAM footprint of every driver symbol in a linked AVR image, in the same
+#     CSV style as the BENCH report:
+#         SYMBOL,<name>,<flash bytes>,<ram bytes>
+#         MODULE,<prefix>,<flash bytes>,<ram bytes>
+#         TOTAL,<flash bytes>,<ram bytes>
+#     Text is flash; initialized data is flash and RAM; bss is RAM.
+#
+# Usage:
+#     bench_footprint.sh bench.elf [PREFIX...]
+#     (default prefixes: DIO LCD SEV_SEG ADC LM35 HC595 private)
+#
+
+ELF=$1
+if [ -z "$ELF" ] || [ ! -f "$ELF" ]; then
+    echo "usage: $0 image.elf [PREFIX...]" >&2
+    exit 1
+fi
+shift
+
+PREFIXES=${*:-"DIO LCD SEV_SEG ADC LM35 HC595 private"}
+NM=${NM:-avr-nm}
+SIZE=${SIZE:-avr-size}
+
+"$NM" --size-sort -S -t d "$ELF" | awk -v prefixes="$PREFIXES" '
+BEGIN { n = split(prefixes, p, " ") }
+{
+    size = $2 + 0; type = $3; name = $4
+    flash = 0; ram = 0
+    if (type ~ /^[Tt]$/)          { flash = size }
+    else if (type ~ /^[DdRr]$/)   { flash = size; ram = size }
+    else if (type ~ /^[Bb]$/)     { ram = size }
+    else                          { next }
+
+    for (i = 1; i <= n; i++) {
+        if (index(name, p[i] "_") == 1) {
+            print "SYMBOL," name "," flash "," ram
+            mflash[p[i]] += flash; mram[p[i]] += ram
+            break
+        }
+    }
+}
+END {
+    for (i = 1; i <= n; i++) print "MODULE," p[i] "," mflash[p[i]] + 0 "," mram[p[i]] + 0
+}'
+
+"$SIZE" -A "$ELF" | awk '
+$1 == ".text" { text = $2 }
+$1 == ".data" { data = $2 }
+$1 == ".bss"  { bss = $2 }
+END { print "TOTAL," text + data "," data + bss }'
@@ -0,0 +1,66 @@
+/*
+ * File: BUS_ARB_APP.c
+ *
+ * Description:
+ *     Test file for the shared display bus arbiter module on an AVR ATmega32 engineering kit.
+ *     Requires LCD_SHARED_BUS = LCD_ENABLED in LCD_config.h.
+ *     The seven-segment display counts seconds while the LCD is rewritten continuously
+ *     (a full line per update): the digits must not flicker and the LCD text must stay
+ *     intact. This is the hardware check the arbiter needs for each display module
+ *     (see BUS_ARB_interface.h): run it for several minutes before enabling LCD_SHARED_BUS.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <avr/interrupt.h>
+#include <util/delay.h>
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../../MCAL/DIO/DIO_interface.h"
+#include "../../MCAL/TIMER/TIMER_interface.h"
+
+/* HAL */
+#include "../LCD_4x20/LCD_interface.h"
+#include "../LCD_4x20/LCD_config.h"
+#include "./BUS_ARB_interface.h"
+
+int main(void)
+{
+	u16 Local_u16Seconds = 0;
+	u8 Local_u8Update;
+
+	BUS_ARB_voidInit();
+	TIMER0_voidSetCallBack(BUS_ARB_voidTick);
+	TIMER0_voidInitTick();
+	sei();
+
+	LCD_voidInit();
+	LCD_voidWriteString((u8*)"Shared bus test");
+
+	while(1)
+	{
+		BUS_ARB_voidSetNumber(Local_u16Seconds);
+
+		/* Ten LCD updates per second */
+		for(Local_u8Update = 0; Local_u8Update < 10; Local_u8Update++)
+		{
+			LCD_voidGoTo(LCD_LINE_TWO, 0);
+			LCD_voidWriteString((u8*)"Seconds: ");
+			LCD_voidWriteNumber(Local_u16Seconds);
+			LCD_voidGoTo(LCD_LINE_THREE, 0);
+			LCD_voidWriteNumber(Local_u8Update);
+			BUS_ARB_voidLcdFlush();
+			_delay_ms(100);
+		}
+
+		Local_u16Seconds = (Local_u16Seconds + 1) % 10000;
+	}
+
+	return 0;
+}
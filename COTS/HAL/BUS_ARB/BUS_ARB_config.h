@@ -0,0 +1,27 @@
+/*
+ * File: BUS_ARB_config.h
+ *
+ * Description:
+ *     Configuration header file for the shared display bus arbiter module for AVR ATmega32.
+ *     The shared pins themselves come from LCD_config.h and SEV_SEG_private.h.
+ *
+ * Usage:
+ *     - BUS_ARB_LCD_QUEUE_SIZE: LCD transfers waiting for an LCD slot, power of two up to
+ *       128. 32 holds a full line of text with its address command.
+ *     - BUS_ARB_LCD_BYTES_PER_SLOT: Maximum LCD transfers sent per LCD slot. Each one
+ *       costs about 45 us in the tick interrupt; 8 gives 1600 bytes/s with a 1 ms tick.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef BUS_ARB_CONFIG_H_
+#define BUS_ARB_CONFIG_H_
+
+/* LCD queue */
+#define BUS_ARB_LCD_QUEUE_SIZE        32
+
+/* LCD transfers per frame */
+#define BUS_ARB_LCD_BYTES_PER_SLOT    8
+
+#endif /* BUS_ARB_CONFIG_H_ */
@@ -0,0 +1,100 @@
+/*
+ * File: BUS_ARB_interface.h
+ *
+ * Description:
+ *     Header file for the shared display bus arbiter module for AVR ATmega32.
+ *     The LCD and the seven-segment display of the kit share pins:
+ *       PB0/PB1/PB2/PB4  LCD D4..D7      = BCD A..D
+ *       PA3              LCD RS          = COM1 (digit 1, active low)
+ *       PA2              LCD E           = COM2 (digit 2, active low)
+ *     The arbiter owns these pins and time-slices them from a periodic tick: a frame is
+ *     four display slots (one digit each) and one LCD slot that sends the queued LCD
+ *     bytes. Refresh rate = tick rate / 5, e.g. 200 Hz with the 1 ms TIMER0 tick.
+ *
+ *     Every falling edge on PA2 clocks a nibble into the LCD, including the ones caused
+ *     by the display. The arbiter makes them harmless: digit 2 is switched on with RS
+ *     low and 0 on the data lines, and the LCD slot starts with a second edge carrying
+ *     the low nibble of the last entry mode command. The LCD receives one extra "entry
+ *     mode set" (same value) per frame and stays in nibble phase. The display pins are
+ *     blanked (BCD code 15) whenever the LCD needs E low without a digit to show.
+ *
+ *     HARDWARE-VALIDATED ONLY - outside the HD44780 datasheet timing:
+ *     digits 3 and 4 need COM1 (RS) and COM2 (E) both high, so the E pulse of the filler
+ *     low nibble spans them with RS high in its middle: DIGIT_3 raises E with RS low and
+ *     then turns digit 1 off, the LCD slot brings RS low again before E falls. No write
+ *     order avoids this on the kit wiring: RS high at both edges would make the filler a
+ *     data write, and E low lights digit 2. The datasheet requires RS stable over the
+ *     whole pulse, so only a controller that samples RS at the E edges (address setup tAS
+ *     before the rising edge, hold tAH after the falling edge) tolerates the arbiter.
+ *     RS is low at both edges and changes at least one I/O write (2 cycles, 250 ns at
+ *     8 MHz) away from either edge, which covers tAS = 40 ns and tAH = 10 ns; the data
+ *     lines are set one write before E falls (tDSW = 80 ns). RS never changes while E is
+ *     high during an LCD transfer.
+ *     The host test (HOST_APP.c, Test Set 4b) checks these edges against an HD44780 model
+ *     that samples RS at the edges, which is the assumption itself, not a real part. Use
+ *     the arbiter only with a display module checked on the kit with BUS_ARB_APP.c (the
+ *     LCD text must stay intact for several minutes); with any other module keep
+ *     LCD_SHARED_BUS disabled and give the LCD and the seven-segment display their own
+ *     pins.
+ *
+ *     The LCD driver forwards its bytes to BUS_ARB_voidLcdWrite when LCD_SHARED_BUS is
+ *     enabled in LCD_config.h. SEV_SEG functions must not be used with the arbiter.
+ *
+ * Usage:
+ *     BUS_ARB_voidInit();
+ *     TIMER0_voidSetCallBack(BUS_ARB_voidTick);
+ *     TIMER0_voidInitTick();
+ *     sei();
+ *     LCD_voidInit();
+ *     BUS_ARB_voidSetNumber(1234);
+ *     LCD_voidWriteString((u8*)"Hello");
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef BUS_ARB_INTERFACE_H_
+#define BUS_ARB_INTERFACE_H_
+
+/* LCD Transfer Types */
+#define BUS_ARB_LCD_COMMAND     0   // Byte with RS low
+#define BUS_ARB_LCD_DATA        1   // Byte with RS high
+#define BUS_ARB_LCD_NIBBLE      2   // Single nibble with RS low (8-bit mode function set of the init)
+
+/* Function: BUS_ARB_voidInit
+ * Description:
+ *     Configures the shared pins as outputs with every digit off and the display blank.
+ *     Must be called before the tick starts and before LCD_voidInit.
+ */
+void BUS_ARB_voidInit(void);
+
+/* Function: BUS_ARB_voidTick
+ * Description:
+ *     Runs the next slot of the frame. Called from a periodic interrupt, typically as the
+ *     TIMER0 tick callback. The LCD slot busy-waits about 40 us per byte it sends (at most
+ *     BUS_ARB_LCD_BYTES_PER_SLOT bytes); the display slots take a few microseconds.
+ */
+void BUS_ARB_voidTick(void);
+
+/* Function: BUS_ARB_voidSetNumber
+ * Description:
+ *     Sets the number shown on the seven-segment display, 0 to 9999 (all four digits,
+ *     as SEV_SEG_voidDisplayNumber). Larger numbers are ignored.
+ */
+void BUS_ARB_voidSetNumber(u16 Copy_u16Number);
+
+/* Function: BUS_ARB_voidLcdWrite
+ * Description:
+ *     Queues one LCD transfer (BUS_ARB_LCD_COMMAND, BUS_ARB_LCD_DATA or BUS_ARB_LCD_NIBBLE).
+ *     Waits while the queue is full, so it must not be called with interrupts disabled.
+ *     Clear display and return home end their LCD slot, as they run for 1.52 ms.
+ */
+void BUS_ARB_voidLcdWrite(u8 Copy_u8Type, u8 Copy_u8Value);
+
+/* Function: BUS_ARB_voidLcdFlush
+ * Description:
+ *     Waits until every queued LCD transfer has been sent.
+ */
+void BUS_ARB_voidLcdFlush(void);
+
+#endif /* BUS_ARB_INTERFACE_H_ */
@@ -0,0 +1,40 @@
+/*
+ * File: BUS_ARB_private.h
+ *
+ * Description:
+ *     Private header file for the shared display bus arbiter module for AVR ATmega32.
+ *     It defines the frame slots, the LCD timing and the accesses to the shared pins.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef BUS_ARB_PRIVATE_H_
+#define BUS_ARB_PRIVATE_H_
+
+/* Frame Slots */
+#define BUS_ARB_SLOT_DIGIT_1      0
+#define BUS_ARB_SLOT_DIGIT_2      1
+#define BUS_ARB_SLOT_DIGIT_3      2
+#define BUS_ARB_SLOT_DIGIT_4      3
+#define BUS_ARB_SLOT_LCD          4
+#define BUS_ARB_SLOTS_NUM         5
+
+/* BCD code that the decoder shows as a blank digit */
+#define BUS_ARB_BCD_BLANK         0x0F
+
+/* LCD timing: E pulse (450 ns minimum) and execution time of an instruction (37 us) */
+#define BUS_ARB_E_PULSE_US        1
+#define BUS_ARB_LCD_EXEC_US       40
+
+/* Entry mode set of LCD_voidInit (increment, no shift), used until the LCD gets another one */
+#define BUS_ARB_ENTRY_MODE_INIT   0x06
+
+/* Shared pin accesses: data lines = BCD lines, RS = COM1, E = COM2 */
+#define BUS_ARB_WRITE_DATA(Nibble)  DIO_writePortMasked(DIO_PORTB, SEV_SEG_BCD_MASK, SEV_SEG_BCD_TO_PORT(Nibble))
+#define BUS_ARB_WRITE_RS(Level)     DIO_SET_PIN_VALUE(DIO_PORTA, SEV_SEG_COM_PIN_1, Level)
+#define BUS_ARB_WRITE_E(Level)      DIO_SET_PIN_VALUE(DIO_PORTA, SEV_SEG_COM_PIN_2, Level)
+#define BUS_ARB_WRITE_COM3(Level)   DIO_SET_PIN_VALUE(DIO_PORTB, SEV_SEG_COM_PIN_3, Level)
+#define BUS_ARB_WRITE_COM4(Level)   DIO_SET_PIN_VALUE(DIO_PORTB, SEV_SEG_COM_PIN_4, Level)
+
+#endif /* BUS_ARB_PRIVATE_H_ */
@@ -0,0 +1,284 @@
+/*
+ * File: BUS_ARB_program.c
+ *
+ * Description:
+ *     Implementation of the shared display bus arbiter module for AVR ATmega32.
+ *     Each slot leaves the shared pins in a known state for the next one:
+ *       after DIGIT_1 : E high, RS low (digit 1 on)
+ *       after DIGIT_2 : E low (digit 2 on), RS high
+ *       after DIGIT_3 : E high, RS high, COM3 low
+ *       after DIGIT_4 : E high, RS high, COM4 low
+ *       after LCD     : E low, RS high, data lines blank
+ *     RS is low whenever E rises or falls outside an LCD transfer, so the LCD only ever
+ *     latches the nibbles chosen here.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <util/delay.h>
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../../MCAL/DIO/DIO_interface.h"
+#include "../../MCAL/DIO/DIO_private.h"
+#include "../../MCAL/DIO/DIO_config.h"
+#include "../../MCAL/TIMER/TIMER_config.h"
+
+/* HAL */
+#include "../LCD_4x20/LCD_config.h"
+#include "../SEV_SEG/SEV_SEG_private.h"
+#include "./BUS_ARB_interface.h"
+#include "./BUS_ARB_private.h"
+#include "./BUS_ARB_config.h"
+
+#if (LCD_RS_PORT != DIO_PORTA) || (LCD_RS_PIN != SEV_SEG_COM_PIN_1) || \
+    (LCD_E_PORT != DIO_PORTA) || (LCD_E_PIN != SEV_SEG_COM_PIN_2) || \
+    (LCD_D4_PORT != DIO_PORTB) || (LCD_D4_PIN != SEV_SEG_BCD_PIN_A) || \
+    (LCD_D5_PORT != DIO_PORTB) || (LCD_D5_PIN != SEV_SEG_BCD_PIN_B) || \
+    (LCD_D6_PORT != DIO_PORTB) || (LCD_D6_PIN != SEV_SEG_BCD_PIN_C) || \
+    (LCD_D7_PORT != DIO_PORTB) || (LCD_D7_PIN != SEV_SEG_BCD_PIN_D)
+#error "BUS_ARB: the LCD and SEV_SEG pins are not shared as this arbiter expects"
+#endif
+
+/* The first filler edge comes two ticks after an LCD slot: clear/home (1.52 ms) must be over */
+#if TIMER0_TICK_PERIOD_US < 800
+#error "BUS_ARB: the tick period must be at least 800 us"
+#endif
+
+#if (BUS_ARB_LCD_QUEUE_SIZE & (BUS_ARB_LCD_QUEUE_SIZE - 1)) || (BUS_ARB_LCD_QUEUE_SIZE > 128)
+#error "BUS_ARB_LCD_QUEUE_SIZE must be a power of two up to 128"
+#endif
+
+#if DIO_SHADOW_MODE == DIO_SHADOW_DEFERRED
+#error "BUS_ARB needs the LCD E strobe on the pin at once: DIO_SHADOW_DEFERRED is not supported"
+#endif
+
+/* Seven-segment digits, index 0 = digit 1 (units) */
+static volatile u8 BUS_ARB_Au8Digit[4] = {0, 0, 0, 0};
+
+/* LCD queue: written by BUS_ARB_voidLcdWrite, read by the LCD slot */
+static volatile u8 BUS_ARB_Au8LcdType[BUS_ARB_LCD_QUEUE_SIZE];
+static volatile u8 BUS_ARB_Au8LcdValue[BUS_ARB_LCD_QUEUE_SIZE];
+static volatile u8 BUS_ARB_u8LcdHead = 0;
+static volatile u8 BUS_ARB_u8LcdTail = 0;
+
+/* Last entry mode set sent to the LCD: the filler instruction repeats it */
+static u8 BUS_ARB_u8EntryMode = BUS_ARB_ENTRY_MODE_INIT;
+
+static u8 BUS_ARB_u8Slot = BUS_ARB_SLOT_DIGIT_1;
+
+/*
+ * Function: BUS_ARB_voidLcdStrobe
+ * Description:
+ *     Clocks one nibble into the LCD. RS must be set and E low on entry.
+ */
+static void BUS_ARB_voidLcdStrobe(u8 Copy_u8Nibble)
+{
+	BUS_ARB_WRITE_DATA(Copy_u8Nibble);
+	BUS_ARB_WRITE_E(DIO_PIN_HIGH);
+	_delay_us(BUS_ARB_E_PULSE_US);
+	BUS_ARB_WRITE_E(DIO_PIN_LOW);
+}
+
+/*
+ * Function: BUS_ARB_voidLcdSlot
+ * Description:
+ *     Sends up to BUS_ARB_LCD_BYTES_PER_SLOT queued transfers. E is low and RS high on
+ *     entry; between transfers the data lines are blank and RS high, so digit 1 stays
+ *     off and digit 2 shows nothing while the LCD executes.
+ */
+static void BUS_ARB_voidLcdSlot(void)
+{
+	u8 Local_u8Count;
+	u8 Local_u8Type;
+	u8 Local_u8Value;
+
+	for(Local_u8Count = 0; Local_u8Count < BUS_ARB_LCD_BYTES_PER_SLOT; Local_u8Count++)
+	{
+		if(BUS_ARB_u8LcdTail == BUS_ARB_u8LcdHead)
+		{
+			break;
+		}
+
+		Local_u8Type = BUS_ARB_Au8LcdType[BUS_ARB_u8LcdTail];
+		Local_u8Value = BUS_ARB_Au8LcdValue[BUS_ARB_u8LcdTail];
+
+		/* Previous instruction (or the filler one) still executing */
+		_delay_us(BUS_ARB_LCD_EXEC_US);
+
+		if(Local_u8Type == BUS_ARB_LCD_NIBBLE)
+		{
+			BUS_ARB_WRITE_RS(DIO_PIN_LOW);
+			BUS_ARB_voidLcdStrobe(Local_u8Value);
+		}
+		else
+		{
+			BUS_ARB_WRITE_RS((Local_u8Type == BUS_ARB_LCD_DATA) ? DIO_PIN_HIGH : DIO_PIN_LOW);
+			BUS_ARB_voidLcdStrobe(Local_u8Value >> 4);
+			BUS_ARB_voidLcdStrobe(Local_u8Value);
+		}
+
+		BUS_ARB_WRITE_DATA(BUS_ARB_BCD_BLANK);
+		BUS_ARB_WRITE_RS(DIO_PIN_HIGH);
+
+		BUS_ARB_u8LcdTail = (BUS_ARB_u8LcdTail + 1) & (BUS_ARB_LCD_QUEUE_SIZE - 1);
+
+		if(Local_u8Type == BUS_ARB_LCD_COMMAND)
+		{
+			if((Local_u8Value & 0xFC) == 0x04)
+			{
+				BUS_ARB_u8EntryMode = Local_u8Value;
+			}
+			else if(Local_u8Value < 0x04)
+			{
+				/* Clear display / return home: 1.52 ms, wait for the next frame */
+				break;
+			}
+		}
+	}
+}
+
+/*
+ * Function: BUS_ARB_voidInit
+ * Description:
+ *     Leaves the pins in the state that follows an LCD slot, so the frame starts with
+ *     DIGIT_1. Values are written before the directions to avoid glitches.
+ */
+void BUS_ARB_voidInit(void)
+{
+	BUS_ARB_WRITE_DATA(BUS_ARB_BCD_BLANK);
+	BUS_ARB_WRITE_RS(DIO_PIN_HIGH);
+	BUS_ARB_WRITE_E(DIO_PIN_LOW);
+	BUS_ARB_WRITE_COM3(DIO_PIN_HIGH);
+	BUS_ARB_WRITE_COM4(DIO_PIN_HIGH);
+
+	DIO_writePortDirectionMasked(DIO_PORTB, SEV_SEG_BCD_MASK | SEV_SEG_COM_PORTB_MASK, 0xFF);
+	DIO_writePortDirectionMasked(DIO_PORTA, SEV_SEG_COM_PORTA_MASK, 0xFF);
+
+	BUS_ARB_u8Slot = BUS_ARB_SLOT_DIGIT_1;
+}
+
+/*
+ * Function: BUS_ARB_voidTick
+ * Description:
+ *     Moves the shared pins from the state left by the previous slot to the next slot.
+ *     The write order matters: see the pin states in the file header.
+ */
+void BUS_ARB_voidTick(void)
+{
+	switch(BUS_ARB_u8Slot)
+	{
+	case BUS_ARB_SLOT_DIGIT_1:
+		/* RS low before E rises; both digits show the blank code meanwhile */
+		BUS_ARB_WRITE_RS(DIO_PIN_LOW);
+		BUS_ARB_WRITE_E(DIO_PIN_HIGH);
+		BUS_ARB_WRITE_DATA(BUS_ARB_Au8Digit[0]);
+		break;
+
+	case BUS_ARB_SLOT_DIGIT_2:
+		/* E falls with RS low: the LCD latches 0, the high nibble of the filler instruction */
+		BUS_ARB_WRITE_DATA(0);
+		BUS_ARB_WRITE_E(DIO_PIN_LOW);
+		BUS_ARB_WRITE_RS(DIO_PIN_HIGH);
+		BUS_ARB_WRITE_DATA(BUS_ARB_Au8Digit[1]);
+		break;
+
+	case BUS_ARB_SLOT_DIGIT_3:
+		/* E rises with RS low, digits 1 and 2 blank; RS then turns digit 1 off while E
+		   stays high (hardware-validated only, see BUS_ARB_interface.h) */
+		BUS_ARB_WRITE_DATA(BUS_ARB_BCD_BLANK);
+		BUS_ARB_WRITE_RS(DIO_PIN_LOW);
+		BUS_ARB_WRITE_E(DIO_PIN_HIGH);
+		BUS_ARB_WRITE_RS(DIO_PIN_HIGH);
+		BUS_ARB_WRITE_DATA(BUS_ARB_Au8Digit[2]);
+		BUS_ARB_WRITE_COM3(DIO_PIN_LOW);
+		break;
+
+	case BUS_ARB_SLOT_DIGIT_4:
+		BUS_ARB_WRITE_COM3(DIO_PIN_HIGH);
+		BUS_ARB_WRITE_DATA(BUS_ARB_Au8Digit[3]);
+		BUS_ARB_WRITE_COM4(DIO_PIN_LOW);
+		break;
+
+	default:
+		/* E falls with RS low: the LCD latches the low nibble and runs the entry mode set */
+		BUS_ARB_WRITE_COM4(DIO_PIN_HIGH);
+		BUS_ARB_WRITE_DATA(BUS_ARB_u8EntryMode);
+		BUS_ARB_WRITE_RS(DIO_PIN_LOW);
+		BUS_ARB_WRITE_E(DIO_PIN_LOW);
+		BUS_ARB_WRITE_DATA(BUS_ARB_BCD_BLANK);
+		BUS_ARB_WRITE_RS(DIO_PIN_HIGH);
+
+		BUS_ARB_voidLcdSlot();
+		break;
+	}
+
+	BUS_ARB_u8Slot++;
+	if(BUS_ARB_u8Slot >= BUS_ARB_SLOTS_NUM)
+	{
+		BUS_ARB_u8Slot = BUS_ARB_SLOT_DIGIT_1;
+	}
+}
+
+/*
+ * Function: BUS_ARB_voidSetNumber
+ * Description:
+ *     Splits the number into the four digits read by the display slots.
+ */
+void BUS_ARB_voidSetNumber(u16 Copy_u16Number)
+{
+	u8 Local_u8Index;
+
+	if(Copy_u16Number > 9999)
+	{
+		return;
+	}
+
+	for(Local_u8Index = 0; Local_u8Index < 4; Local_u8Index++)
+	{
+		BUS_ARB_Au8Digit[Local_u8Index] = Copy_u16Number % 10;
+		Copy_u16Number /= 10;
+	}
+}
+
+/*
+ * Function: BUS_ARB_voidLcdWrite
+ * Description:
+ *     Adds one transfer at the head of the LCD queue. The index is published after the
+ *     entry, so the tick never reads a half-written entry.
+ */
+void BUS_ARB_voidLcdWrite(u8 Copy_u8Type, u8 Copy_u8Value)
+{
+	u8 Local_u8Next = (BUS_ARB_u8LcdHead + 1) & (BUS_ARB_LCD_QUEUE_SIZE - 1);
+
+	if(Copy_u8Type > BUS_ARB_LCD_NIBBLE)
+	{
+		return;
+	}
+
+	/* Queue full: wait for the next LCD slot */
+	while(Local_u8Next == BUS_ARB_u8LcdTail)
+	{
+	}
+
+	BUS_ARB_Au8LcdType[BUS_ARB_u8LcdHead] = Copy_u8Type;
+	BUS_ARB_Au8LcdValue[BUS_ARB_u8LcdHead] = Copy_u8Value;
+	BUS_ARB_u8LcdHead = Local_u8Next;
+}
+
+/*
+ * Function: BUS_ARB_voidLcdFlush
+ * Description:
+ *     Waits for the LCD slots to empty the queue.
+ */
+void BUS_ARB_voidLcdFlush(void)
+{
+	while(BUS_ARB_u8LcdTail != BUS_ARB_u8LcdHead)
+	{
+	}
+}
@@ -0,0 +1,65 @@
+/*
+ * File: DEBOUNCE_APP.c
+ *
+ * Description:
+ *     Test file for the DEBOUNCE module on an AVR ATmega32 engineering kit.
+ *     The debouncer runs from the 1 ms Timer0 tick. A press on the PD2 button toggles
+ *     the green LED (PA4), a press on the PD4 button toggles the blue LED (PA5) and
+ *     the yellow LED (PA6) follows the debounced state of the PD2 button.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <avr/interrupt.h>
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../../MCAL/DIO/DIO_interface.h"
+#include "../../MCAL/TIMER/TIMER_interface.h"
+
+/* HAL */
+#include "./DEBOUNCE_interface.h"
+
+int main(void)
+{
+	u8 Local_u8Pressed;
+
+	/* LEDs */
+	DIO_setPinDirection(DIO_PORTA, DIO_PIN4, DIO_PIN_OUTPUT);
+	DIO_setPinDirection(DIO_PORTA, DIO_PIN5, DIO_PIN_OUTPUT);
+	DIO_setPinDirection(DIO_PORTA, DIO_PIN6, DIO_PIN_OUTPUT);
+
+	/* Buttons to ground, internal pull-ups (active low in DEBOUNCE_config.h) */
+	DIO_setPinDirection(DIO_PORTD, DIO_PIN2, DIO_PIN_INPUT);
+	DIO_setPinDirection(DIO_PORTD, DIO_PIN4, DIO_PIN_INPUT);
+	DIO_activePinInPullUpResistance(DIO_PORTD, DIO_PIN2);
+	DIO_activePinInPullUpResistance(DIO_PORTD, DIO_PIN4);
+
+	DEBOUNCE_voidInit();
+	TIMER0_voidSetCallBack(DEBOUNCE_voidTick);
+	TIMER0_voidInitTick();
+	sei();
+
+	while(1)
+	{
+		Local_u8Pressed = DEBOUNCE_u8TakePressed(DIO_PORTD);
+
+		if(GET_BIT(Local_u8Pressed, DIO_PIN2))
+		{
+			DIO_togglePinValue(DIO_PORTA, DIO_PIN4);
+		}
+		if(GET_BIT(Local_u8Pressed, DIO_PIN4))
+		{
+			DIO_togglePinValue(DIO_PORTA, DIO_PIN5);
+		}
+
+		DIO_setPinValue(DIO_PORTA, DIO_PIN6, DEBOUNCE_u8GetPinState(DIO_PORTD, DIO_PIN2));
+	}
+
+	return 0;
+}
@@ -0,0 +1,42 @@
+/*
+ * File: DEBOUNCE_config.h
+ *
+ * Description:
+ *     Configuration header file for the DEBOUNCE module for AVR ATmega32.
+ *     Selects which pins of each port are debounced and which of them are active low.
+ *
+ * Usage:
+ *     - DEBOUNCE_PORTx_MASK: Pins of port x handled by the debouncer (1 = debounced).
+ *       Pins outside the mask always read as inactive and never produce events.
+ *     - DEBOUNCE_PORTx_ACTIVE_LOW: Pins of port x that are active when the line is low
+ *       (buttons to ground with pull-up). The debounced state is reported in logical
+ *       terms: 1 = active (pressed), 0 = inactive (released).
+ *
+ * Notes:
+ *     - A pin changes state after 4 consecutive samples at the new level, so with a
+ *       1 ms tick a bounce shorter than 4 ms is filtered out.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef DEBOUNCE_CONFIG_H_
+#define DEBOUNCE_CONFIG_H_
+
+/* PORTA: no debounced inputs */
+#define DEBOUNCE_PORTA_MASK          0x00
+#define DEBOUNCE_PORTA_ACTIVE_LOW    0x00
+
+/* PORTB: no debounced inputs */
+#define DEBOUNCE_PORTB_MASK          0x00
+#define DEBOUNCE_PORTB_ACTIVE_LOW    0x00
+
+/* PORTC: no debounced inputs (PC2..PC5 are keypad rows) */
+#define DEBOUNCE_PORTC_MASK          0x00
+#define DEBOUNCE_PORTC_ACTIVE_LOW    0x00
+
+/* PORTD: push buttons on PIN2 and PIN4 to ground with pull-up (keypad columns excluded) */
+#define DEBOUNCE_PORTD_MASK          0x14
+#define DEBOUNCE_PORTD_ACTIVE_LOW    0x14
+
+#endif /* DEBOUNCE_CONFIG_H_ */
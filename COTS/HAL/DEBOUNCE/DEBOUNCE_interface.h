@@ -0,0 +1,72 @@
+/*
+ * File: DEBOUNCE_interface.h
+ *
+ * Description:
+ *     Header file for the DEBOUNCE module for AVR ATmega32.
+ *     The debouncer samples PINA..PIND from a periodic tick and filters all configured
+ *     input pins in parallel, 8 pins per byte operation. It publishes the debounced
+ *     state of every port plus press/release edge bitmaps that are latched until the
+ *     application takes them, and optionally reports edges through a callback.
+ *
+ * Usage:
+ *     DEBOUNCE_voidInit();
+ *     TIMER0_voidSetCallBack(DEBOUNCE_voidTick);
+ *     TIMER0_voidInitTick();
+ *     ...
+ *     if(DEBOUNCE_u8TakePressed(DIO_PORTD) & (1 << DIO_PIN2)) { ... }
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef DEBOUNCE_INTERFACE_H_
+#define DEBOUNCE_INTERFACE_H_
+
+/* Function: DEBOUNCE_voidInit
+ * Description:
+ *     Loads the current level of the configured pins as their stable state (no edges are
+ *     reported for the initial levels) and clears the counters and edge bitmaps.
+ *     The pins must already be configured as inputs (e.g. by DIO_initPinsConfig).
+ */
+void DEBOUNCE_voidInit(void);
+
+/* Function: DEBOUNCE_voidTick
+ * Description:
+ *     Samples the four ports once and advances the debounce counters. Called from a
+ *     periodic interrupt, typically as the TIMER0 tick callback.
+ */
+void DEBOUNCE_voidTick(void);
+
+/* Function: DEBOUNCE_voidSetCallBack
+ * Description:
+ *     Registers a function called from DEBOUNCE_voidTick for every port where at least one
+ *     pin changed its debounced state, with the bitmaps of the pins that became active
+ *     (Pressed) and inactive (Released). Runs in interrupt context. NULL disables it.
+ */
+void DEBOUNCE_voidSetCallBack(void (*Copy_pvCallBack)(u8 Copy_u8PortId, u8 Copy_u8Pressed, u8 Copy_u8Released));
+
+/* Function: DEBOUNCE_u8GetPortState
+ * Description:
+ *     Returns the debounced state of a port (1 = active). Returns 0 for an invalid port.
+ */
+u8 DEBOUNCE_u8GetPortState(u8 Copy_u8PortId);
+
+/* Function: DEBOUNCE_u8GetPinState
+ * Description:
+ *     Returns the debounced state of one pin (1 = active). Returns 0 for an invalid pin.
+ */
+u8 DEBOUNCE_u8GetPinState(u8 Copy_u8PortId, u8 Copy_u8PinId);
+
+/* Function: DEBOUNCE_u8TakePressed
+ * Description:
+ *     Returns the pins of a port that became active since the previous call and clears them.
+ */
+u8 DEBOUNCE_u8TakePressed(u8 Copy_u8PortId);
+
+/* Function: DEBOUNCE_u8TakeReleased
+ * Description:
+ *     Returns the pins of a port that became inactive since the previous call and clears them.
+ */
+u8 DEBOUNCE_u8TakeReleased(u8 Copy_u8PortId);
+
+#endif /* DEBOUNCE_INTERFACE_H_ */
@@ -0,0 +1,29 @@
+/*
+ * File: DEBOUNCE_private.h
+ *
+ * Description:
+ *     Private header file for the DEBOUNCE module for AVR ATmega32.
+ *     It documents the vertical counter used by DEBOUNCE_voidTick.
+ *
+ * Vertical Counter:
+ *     Each pin owns a 2-bit counter whose bits are stored "vertically": bit n of
+ *     DEBOUNCE_Au8Counter0[port] and bit n of DEBOUNCE_Au8Counter1[port] are the
+ *     two counter bits of pin n. One set of byte operations therefore advances the
+ *     counters of all 8 pins of a port at once:
+ *         Delta    = State ^ Sample            pins that differ from the stable state
+ *         Counter0 = ~(Counter0 & Delta)       counters of equal pins reset to 3,
+ *         Counter1 = Counter0 ^ (Counter1 & Delta)   the others count down
+ *         Toggle   = Delta & Counter0 & Counter1     counter wrapped: 4 samples differed
+ *         State   ^= Toggle
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef DEBOUNCE_PRIVATE_H_
+#define DEBOUNCE_PRIVATE_H_
+
+/* Number of ports sampled by the debouncer */
+#define DEBOUNCE_PORTS_NUM      4
+
+#endif /* DEBOUNCE_PRIVATE_H_ */
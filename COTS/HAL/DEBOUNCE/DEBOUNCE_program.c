@@ -0,0 +1,201 @@
+/*
+ * File: DEBOUNCE_program.c
+ *
+ * Description:
+ *     Implementation of the DEBOUNCE module for AVR ATmega32.
+ *     All configured pins are filtered with 2-bit vertical counters (see
+ *     DEBOUNCE_private.h): one tick costs a handful of byte operations per port,
+ *     whatever the number of debounced pins.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <util/atomic.h>
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../../MCAL/DIO/DIO_interface.h"
+#include "../../MCAL/DIO/DIO_private.h"
+
+/* HAL */
+#include "./DEBOUNCE_interface.h"
+#include "./DEBOUNCE_private.h"
+#include "./DEBOUNCE_config.h"
+
+/* Configuration tables, indexed by port */
+static const u8 DEBOUNCE_Au8Mask[DEBOUNCE_PORTS_NUM] =
+{
+	DEBOUNCE_PORTA_MASK, DEBOUNCE_PORTB_MASK, DEBOUNCE_PORTC_MASK, DEBOUNCE_PORTD_MASK
+};
+
+static const u8 DEBOUNCE_Au8ActiveLow[DEBOUNCE_PORTS_NUM] =
+{
+	DEBOUNCE_PORTA_ACTIVE_LOW, DEBOUNCE_PORTB_ACTIVE_LOW, DEBOUNCE_PORTC_ACTIVE_LOW, DEBOUNCE_PORTD_ACTIVE_LOW
+};
+
+/* Debounced state and latched edges, shared with the tick interrupt */
+static volatile u8 DEBOUNCE_Au8State[DEBOUNCE_PORTS_NUM];
+static volatile u8 DEBOUNCE_Au8Pressed[DEBOUNCE_PORTS_NUM];
+static volatile u8 DEBOUNCE_Au8Released[DEBOUNCE_PORTS_NUM];
+
+/* Vertical counters, only touched by the tick */
+static u8 DEBOUNCE_Au8Counter0[DEBOUNCE_PORTS_NUM];
+static u8 DEBOUNCE_Au8Counter1[DEBOUNCE_PORTS_NUM];
+
+static void (*DEBOUNCE_pvCallBack)(u8 Copy_u8PortId, u8 Copy_u8Pressed, u8 Copy_u8Released) = NULL;
+
+/*
+ * Function: DEBOUNCE_voidInit
+ * Description:
+ *     Takes the current pin levels as the stable state and resets the counters
+ *     (all ones = no pending change) and the latched edges.
+ * Returns: void
+ */
+void DEBOUNCE_voidInit(void)
+{
+	u8 Local_u8PortId;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		for(Local_u8PortId = 0; Local_u8PortId < DEBOUNCE_PORTS_NUM; Local_u8PortId++)
+		{
+			DEBOUNCE_Au8State[Local_u8PortId] = (DIO_PIN_REG(Local_u8PortId) ^ DEBOUNCE_Au8ActiveLow[Local_u8PortId]) & DEBOUNCE_Au8Mask[Local_u8PortId];
+			DEBOUNCE_Au8Pressed[Local_u8PortId] = 0;
+			DEBOUNCE_Au8Released[Local_u8PortId] = 0;
+			DEBOUNCE_Au8Counter0[Local_u8PortId] = 0xFF;
+			DEBOUNCE_Au8Counter1[Local_u8PortId] = 0xFF;
+		}
+	}
+}
+
+/*
+ * Function: DEBOUNCE_voidTick
+ * Description:
+ *     Samples PINA..PIND, advances the vertical counters of the configured pins and
+ *     latches the edges of the pins whose debounced state changed.
+ * Returns: void
+ */
+void DEBOUNCE_voidTick(void)
+{
+	u8 Local_u8PortId;
+
+	for(Local_u8PortId = 0; Local_u8PortId < DEBOUNCE_PORTS_NUM; Local_u8PortId++)
+	{
+		u8 Local_u8Sample = (DIO_PIN_REG(Local_u8PortId) ^ DEBOUNCE_Au8ActiveLow[Local_u8PortId]) & DEBOUNCE_Au8Mask[Local_u8PortId];
+		u8 Local_u8State = DEBOUNCE_Au8State[Local_u8PortId];
+		u8 Local_u8Delta = Local_u8State ^ Local_u8Sample;
+		u8 Local_u8Counter0;
+		u8 Local_u8Counter1;
+
+		/* Advance the 8 counters of this port (see DEBOUNCE_private.h) */
+		Local_u8Counter0 = ~(DEBOUNCE_Au8Counter0[Local_u8PortId] & Local_u8Delta);
+		Local_u8Counter1 = Local_u8Counter0 ^ (DEBOUNCE_Au8Counter1[Local_u8PortId] & Local_u8Delta);
+		DEBOUNCE_Au8Counter0[Local_u8PortId] = Local_u8Counter0;
+		DEBOUNCE_Au8Counter1[Local_u8PortId] = Local_u8Counter1;
+
+		Local_u8Delta &= Local_u8Counter0 & Local_u8Counter1;
+		if(Local_u8Delta != 0)
+		{
+			Local_u8State ^= Local_u8Delta;
+			DEBOUNCE_Au8State[Local_u8PortId] = Local_u8State;
+			DEBOUNCE_Au8Pressed[Local_u8PortId] |= Local_u8Delta & Local_u8State;
+			DEBOUNCE_Au8Released[Local_u8PortId] |= Local_u8Delta & (u8)~Local_u8State;
+
+			if(DEBOUNCE_pvCallBack != NULL)
+			{
+				DEBOUNCE_pvCallBack(Local_u8PortId, Local_u8Delta & Local_u8State, Local_u8Delta & (u8)~Local_u8State);
+			}
+		}
+	}
+}
+
+/*
+ * Function: DEBOUNCE_voidSetCallBack
+ * Description:
+ *     Stores the edge callback with interrupts disabled, so the tick never calls a
+ *     half-written pointer.
+ * Parameters:
+ *     - Copy_pvCallBack: Function called on edges, or NULL.
+ * Returns: void
+ */
+void DEBOUNCE_voidSetCallBack(void (*Copy_pvCallBack)(u8 Copy_u8PortId, u8 Copy_u8Pressed, u8 Copy_u8Released))
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		DEBOUNCE_pvCallBack = Copy_pvCallBack;
+	}
+}
+
+/*
+ * Function: DEBOUNCE_u8GetPortState
+ * Description:
+ *     Returns the debounced state of the port (1 = active), 0 for an invalid port.
+ */
+u8 DEBOUNCE_u8GetPortState(u8 Copy_u8PortId)
+{
+	if(Copy_u8PortId >= DEBOUNCE_PORTS_NUM)
+	{
+		return 0;
+	}
+	return DEBOUNCE_Au8State[Copy_u8PortId];
+}
+
+/*
+ * Function: DEBOUNCE_u8GetPinState
+ * Description:
+ *     Returns the debounced state of the pin (1 = active), 0 for an invalid pin.
+ */
+u8 DEBOUNCE_u8GetPinState(u8 Copy_u8PortId, u8 Copy_u8PinId)
+{
+	if((Copy_u8PortId >= DEBOUNCE_PORTS_NUM) || (Copy_u8PinId > DIO_PIN7))
+	{
+		return 0;
+	}
+	return GET_BIT(DEBOUNCE_Au8State[Copy_u8PortId], Copy_u8PinId);
+}
+
+/*
+ * Function: DEBOUNCE_u8TakePressed
+ * Description:
+ *     Returns and clears the latched press edges of the port.
+ */
+u8 DEBOUNCE_u8TakePressed(u8 Copy_u8PortId)
+{
+	u8 Local_u8Pressed = 0;
+
+	if(Copy_u8PortId < DEBOUNCE_PORTS_NUM)
+	{
+		/* Read and clear together so an edge latched by the tick in between is not lost */
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			Local_u8Pressed = DEBOUNCE_Au8Pressed[Copy_u8PortId];
+			DEBOUNCE_Au8Pressed[Copy_u8PortId] = 0;
+		}
+	}
+	return Local_u8Pressed;
+}
+
+/*
+ * Function: DEBOUNCE_u8TakeReleased
+ * Description:
+ *     Returns and clears the latched release edges of the port.
+ */
+u8 DEBOUNCE_u8TakeReleased(u8 Copy_u8PortId)
+{
+	u8 Local_u8Released = 0;
+
+	if(Copy_u8PortId < DEBOUNCE_PORTS_NUM)
+	{
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			Local_u8Released = DEBOUNCE_Au8Released[Copy_u8PortId];
+			DEBOUNCE_Au8Released[Copy_u8PortId] = 0;
+		}
+	}
+	return Local_u8Released;
+}
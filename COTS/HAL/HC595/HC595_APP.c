@@ -0,0 +1,57 @@
+/*
+ * File: HC595_APP.c
+ *
+ * Description:
+ *     Test file for the HC595 module on an AVR ATmega32 engineering kit with two chained
+ *     74HC595s driving 16 LEDs (wiring in HC595_config.h).
+ *     A single light runs along the 16 outputs through the virtual DIO channels; every
+ *     fourth step all outputs of chip 1 are inverted in one batch, which costs a single
+ *     shift-out for the eight changes.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <util/delay.h>
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../../MCAL/DIO/DIO_interface.h"
+
+/* HAL */
+#include "./HC595_interface.h"
+
+int main(void)
+{
+	u8 Local_u8Step = 0;
+	u8 Local_u8Pin;
+
+	HC595_voidInit();
+
+	while(1)
+	{
+		/* Running light: one virtual channel off, the next one on */
+		DIO_setChannelValue(Dio_VPIN_0 + Local_u8Step, DIO_PIN_LOW);
+		Local_u8Step = (Local_u8Step + 1) % 16;
+		DIO_setChannelValue(Dio_VPIN_0 + Local_u8Step, DIO_PIN_HIGH);
+
+		/* Batch: eight toggles, one shift-out */
+		if((Local_u8Step % 4) == 0)
+		{
+			HC595_voidBeginUpdate();
+			for(Local_u8Pin = 8; Local_u8Pin < 16; Local_u8Pin++)
+			{
+				DIO_toggleChannelValue(Dio_VPIN_0 + Local_u8Pin);
+			}
+			HC595_voidEndUpdate();
+		}
+
+		_delay_ms(100);
+	}
+
+	return 0;
+}
@@ -0,0 +1,40 @@
+/*
+ * File: HC595_config.h
+ *
+ * Description:
+ *     Configuration header file for the 74HC595 output expansion module for AVR ATmega32.
+ *
+ * Usage:
+ *     - HC595_DATA_CHANNEL / HC595_CLOCK_CHANNEL / HC595_LATCH_CHANNEL: DIO channels
+ *       (Dio_PINx_n) wired to DS (pin 14), SH_CP (pin 11) and ST_CP (pin 12) of chip 0.
+ *       Chip n+1 takes its DS from Q7' (pin 9) of chip n and shares SH_CP and ST_CP.
+ *       DS and SH_CP on the same port are shifted with one port write per bit, which is
+ *       the faster wiring. The three lines idle low.
+ *       The lines must be pins no other driver uses: the chain latches whatever is shifted
+ *       while its clock toggles. The defaults are the pins left free by the board
+ *       (PINMAP/pinmap.txt): PA0/PA7 (DS and SH_CP on one port) and PD4. With
+ *       DIO_PIN_MAP_GENERATED (DIO_config.h) the lines come from that map instead.
+ *     - HC595_CHIPS_NUM: Number of chips in the chain, 1 to 4 (DIO_VIRTUAL_PINS / 8).
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef HC595_CONFIG_H_
+#define HC595_CONFIG_H_
+
+/* Serial lines */
+#if DIO_PIN_MAP == DIO_PIN_MAP_GENERATED
+#define HC595_DATA_CHANNEL     PINMAP_HC595_DATA_CHANNEL
+#define HC595_CLOCK_CHANNEL    PINMAP_HC595_CLOCK_CHANNEL
+#define HC595_LATCH_CHANNEL    PINMAP_HC595_LATCH_CHANNEL
+#else
+#define HC595_DATA_CHANNEL     Dio_PINA_0
+#define HC595_CLOCK_CHANNEL    Dio_PINA_7
+#define HC595_LATCH_CHANNEL    Dio_PIND_4
+#endif
+
+/* Chips in the chain */
+#define HC595_CHIPS_NUM        2
+
+#endif /* HC595_CONFIG_H_ */
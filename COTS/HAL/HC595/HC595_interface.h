@@ -0,0 +1,79 @@
+/*
+ * File: HC595_interface.h
+ *
+ * Description:
+ *     Header file for the 74HC595 output expansion module for AVR ATmega32.
+ *     A chain of 74HC595 shift registers is clocked through a bit-banged SPI on three DIO
+ *     channels (HC595_config.h). Their outputs appear as the virtual DIO channels
+ *     Dio_VPIN_0.. (chip 0, the one wired to the MCU, carries Dio_VPIN_0..7 on Q0..Q7),
+ *     so DIO_setChannelValue(Dio_VPIN_9, ...) drives Q1 of chip 1.
+ *
+ *     Every change shifts the whole chain out and latches it, unless it is made between
+ *     HC595_voidBeginUpdate and HC595_voidEndUpdate: the changes are then collected in RAM
+ *     and cost one shift-out in total.
+ *
+ *     Throughput at F_CPU = 8 MHz, -Os (from the generated instruction sequence):
+ *         DS and SH_CP on the same port : 6 cycles per bit, 1.33 Mbit/s while shifting;
+ *                                         about 60 cycles per chip, 1.0 Mbit/s sustained
+ *         DS and SH_CP on different ports: 9 cycles per bit, 0.89 Mbit/s while shifting;
+ *                                         about 84 cycles per chip, 0.76 Mbit/s sustained
+ *     A full update adds the latch pulse and the call (about 30 cycles). BENCH_APP measures
+ *     HC595_voidUpdate on the actual build.
+ *
+ *     Not reentrant: use from the main loop or from one ISR only.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef HC595_INTERFACE_H_
+#define HC595_INTERFACE_H_
+
+/* Function: HC595_voidInit
+ * Description:
+ *     Makes DS, SH_CP and ST_CP outputs (low), clears all outputs of the chain and
+ *     registers the module as the DIO virtual channel driver.
+ */
+void HC595_voidInit(void);
+
+/* Function: HC595_voidSetPinValue
+ * Description:
+ *     Sets output Copy_u8Pin of the chain (0 = chip 0 Q0) to DIO_PIN_LOW or DIO_PIN_HIGH.
+ *     Invalid pins are ignored.
+ */
+void HC595_voidSetPinValue(u8 Copy_u8Pin, u8 Copy_u8Value);
+
+/* Function: HC595_voidGetPinValue
+ * Description:
+ *     Returns the value last written to output Copy_u8Pin (latched or pending).
+ */
+void HC595_voidGetPinValue(u8 Copy_u8Pin, u8* Copy_pu8Value);
+
+/* Function: HC595_voidTogglePinValue
+ * Description:
+ *     Inverts output Copy_u8Pin of the chain.
+ */
+void HC595_voidTogglePinValue(u8 Copy_u8Pin);
+
+/* Function: HC595_voidWriteChip
+ * Description:
+ *     Sets the eight outputs of one chip at once (bit n drives Qn).
+ */
+void HC595_voidWriteChip(u8 Copy_u8Chip, u8 Copy_u8Value);
+
+/* Function: HC595_voidBeginUpdate / HC595_voidEndUpdate
+ * Description:
+ *     Group changes into one shift-out: between the two calls changes only update RAM,
+ *     and the outermost HC595_voidEndUpdate shifts the chain out once if anything changed.
+ *     Calls may be nested.
+ */
+void HC595_voidBeginUpdate(void);
+void HC595_voidEndUpdate(void);
+
+/* Function: HC595_voidUpdate
+ * Description:
+ *     Shifts the whole chain out and latches it now.
+ */
+void HC595_voidUpdate(void);
+
+#endif /* HC595_INTERFACE_H_ */
@@ -0,0 +1,31 @@
+/*
+ * File: HC595_private.h
+ *
+ * Description:
+ *     Private header file for the 74HC595 output expansion module for AVR ATmega32.
+ *     It derives the ports and masks of the configured channels.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef HC595_PRIVATE_H_
+#define HC595_PRIVATE_H_
+
+/* Ports, pins and masks of the serial lines */
+#define HC595_DATA_PORT      (HC595_DATA_CHANNEL / 8)
+#define HC595_DATA_PIN       (HC595_DATA_CHANNEL % 8)
+#define HC595_DATA_MASK      (1 << HC595_DATA_PIN)
+
+#define HC595_CLOCK_PORT     (HC595_CLOCK_CHANNEL / 8)
+#define HC595_CLOCK_PIN      (HC595_CLOCK_CHANNEL % 8)
+#define HC595_CLOCK_MASK     (1 << HC595_CLOCK_PIN)
+
+#define HC595_LATCH_PORT     (HC595_LATCH_CHANNEL / 8)
+#define HC595_LATCH_PIN      (HC595_LATCH_CHANNEL % 8)
+#define HC595_LATCH_MASK     (1 << HC595_LATCH_PIN)
+
+/* Total number of outputs */
+#define HC595_PINS_NUM       (HC595_CHIPS_NUM * 8)
+
+#endif /* HC595_PRIVATE_H_ */
@@ -0,0 +1,326 @@
+/*
+ * File: HC595_program.c
+ *
+ * Description:
+ *     Implementation of the 74HC595 output expansion module for AVR ATmega32.
+ *     The outputs are kept in a RAM image; an update shifts the image out MSB first,
+ *     last chip first, with a fully unrolled bit loop, then pulses ST_CP.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <util/atomic.h>
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../../MCAL/DIO/DIO_interface.h"
+#include "../../MCAL/DIO/DIO_private.h"
+#include "../../MCAL/DIO/DIO_config.h"
+
+/* HAL */
+#include "./HC595_interface.h"
+#include "./HC595_private.h"
+#include "./HC595_config.h"
+
+#if (HC595_CHIPS_NUM < 1) || (HC595_CHIPS_NUM > (DIO_VIRTUAL_PINS / 8))
+#error "HC595_CHIPS_NUM must be 1 to DIO_VIRTUAL_PINS / 8"
+#endif
+
+#if DIO_SHADOW_MODE == DIO_SHADOW_DEFERRED
+#error "HC595 needs its clock and latch edges on the pins at once: DIO_SHADOW_DEFERRED is not supported"
+#endif
+
+/*
+ * Line writes: the shift, both shift forms and the latch write the port registers
+ * directly (SBI/CBI, or one port write per bit on the same-port form), always inside an
+ * ATOMIC_BLOCK that ends with HC595_SYNC_SHADOW, so the DIO shadow registers
+ * (DIO_SHADOW_IMMEDIATE) hold the levels left on the lines and no DIO write from an
+ * interrupt can land between a line write and its shadow update.
+ */
+#define HC595_LINE_HIGH(Line)        SET_BIT(DIO_PORT_REG(HC595_##Line##_PORT), HC595_##Line##_PIN)
+#define HC595_LINE_LOW(Line)         CLR_BIT(DIO_PORT_REG(HC595_##Line##_PORT), HC595_##Line##_PIN)
+
+#if DIO_SHADOW_MODE != DIO_SHADOW_DISABLED
+#define HC595_SYNC_SHADOW(Line)                                                         \
+	(DIO_Au8PortShadow[HC595_##Line##_PORT] =                                           \
+		(DIO_Au8PortShadow[HC595_##Line##_PORT] & (u8)~HC595_##Line##_MASK) |           \
+		(DIO_PORT_REG(HC595_##Line##_PORT) & HC595_##Line##_MASK))
+#else
+#define HC595_SYNC_SHADOW(Line)
+#endif
+
+/*
+ * DS and SH_CP on one port: one port write presents the data bit with SH_CP low, and an
+ * SBI raises SH_CP (the data was stable for the 2 cycles of the SBI).
+ */
+#define HC595_SHIFT_BIT_SAME_PORT(Bit)                                                  \
+	do                                                                                  \
+	{                                                                                   \
+		DIO_PORT_REG(HC595_DATA_PORT) = GET_BIT(Copy_u8Byte, (Bit)) ? Local_u8One : Local_u8Idle; \
+		HC595_LINE_HIGH(CLOCK);                                                         \
+	} while(0)
+
+/* DS and SH_CP on different ports: SBI/CBI on each line */
+#define HC595_SHIFT_BIT_SPLIT(Bit)                                                      \
+	do                                                                                  \
+	{                                                                                   \
+		if(GET_BIT(Copy_u8Byte, (Bit)))                                                 \
+		{                                                                               \
+			HC595_LINE_HIGH(DATA);                                                      \
+		}                                                                               \
+		else                                                                            \
+		{                                                                               \
+			HC595_LINE_LOW(DATA);                                                       \
+		}                                                                               \
+		HC595_LINE_HIGH(CLOCK);                                                         \
+		HC595_LINE_LOW(CLOCK);                                                          \
+	} while(0)
+
+/* Output image, chip 0 first */
+static u8 HC595_Au8Image[HC595_CHIPS_NUM];
+
+/* Nesting depth of HC595_voidBeginUpdate, and whether the image changed meanwhile */
+static u8 HC595_u8UpdateDepth = 0;
+static u8 HC595_u8Dirty = 0;
+
+/* Virtual channel driver registered with DIO */
+static const Dio_VIRTUAL_DRIVER HC595_strVirtualDriver =
+{
+	HC595_voidSetPinValue,
+	HC595_voidGetPinValue,
+	HC595_voidTogglePinValue
+};
+
+/*
+ * Function: HC595_voidShiftByte
+ * Description:
+ *     Shifts one byte out, MSB first, and leaves DS and SH_CP low.
+ *     The same-port form writes PORTx from an image read with interrupts disabled, so
+ *     no other write to that port can be lost.
+ */
+static void HC595_voidShiftByte(u8 Copy_u8Byte)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		if(HC595_DATA_PORT == HC595_CLOCK_PORT)
+		{
+			u8 Local_u8Idle = DIO_PORT_REG(HC595_DATA_PORT) & (u8)~(HC595_DATA_MASK | HC595_CLOCK_MASK);
+			u8 Local_u8One = Local_u8Idle | HC595_DATA_MASK;
+
+			HC595_SHIFT_BIT_SAME_PORT(7);
+			HC595_SHIFT_BIT_SAME_PORT(6);
+			HC595_SHIFT_BIT_SAME_PORT(5);
+			HC595_SHIFT_BIT_SAME_PORT(4);
+			HC595_SHIFT_BIT_SAME_PORT(3);
+			HC595_SHIFT_BIT_SAME_PORT(2);
+			HC595_SHIFT_BIT_SAME_PORT(1);
+			HC595_SHIFT_BIT_SAME_PORT(0);
+
+			DIO_PORT_REG(HC595_DATA_PORT) = Local_u8Idle;
+		}
+		else
+		{
+			HC595_SHIFT_BIT_SPLIT(7);
+			HC595_SHIFT_BIT_SPLIT(6);
+			HC595_SHIFT_BIT_SPLIT(5);
+			HC595_SHIFT_BIT_SPLIT(4);
+			HC595_SHIFT_BIT_SPLIT(3);
+			HC595_SHIFT_BIT_SPLIT(2);
+			HC595_SHIFT_BIT_SPLIT(1);
+			HC595_SHIFT_BIT_SPLIT(0);
+
+			HC595_LINE_LOW(DATA);
+		}
+
+		HC595_SYNC_SHADOW(DATA);
+		HC595_SYNC_SHADOW(CLOCK);
+	}
+}
+
+/*
+ * Function: HC595_voidChanged
+ * Description:
+ *     Shifts the image out now, or marks it for the end of the current batch.
+ */
+static void HC595_voidChanged(void)
+{
+	if(HC595_u8UpdateDepth != 0)
+	{
+		HC595_u8Dirty = 1;
+	}
+	else
+	{
+		HC595_voidUpdate();
+	}
+}
+
+/*
+ * Function: HC595_voidInit
+ * Description:
+ *     Configures the three lines as low outputs, clears the chain and registers the
+ *     virtual channel driver.
+ */
+void HC595_voidInit(void)
+{
+	u8 Local_u8Chip;
+
+	DIO_setChannelValue(HC595_DATA_CHANNEL, DIO_PIN_LOW);
+	DIO_setChannelValue(HC595_CLOCK_CHANNEL, DIO_PIN_LOW);
+	DIO_setChannelValue(HC595_LATCH_CHANNEL, DIO_PIN_LOW);
+	DIO_setChannelDirection(HC595_DATA_CHANNEL, DIO_PIN_OUTPUT);
+	DIO_setChannelDirection(HC595_CLOCK_CHANNEL, DIO_PIN_OUTPUT);
+	DIO_setChannelDirection(HC595_LATCH_CHANNEL, DIO_PIN_OUTPUT);
+
+	for(Local_u8Chip = 0; Local_u8Chip < HC595_CHIPS_NUM; Local_u8Chip++)
+	{
+		HC595_Au8Image[Local_u8Chip] = 0;
+	}
+
+	HC595_u8UpdateDepth = 0;
+	HC595_u8Dirty = 0;
+	HC595_voidUpdate();
+
+	DIO_setVirtualDriver(&HC595_strVirtualDriver);
+}
+
+/*
+ * Function: HC595_voidSetPinValue
+ * Description:
+ *     Updates one bit of the image; the chain is only shifted if the bit changed.
+ */
+void HC595_voidSetPinValue(u8 Copy_u8Pin, u8 Copy_u8Value)
+{
+	u8 Local_u8Old;
+
+	if(Copy_u8Pin >= HC595_PINS_NUM)
+	{
+		return;
+	}
+
+	Local_u8Old = HC595_Au8Image[Copy_u8Pin / 8];
+
+	if(Copy_u8Value == DIO_PIN_HIGH)
+	{
+		SET_BIT(HC595_Au8Image[Copy_u8Pin / 8], Copy_u8Pin % 8);
+	}
+	else if(Copy_u8Value == DIO_PIN_LOW)
+	{
+		CLR_BIT(HC595_Au8Image[Copy_u8Pin / 8], Copy_u8Pin % 8);
+	}
+
+	if(HC595_Au8Image[Copy_u8Pin / 8] != Local_u8Old)
+	{
+		HC595_voidChanged();
+	}
+}
+
+/*
+ * Function: HC595_voidGetPinValue
+ * Description:
+ *     Reads one bit of the image.
+ */
+void HC595_voidGetPinValue(u8 Copy_u8Pin, u8* Copy_pu8Value)
+{
+	if((Copy_u8Pin >= HC595_PINS_NUM) || (Copy_pu8Value == NULL))
+	{
+		return;
+	}
+
+	*Copy_pu8Value = GET_BIT(HC595_Au8Image[Copy_u8Pin / 8], Copy_u8Pin % 8);
+}
+
+/*
+ * Function: HC595_voidTogglePinValue
+ * Description:
+ *     Inverts one bit of the image.
+ */
+void HC595_voidTogglePinValue(u8 Copy_u8Pin)
+{
+	if(Copy_u8Pin >= HC595_PINS_NUM)
+	{
+		return;
+	}
+
+	TOG_BIT(HC595_Au8Image[Copy_u8Pin / 8], Copy_u8Pin % 8);
+	HC595_voidChanged();
+}
+
+/*
+ * Function: HC595_voidWriteChip
+ * Description:
+ *     Replaces the image byte of one chip.
+ */
+void HC595_voidWriteChip(u8 Copy_u8Chip, u8 Copy_u8Value)
+{
+	if((Copy_u8Chip >= HC595_CHIPS_NUM) || (HC595_Au8Image[Copy_u8Chip] == Copy_u8Value))
+	{
+		return;
+	}
+
+	HC595_Au8Image[Copy_u8Chip] = Copy_u8Value;
+	HC595_voidChanged();
+}
+
+/*
+ * Function: HC595_voidBeginUpdate
+ * Description:
+ *     Opens (or nests) a batch of changes.
+ */
+void HC595_voidBeginUpdate(void)
+{
+	if(HC595_u8UpdateDepth < 0xFF)
+	{
+		HC595_u8UpdateDepth++;
+	}
+}
+
+/*
+ * Function: HC595_voidEndUpdate
+ * Description:
+ *     Closes a batch; the outermost one shifts the chain out if the image changed.
+ */
+void HC595_voidEndUpdate(void)
+{
+	if(HC595_u8UpdateDepth == 0)
+	{
+		return;
+	}
+
+	HC595_u8UpdateDepth--;
+
+	if((HC595_u8UpdateDepth == 0) && (HC595_u8Dirty != 0))
+	{
+		HC595_voidUpdate();
+	}
+}
+
+/*
+ * Function: HC595_voidUpdate
+ * Description:
+ *     Shifts the image out, the last chip first, then pulses ST_CP so all outputs of
+ *     the chain change together.
+ */
+void HC595_voidUpdate(void)
+{
+	u8 Local_u8Chip = HC595_CHIPS_NUM;
+
+	while(Local_u8Chip > 0)
+	{
+		Local_u8Chip--;
+		HC595_voidShiftByte(HC595_Au8Image[Local_u8Chip]);
+	}
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		HC595_LINE_HIGH(LATCH);
+		HC595_LINE_LOW(LATCH);
+		HC595_SYNC_SHADOW(LATCH);
+	}
+
+	HC595_u8Dirty = 0;
+}
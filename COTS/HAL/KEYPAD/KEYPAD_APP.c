@@ -0,0 +1,71 @@
+/*
+ * File: KEYPAD_APP.c
+ *
+ * Description:
+ *     Test file for the 4x4 KEYPAD module on an AVR ATmega32 engineering kit.
+ *     The keypad is scanned from the 1 ms Timer0 tick. The main loop drains the event
+ *     buffer and shows the key and event type on the LCD: pressed keys are typed on
+ *     line 1, and the last event is described on line 2.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <avr/interrupt.h>
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../../MCAL/DIO/DIO_interface.h"
+#include "../../MCAL/TIMER/TIMER_interface.h"
+
+/* HAL */
+#include "../LCD_4x20/LCD_interface.h"
+#include "./KEYPAD_interface.h"
+
+int main(void)
+{
+	Keypad_EVENT Local_Event;
+	u8 Local_u8Cell = 0;
+
+	LCD_voidInit();
+	KEYPAD_voidInit();
+
+	TIMER0_voidSetCallBack(KEYPAD_voidTick);
+	TIMER0_voidInitTick();
+	sei();
+
+	while(1)
+	{
+		while(KEYPAD_u8GetEvent(&Local_Event))
+		{
+			if((Local_Event.Type == KEYPAD_EVENT_PRESS) || (Local_Event.Type == KEYPAD_EVENT_REPEAT))
+			{
+				if(Local_u8Cell == 20)
+				{
+					LCD_voidGoToClear(LCD_LINE_ONE, 0, 20);
+					Local_u8Cell = 0;
+				}
+				LCD_voidGoTo(LCD_LINE_ONE, Local_u8Cell++);
+				LCD_voidSendChar(Local_Event.Key);
+			}
+
+			LCD_voidGoToClear(LCD_LINE_TWO, 0, 20);
+			LCD_voidGoTo(LCD_LINE_TWO, 0);
+			LCD_voidSendChar(Local_Event.Key);
+			switch(Local_Event.Type)
+			{
+				case KEYPAD_EVENT_PRESS:      LCD_voidWriteString((u8*)" pressed");  break;
+				case KEYPAD_EVENT_RELEASE:    LCD_voidWriteString((u8*)" released"); break;
+				case KEYPAD_EVENT_LONG_PRESS: LCD_voidWriteString((u8*)" long");     break;
+				case KEYPAD_EVENT_REPEAT:     LCD_voidWriteString((u8*)" repeat");   break;
+				default: break;
+			}
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,76 @@
+/*
+ * File: KEYPAD_config.h
+ *
+ * Description:
+ *     Configuration header file for the 4x4 KEYPAD module for AVR ATmega32.
+ *     Selects the row and column channels, the key map and the timing of the scanner.
+ *
+ * Usage:
+ *     - KEYPAD_ROWx_CHANNEL / KEYPAD_COLx_CHANNEL: DIO channels (Dio_PINx_n) of the rows and
+ *       columns. Rows are driven low one at a time; columns are inputs with pull-up, so a
+ *       pressed key pulls its column low while its row is selected.
+ *       With DIO_PIN_MAP_GENERATED (DIO_config.h) they come from the ROW and COL buses of
+ *       the board pin map (PINMAP/pinmap.txt) instead.
+ *     - KEYPAD_KEYS: Value reported for each key, as {row 0}, {row 1}, ... initializers.
+ *     - KEYPAD_TICK_PERIOD_MS: Period of the tick calling KEYPAD_voidTick. One row is
+ *       scanned per tick, so a full scan takes 4 ticks.
+ *     - KEYPAD_DEBOUNCE_MS: Time the key matrix must stay unchanged before presses and
+ *       releases are reported. Rounded up to whole scans, at least one (also for 0).
+ *     - KEYPAD_LONG_PRESS_MS / KEYPAD_REPEAT_MS: Hold time before the long-press event and
+ *       period of the auto-repeat events that follow while the key stays pressed.
+ *     - KEYPAD_EVENT_BUFFER_SIZE: Number of buffered events, a power of two up to 128.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef KEYPAD_CONFIG_H_
+#define KEYPAD_CONFIG_H_
+
+#if DIO_PIN_MAP == DIO_PIN_MAP_GENERATED
+
+/* Rows and columns from the board pin map */
+#define KEYPAD_ROW0_CHANNEL        PINMAP_KEYPAD_ROW0_CHANNEL
+#define KEYPAD_ROW1_CHANNEL        PINMAP_KEYPAD_ROW1_CHANNEL
+#define KEYPAD_ROW2_CHANNEL        PINMAP_KEYPAD_ROW2_CHANNEL
+#define KEYPAD_ROW3_CHANNEL        PINMAP_KEYPAD_ROW3_CHANNEL
+
+#define KEYPAD_COL0_CHANNEL        PINMAP_KEYPAD_COL0_CHANNEL
+#define KEYPAD_COL1_CHANNEL        PINMAP_KEYPAD_COL1_CHANNEL
+#define KEYPAD_COL2_CHANNEL        PINMAP_KEYPAD_COL2_CHANNEL
+#define KEYPAD_COL3_CHANNEL        PINMAP_KEYPAD_COL3_CHANNEL
+
+#else
+
+/* Rows: PC5, PC4, PC3, PC2 (as reserved in DIO_config.h) */
+#define KEYPAD_ROW0_CHANNEL        Dio_PINC_5
+#define KEYPAD_ROW1_CHANNEL        Dio_PINC_4
+#define KEYPAD_ROW2_CHANNEL        Dio_PINC_3
+#define KEYPAD_ROW3_CHANNEL        Dio_PINC_2
+
+/* Columns: PD7, PD6, PD5, PD3 (as reserved in DIO_config.h) */
+#define KEYPAD_COL0_CHANNEL        Dio_PIND_7
+#define KEYPAD_COL1_CHANNEL        Dio_PIND_6
+#define KEYPAD_COL2_CHANNEL        Dio_PIND_5
+#define KEYPAD_COL3_CHANNEL        Dio_PIND_3
+
+#endif /* DIO_PIN_MAP */
+
+/* Key map */
+#define KEYPAD_KEYS                {                          \
+                                    {'7', '8', '9', '/'},     \
+                                    {'4', '5', '6', '*'},     \
+                                    {'1', '2', '3', '-'},     \
+                                    {'C', '0', '=', '+'}      \
+                                   }
+
+/* Timing */
+#define KEYPAD_TICK_PERIOD_MS      1
+#define KEYPAD_DEBOUNCE_MS         20
+#define KEYPAD_LONG_PRESS_MS       1000
+#define KEYPAD_REPEAT_MS           200
+
+/* Event buffer */
+#define KEYPAD_EVENT_BUFFER_SIZE   16
+
+#endif /* KEYPAD_CONFIG_H_ */
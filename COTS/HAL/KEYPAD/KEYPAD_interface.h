@@ -0,0 +1,77 @@
+/*
+ * File: KEYPAD_interface.h
+ *
+ * Description:
+ *     Header file for the 4x4 KEYPAD module for AVR ATmega32.
+ *     The keypad is scanned from a periodic tick, one row per tick, without any delay
+ *     or busy-wait: the row selected at one tick is read at the next, which gives the
+ *     lines a full tick to settle. Debounced key events are pushed into a lock-free
+ *     single-producer (tick) / single-consumer (main loop) ring buffer.
+ *
+ * Usage:
+ *     KEYPAD_voidInit();
+ *     TIMER0_voidSetCallBack(KEYPAD_voidTick);     (or from the application's tick)
+ *     TIMER0_voidInitTick();
+ *     sei();
+ *     ...
+ *     Keypad_EVENT Local_Event;
+ *     while(KEYPAD_u8GetEvent(&Local_Event)) { ... }
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef KEYPAD_INTERFACE_H_
+#define KEYPAD_INTERFACE_H_
+
+/* Event Types */
+#define KEYPAD_EVENT_PRESS         0   /* Key pressed */
+#define KEYPAD_EVENT_RELEASE       1   /* Key released */
+#define KEYPAD_EVENT_LONG_PRESS    2   /* Key held for KEYPAD_LONG_PRESS_MS */
+#define KEYPAD_EVENT_REPEAT        3   /* Key still held, every KEYPAD_REPEAT_MS after the long press */
+
+/* Key Event */
+typedef struct
+{
+	u8 Key;     /* Value of the key in KEYPAD_KEYS */
+	u8 Type;    /* KEYPAD_EVENT_... */
+} Keypad_EVENT;
+
+/* Function: KEYPAD_voidInit
+ * Description:
+ *     Configures the rows as released (input, no pull-up) and the columns as inputs with
+ *     pull-up, selects the first row and clears the scanner state and the event buffer.
+ */
+void KEYPAD_voidInit(void);
+
+/* Function: KEYPAD_voidTick
+ * Description:
+ *     Reads the columns of the selected row and selects the next row. After each full scan,
+ *     debounces the matrix and pushes the resulting events. Called from a periodic
+ *     interrupt every KEYPAD_TICK_PERIOD_MS.
+ */
+void KEYPAD_voidTick(void);
+
+/* Function: KEYPAD_u8GetEvent
+ * Description:
+ *     Takes the oldest event from the buffer.
+ * Parameters:
+ *     - Copy_pEvent: Pointer receiving the event.
+ * Returns:
+ *     1 if an event was taken, 0 if the buffer is empty (or Copy_pEvent is NULL).
+ */
+u8 KEYPAD_u8GetEvent(Keypad_EVENT* Copy_pEvent);
+
+/* Function: KEYPAD_u16GetKeysState
+ * Description:
+ *     Returns the debounced state of all keys, bit (row * 4 + column) set while pressed.
+ */
+u16 KEYPAD_u16GetKeysState(void);
+
+/* Function: KEYPAD_u8GetDroppedEvents
+ * Description:
+ *     Returns the number of events lost because the buffer was full (saturates at 255).
+ */
+u8 KEYPAD_u8GetDroppedEvents(void);
+
+#endif /* KEYPAD_INTERFACE_H_ */
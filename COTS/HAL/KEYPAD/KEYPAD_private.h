@@ -0,0 +1,41 @@
+/*
+ * File: KEYPAD_private.h
+ *
+ * Description:
+ *     Private header file for the 4x4 KEYPAD module for AVR ATmega32.
+ *     Internal sizes and the conversion of the configured times into full scans.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef KEYPAD_PRIVATE_H_
+#define KEYPAD_PRIVATE_H_
+
+/* Matrix size */
+#define KEYPAD_ROWS_NUM            4
+#define KEYPAD_COLS_NUM            4
+
+/* Mask of the column bits read from the column bus */
+#define KEYPAD_COLS_MASK           ((1 << KEYPAD_COLS_NUM) - 1)
+
+/* No key held */
+#define KEYPAD_NO_KEY              0xFF
+
+/* Duration of one full scan (one row per tick) */
+#define KEYPAD_SCAN_PERIOD_MS      (KEYPAD_TICK_PERIOD_MS * KEYPAD_ROWS_NUM)
+
+/*
+ * Converts a time in ms to a number of full scans, rounded up and at least one: 0 ms
+ * would make the debounce count unreachable (no key would ever be reported).
+ */
+#define KEYPAD_MS_TO_SCANS(Ms)     (((Ms) == 0) ? 1 : (((Ms) + KEYPAD_SCAN_PERIOD_MS - 1) / KEYPAD_SCAN_PERIOD_MS))
+
+#define KEYPAD_DEBOUNCE_SCANS      KEYPAD_MS_TO_SCANS(KEYPAD_DEBOUNCE_MS)
+#define KEYPAD_LONG_PRESS_SCANS    KEYPAD_MS_TO_SCANS(KEYPAD_LONG_PRESS_MS)
+#define KEYPAD_REPEAT_SCANS        KEYPAD_MS_TO_SCANS(KEYPAD_REPEAT_MS)
+
+/* Index mask of the event ring buffer */
+#define KEYPAD_EVENT_BUFFER_MASK   (KEYPAD_EVENT_BUFFER_SIZE - 1)
+
+#endif /* KEYPAD_PRIVATE_H_ */
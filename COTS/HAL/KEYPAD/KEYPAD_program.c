@@ -0,0 +1,283 @@
+/*
+ * File: KEYPAD_program.c
+ *
+ * Description:
+ *     Implementation of the 4x4 KEYPAD module for AVR ATmega32.
+ *     Rows and columns are handled as DIO buses, so selecting a row is one masked DDR
+ *     write per port (DIO_writeBusDirection) and reading a row is one PINx read per port,
+ *     whatever the wiring.
+ *
+ *     Rows are driven open-drain: the selected row is an output low, the others are
+ *     inputs without pull-up. Two keys pressed in one column therefore never short two
+ *     driven outputs together.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../../MCAL/DIO/DIO_interface.h"
+#include "../../MCAL/DIO/DIO_private.h"
+#include "../../MCAL/DIO/DIO_config.h"
+
+/* HAL */
+#include "./KEYPAD_interface.h"
+#include "./KEYPAD_private.h"
+#include "./KEYPAD_config.h"
+
+#if (KEYPAD_EVENT_BUFFER_SIZE < 2) || (KEYPAD_EVENT_BUFFER_SIZE > 128) || (KEYPAD_EVENT_BUFFER_SIZE & KEYPAD_EVENT_BUFFER_MASK)
+#error "KEYPAD_EVENT_BUFFER_SIZE must be a power of two between 2 and 128"
+#endif
+
+#if DIO_SHADOW_MODE == DIO_SHADOW_DEFERRED
+#error "KEYPAD reads the columns right after driving a row: DIO_SHADOW_DEFERRED is not supported"
+#endif
+
+/* Private Function Prototypes */
+static void KEYPAD_voidProcessScan(u16 Copy_u16Raw);
+static void KEYPAD_voidPushEvent(u8 Copy_u8KeyIndex, u8 Copy_u8Type);
+
+static const u8 KEYPAD_Au8Keys[KEYPAD_ROWS_NUM][KEYPAD_COLS_NUM] = KEYPAD_KEYS;
+
+static Dio_BUS KEYPAD_RowsBus;
+static Dio_BUS KEYPAD_ColsBus;
+
+/* Scanner state, only touched by the tick */
+static u8  KEYPAD_u8Row;            /* Row selected at the previous tick */
+static u16 KEYPAD_u16ScanRaw;       /* Keys found down so far in the current scan */
+static u16 KEYPAD_u16LastRaw;       /* Result of the previous full scan */
+static u8  KEYPAD_u8StableScans;    /* Consecutive full scans equal to KEYPAD_u16LastRaw */
+static u8  KEYPAD_u8HeldKey;        /* Key index timed for long press / repeat */
+static u8  KEYPAD_u8LongSent;       /* Long press already reported for the held key */
+static u16 KEYPAD_u16HoldScans;     /* Full scans since the last held key event */
+
+/* Debounced state, written by the tick */
+static volatile u16 KEYPAD_u16State;
+
+/*
+ * Event ring buffer: the tick only writes KEYPAD_u8Head and the main loop only writes
+ * KEYPAD_u8Tail. Both are single bytes, so each side reads the other's index atomically
+ * and no interrupt locking is needed. One slot is kept empty to tell full from empty.
+ */
+static volatile Keypad_EVENT KEYPAD_AEventBuffer[KEYPAD_EVENT_BUFFER_SIZE];
+static volatile u8 KEYPAD_u8Head;
+static volatile u8 KEYPAD_u8Tail;
+static volatile u8 KEYPAD_u8Dropped;
+
+/*
+ * Function: KEYPAD_voidInit
+ * Description:
+ *     Builds the row and column buses, releases all rows, enables the column pull-ups,
+ *     selects row 0 and resets the scanner and the event buffer.
+ * Returns: void
+ */
+void KEYPAD_voidInit(void)
+{
+	const Dio_CHANNEL_NUM Local_ARows[KEYPAD_ROWS_NUM] =
+	{
+		KEYPAD_ROW0_CHANNEL, KEYPAD_ROW1_CHANNEL, KEYPAD_ROW2_CHANNEL, KEYPAD_ROW3_CHANNEL
+	};
+	const Dio_CHANNEL_NUM Local_ACols[KEYPAD_COLS_NUM] =
+	{
+		KEYPAD_COL0_CHANNEL, KEYPAD_COL1_CHANNEL, KEYPAD_COL2_CHANNEL, KEYPAD_COL3_CHANNEL
+	};
+
+	DIO_initBus(&KEYPAD_RowsBus, Local_ARows, KEYPAD_ROWS_NUM);
+	DIO_initBus(&KEYPAD_ColsBus, Local_ACols, KEYPAD_COLS_NUM);
+
+	/* Rows: output value low, selected through the direction only */
+	DIO_setBusDirection(&KEYPAD_RowsBus, DIO_PIN_INPUT);
+	DIO_writeBus(&KEYPAD_RowsBus, 0);
+
+	/* Columns: inputs with pull-up */
+	DIO_setBusDirection(&KEYPAD_ColsBus, DIO_PIN_INPUT);
+	DIO_writeBus(&KEYPAD_ColsBus, KEYPAD_COLS_MASK);
+
+	KEYPAD_u8Row = 0;
+	KEYPAD_u16ScanRaw = 0;
+	KEYPAD_u16LastRaw = 0;
+	KEYPAD_u8StableScans = 0;
+	KEYPAD_u8HeldKey = KEYPAD_NO_KEY;
+	KEYPAD_u8LongSent = 0;
+	KEYPAD_u16HoldScans = 0;
+	KEYPAD_u16State = 0;
+	KEYPAD_u8Head = 0;
+	KEYPAD_u8Tail = 0;
+	KEYPAD_u8Dropped = 0;
+
+	DIO_writeBusDirection(&KEYPAD_RowsBus, 1 << KEYPAD_u8Row);
+}
+
+/*
+ * Function: KEYPAD_voidTick
+ * Description:
+ *     Reads the columns of the row selected at the previous tick (a pressed key reads
+ *     low), then selects the next row so it settles until the next tick.
+ * Returns: void
+ */
+void KEYPAD_voidTick(void)
+{
+	u8 Local_u8Cols;
+
+	DIO_readBus(&KEYPAD_ColsBus, &Local_u8Cols);
+	KEYPAD_u16ScanRaw |= (u16)(~Local_u8Cols & KEYPAD_COLS_MASK) << (KEYPAD_u8Row * KEYPAD_COLS_NUM);
+
+	KEYPAD_u8Row++;
+	if(KEYPAD_u8Row == KEYPAD_ROWS_NUM)
+	{
+		KEYPAD_u8Row = 0;
+		KEYPAD_voidProcessScan(KEYPAD_u16ScanRaw);
+		KEYPAD_u16ScanRaw = 0;
+	}
+
+	DIO_writeBusDirection(&KEYPAD_RowsBus, 1 << KEYPAD_u8Row);
+}
+
+/*
+ * Function: KEYPAD_u8GetEvent
+ * Description:
+ *     Consumer side of the ring buffer: copies the event at the tail, then publishes the
+ *     new tail so the slot is only reused after it has been read.
+ * Returns: 1 if an event was taken, 0 otherwise.
+ */
+u8 KEYPAD_u8GetEvent(Keypad_EVENT* Copy_pEvent)
+{
+	u8 Local_u8Tail = KEYPAD_u8Tail;
+
+	if((Copy_pEvent == NULL) || (Local_u8Tail == KEYPAD_u8Head))
+	{
+		return 0;
+	}
+
+	Copy_pEvent->Key = KEYPAD_AEventBuffer[Local_u8Tail].Key;
+	Copy_pEvent->Type = KEYPAD_AEventBuffer[Local_u8Tail].Type;
+	KEYPAD_u8Tail = (Local_u8Tail + 1) & KEYPAD_EVENT_BUFFER_MASK;
+
+	return 1;
+}
+
+/*
+ * Function: KEYPAD_u16GetKeysState
+ * Description:
+ *     Returns the debounced key bitmap. The 16-bit value is read until two reads agree,
+ *     so a tick updating it between the two byte reads is not seen as a torn value.
+ */
+u16 KEYPAD_u16GetKeysState(void)
+{
+	u16 Local_u16State;
+
+	do
+	{
+		Local_u16State = KEYPAD_u16State;
+	} while(Local_u16State != KEYPAD_u16State);
+
+	return Local_u16State;
+}
+
+/*
+ * Function: KEYPAD_u8GetDroppedEvents
+ * Description:
+ *     Returns the number of events dropped on a full buffer.
+ */
+u8 KEYPAD_u8GetDroppedEvents(void)
+{
+	return KEYPAD_u8Dropped;
+}
+
+/*
+ * Function: KEYPAD_voidProcessScan
+ * Description:
+ *     Debounces a full scan: once the matrix has read the same for KEYPAD_DEBOUNCE_SCANS
+ *     scans, the keys that differ from the debounced state produce press/release events.
+ *     Then times the last pressed key for the long-press and repeat events.
+ */
+static void KEYPAD_voidProcessScan(u16 Copy_u16Raw)
+{
+	if(Copy_u16Raw != KEYPAD_u16LastRaw)
+	{
+		KEYPAD_u16LastRaw = Copy_u16Raw;
+		KEYPAD_u8StableScans = 0;
+	}
+	else if(KEYPAD_u8StableScans < KEYPAD_DEBOUNCE_SCANS)
+	{
+		KEYPAD_u8StableScans++;
+
+		if(KEYPAD_u8StableScans == KEYPAD_DEBOUNCE_SCANS)
+		{
+			u16 Local_u16State = KEYPAD_u16State;
+			u16 Local_u16Changed = Copy_u16Raw ^ Local_u16State;
+			u8 Local_u8KeyIndex;
+
+			for(Local_u8KeyIndex = 0; Local_u16Changed != 0; Local_u8KeyIndex++, Local_u16Changed >>= 1)
+			{
+				if(Local_u16Changed & 1)
+				{
+					if(GET_BIT(Copy_u16Raw, Local_u8KeyIndex))
+					{
+						KEYPAD_voidPushEvent(Local_u8KeyIndex, KEYPAD_EVENT_PRESS);
+						KEYPAD_u8HeldKey = Local_u8KeyIndex;
+						KEYPAD_u8LongSent = 0;
+						KEYPAD_u16HoldScans = 0;
+					}
+					else
+					{
+						KEYPAD_voidPushEvent(Local_u8KeyIndex, KEYPAD_EVENT_RELEASE);
+						if(Local_u8KeyIndex == KEYPAD_u8HeldKey)
+						{
+							KEYPAD_u8HeldKey = KEYPAD_NO_KEY;
+						}
+					}
+				}
+			}
+
+			KEYPAD_u16State = Copy_u16Raw;
+		}
+	}
+
+	/* Long press and auto-repeat of the held key */
+	if(KEYPAD_u8HeldKey != KEYPAD_NO_KEY)
+	{
+		KEYPAD_u16HoldScans++;
+
+		if((KEYPAD_u8LongSent == 0) && (KEYPAD_u16HoldScans >= KEYPAD_LONG_PRESS_SCANS))
+		{
+			KEYPAD_voidPushEvent(KEYPAD_u8HeldKey, KEYPAD_EVENT_LONG_PRESS);
+			KEYPAD_u8LongSent = 1;
+			KEYPAD_u16HoldScans = 0;
+		}
+		else if((KEYPAD_u8LongSent != 0) && (KEYPAD_u16HoldScans >= KEYPAD_REPEAT_SCANS))
+		{
+			KEYPAD_voidPushEvent(KEYPAD_u8HeldKey, KEYPAD_EVENT_REPEAT);
+			KEYPAD_u16HoldScans = 0;
+		}
+	}
+}
+
+/*
+ * Function: KEYPAD_voidPushEvent
+ * Description:
+ *     Producer side of the ring buffer: fills the slot at the head, then publishes the
+ *     new head. On a full buffer the event is dropped and counted.
+ */
+static void KEYPAD_voidPushEvent(u8 Copy_u8KeyIndex, u8 Copy_u8Type)
+{
+	u8 Local_u8Head = KEYPAD_u8Head;
+	u8 Local_u8Next = (Local_u8Head + 1) & KEYPAD_EVENT_BUFFER_MASK;
+
+	if(Local_u8Next == KEYPAD_u8Tail)
+	{
+		if(KEYPAD_u8Dropped != 0xFF)
+		{
+			KEYPAD_u8Dropped++;
+		}
+		return;
+	}
+
+	KEYPAD_AEventBuffer[Local_u8Head].Key = KEYPAD_Au8Keys[Copy_u8KeyIndex / KEYPAD_COLS_NUM][Copy_u8KeyIndex % KEYPAD_COLS_NUM];
+	KEYPAD_AEventBuffer[Local_u8Head].Type = Copy_u8Type;
+	KEYPAD_u8Head = Local_u8Next;
+}
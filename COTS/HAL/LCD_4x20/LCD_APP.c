@@ -12,10 +12,12 @@
  */
 
 #include <util/delay.h>
+#include <avr/interrupt.h>
 #include "../../UTIL_LIB/STD_TYPES.h"
 #include "../../UTIL_LIB/BIT_MATH.h"
 #include "../../MCAL/DIO/DIO_interface.h"
-#include "../LCD/LCD_interface.h"
+#include "../../MCAL/TIMER/TIMER_interface.h"
+#include "./LCD_interface.h"
 
 // Define F_CPU for delay calculations (if not defined globally)
 #define F_CPU 16000000UL
@@ -23,7 +25,20 @@
 // Custom character patterns for testing
 u8 LCD_Char_Pattern1[] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
 
+// Set from the LCD tick once the queued text is on the display
+volatile u8 LCD_u8TextShown = 0;
+
+void LCD_voidTextShown(void)
+{
+    LCD_u8TextShown = 1;
+}
+
 int main(void) {
+    // The tick sends the queued bytes when LCD_ASYNC is enabled (LCD_config.h)
+    TIMER0_voidSetCallBack(LCD_voidTick);
+    TIMER0_voidInitTick();
+    sei();
+
     // Initialize the LCD in 4-bit mode
     LCD_voidInit();
 
@@ -133,6 +148,36 @@ int main(void) {
     LCD_voidClear();
     _delay_ms(500);
 
+    // Test Case 14: Framebuffer - only the changed cells are sent by each flush
+    LCD_voidBufferGoTo(LCD_LINE_ONE, 0);
+    LCD_voidBufferWriteString((u8*)"Count:");
+    for (u8 Local_u8Count = 0; Local_u8Count < 100; Local_u8Count++)
+    {
+        LCD_voidBufferGoTo(LCD_LINE_ONE, 7);
+        LCD_voidBufferWriteNumber(Local_u8Count);
+        LCD_u8Flush();              // 2 bytes while one digit changes
+        _delay_ms(100);
+    }
+    LCD_voidBufferClear();
+    LCD_u8Flush();
+    _delay_ms(500);
+
+    // Test Case 15: Completion notification and flush-and-wait
+    LCD_voidSetCallBack(LCD_voidTextShown);
+    LCD_voidGoTo(LCD_LINE_TWO, 0);
+    LCD_voidWriteString((u8*)"Queued text");
+    while (!LCD_u8TextShown)
+    {
+        // Free for other work while the text goes out (LCD_ASYNC)
+    }
+    LCD_voidSetCallBack(NULL);
+    LCD_voidGoTo(LCD_LINE_THREE, 0);
+    LCD_voidWriteString((u8*)"Flushed");
+    LCD_voidWaitIdle();     // On the display when this returns
+    _delay_ms(1000);
+    LCD_voidClear();
+    _delay_ms(500);
+
     /* More test cases can be added here as needed */
 
 //    while(1) {
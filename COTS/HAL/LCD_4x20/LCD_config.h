@@ -4,10 +4,12 @@
  * Description:
  *     Configuration header file for the LCD (Liquid Crystal Display) driver.
  *     This file contains the pin configuration macros for interfacing with
- *     the LCD in 4-bit mode. It defines the ports and pins used for the
- *     control lines (RS, E) and the data lines (D4, D5, D6, D7) of the LCD.
+ *     the LCD in 4-bit or 8-bit mode. It defines the ports and pins used for the
+ *     control lines (RS, E, optional R/W) and the data lines (D0..D7) of the LCD.
  *     The configuration is essential for the proper operation of the LCD
  *     with the AVR ATmega32 microcontroller.
+ *     With DIO_PIN_MAP_GENERATED (DIO_config.h) the build fails unless the pins in use
+ *     match the LCD lines of the board pin map (PINMAP/pinmap.txt; D0..D3 need -D LCD_8_BIT).
  *
  * Author: [Your Name]
  * Date: [Date of Creation or Modification]
@@ -36,6 +38,39 @@
 #define LCD_E_PORT            DIO_PORTA  // Port for Enable
 #define LCD_E_PIN             DIO_PIN2   // Pin for Enable
 
+/* Macros For Read/Write (R/W) Configuration */
+/*
+ * R/W Pin Configuration:
+ *   LCD_RW_WIRED selects how the driver waits for the controller:
+ *     LCD_ENABLED  : R/W is connected to LCD_RW_PORT/LCD_RW_PIN. Before each transfer the
+ *                    driver reads the busy flag (D7) and waits only while the controller
+ *                    is busy, typically 37 us after a character.
+ *     LCD_DISABLED : R/W is tied to ground. The driver waits the datasheet execution
+ *                    time of each instruction after sending it (37 us, 1.52 ms for
+ *                    clear and return home).
+ *   LCD_BUSY_TIMEOUT_US bounds the wait for the busy flag (at least that long), so a
+ *   missing or unpowered display does not block the program.
+ *   With LCD_ASYNC the busy flag is not read: LCD_voidTick sends the bytes from the tick
+ *   interrupt and paces them with the execution times, so R/W only needs to stay low.
+ */
+#define LCD_RW_WIRED          LCD_DISABLED
+#define LCD_RW_PORT           DIO_PORTB  // Port for R/W
+#define LCD_RW_PIN            DIO_PIN3   // Pin for R/W
+#define LCD_BUSY_TIMEOUT_US   2000
+
+/* Macro For Data Bus Width Configuration */
+/*
+ * Interface Mode:
+ *   LCD_4_BIT_MODE : only D4..D7 are wired; every byte is sent as two nibbles, each
+ *                    latched by its own enable pulse.
+ *   LCD_8_BIT_MODE : D0..D7 are wired; every byte is sent in one transfer with one
+ *                    enable pulse. With the eight data lines on one port the byte is a
+ *                    single port write.
+ *   LCD_voidInit selects the matching interface with its first function set.
+ *   LCD_8_BIT_MODE is not available with LCD_SHARED_BUS (the arbiter sends nibbles).
+ */
+#define LCD_MODE              LCD_4_BIT_MODE
+
 /* Macros For 4-Bit Mode Data Lines Configuration */
 /*
  * Configuration for the data pins in 4-bit mode:
@@ -55,4 +90,52 @@
 #define LCD_D7_PIN            DIO_PIN4   // Pin for Data 7
 #define LCD_D7_PORT           DIO_PORTB  // Port for Data 7
 
+/* Macros For 8-Bit Mode Low Data Lines Configuration */
+/*
+ * Additional data pins in 8-bit mode (D0, D1, D2, D3), not used in 4-bit mode.
+ * They are not wired on the kit, which runs the LCD in 4-bit mode.
+ */
+#define LCD_D0_PIN            DIO_PIN0   // Pin for Data 0
+#define LCD_D0_PORT           DIO_PORTC  // Port for Data 0
+
+#define LCD_D1_PIN            DIO_PIN1   // Pin for Data 1
+#define LCD_D1_PORT           DIO_PORTC  // Port for Data 1
+
+#define LCD_D2_PIN            DIO_PIN2   // Pin for Data 2
+#define LCD_D2_PORT           DIO_PORTC  // Port for Data 2
+
+#define LCD_D3_PIN            DIO_PIN3   // Pin for Data 3
+#define LCD_D3_PORT           DIO_PORTC  // Port for Data 3
+
+/* Macro For Shared Bus Configuration */
+/*
+ * Shared Bus:
+ *   LCD_ENABLED when the LCD pins are shared with the seven-segment display (the kit
+ *   wiring above): the LCD bytes are queued to the BUS_ARB module, which sends them in
+ *   its LCD slots, and the pins are never driven by this driver. BUS_ARB_voidInit and
+ *   its tick must be running. LCD_DISABLED drives the pins directly.
+ *   The arbiter changes RS while E is high, outside the HD44780 timing: enable it only
+ *   with a display module checked on the kit (see BUS_ARB_interface.h).
+ */
+#define LCD_SHARED_BUS        LCD_DISABLED
+
+/* Macros For Transmit Mode Configuration */
+/*
+ * Transmit Mode:
+ *   LCD_ASYNC selects when the bytes of an LCD call reach the display:
+ *     LCD_DISABLED : each call sends its bytes and waits for the controller before
+ *                    returning.
+ *     LCD_ENABLED  : each call only queues its bytes and returns. LCD_voidTick, called
+ *                    from the Timer0 tick, sends one byte per tick and then skips the
+ *                    ticks the controller needs to execute it (1.52 ms for clear and
+ *                    return home), so the CPU is never held by the display. A call waits
+ *                    only while the queue is full. LCD_voidWaitIdle and the
+ *                    LCD_voidSetCallBack notification tell when the queue has drained.
+ *   LCD_QUEUE_SIZE is the number of queued bytes (power of two up to 128); a full
+ *   20-character line plus its address command fits in 32. Not available with
+ *   LCD_SHARED_BUS, where BUS_ARB already queues the bytes.
+ */
+#define LCD_ASYNC             LCD_DISABLED
+#define LCD_QUEUE_SIZE        32
+
 #endif /* LCD_CONFIG_H_ */
@@ -43,6 +43,34 @@ void LCD_voidWriteHex(u8 copy_u8Data);
 void LCD_voidGoTo(u8 copy_u8Line, u8 copy_u8Cell);
 void LCD_voidGoToClear(u8 copy_u8Line, u8 copy_u8Cell, u8 copy_u8NumOfCells);
 
+/*	Framebuffer APIs	*/
+/*
+ * An 80-cell RAM copy of the display. The LCD_voidBuffer... functions only write the
+ * copy and mark the cells that changed; LCD_u8Flush sends the changed cells with as few
+ * DDRAM address commands as possible and returns the number of bytes it sent (commands
+ * and characters). The buffer starts blank at LCD_voidInit.
+ */
+void LCD_voidBufferGoTo(u8 copy_u8Line, u8 copy_u8Cell);
+void LCD_voidBufferWriteChar(u8 copy_u8Data);
+void LCD_voidBufferWriteString(u8* copy_pu8String);
+void LCD_voidBufferWriteNumber(s32 copy_s32Data);
+void LCD_voidBufferClear(void);
+u8   LCD_u8Flush(void);
+
+/*	Transmit Queue APIs	*/
+/*
+ * With LCD_ASYNC enabled (LCD_config.h) the APIs above only queue their bytes and return;
+ * LCD_voidTick sends them, one per Timer0 tick, at the pace the controller needs. Call it
+ * from the tick callback (with other tick users, from one callback that calls each); the
+ * commands of LCD_voidInit are queued the same way. Completion is reported by the LCD_voidSetCallBack
+ * function (interrupt context) or waited for with LCD_voidWaitIdle. The calls block only
+ * while the queue is full, so they must not be made from an ISR. Without LCD_ASYNC the
+ * calls return with their bytes sent and the callback comes at the next tick.
+ */
+void LCD_voidTick(void);
+void LCD_voidSetCallBack(void (*copy_pvCallBack)(void));
+void LCD_voidWaitIdle(void);
+
 /*	CGRAM API	*/
 void LCD_voidCreateCharacter(u8 *copy_Pu8CharArr, u8 copy_u8Location);
 
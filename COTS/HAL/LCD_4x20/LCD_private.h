@@ -17,26 +17,108 @@
 #ifndef LCD_PRIVATE_H_
 #define LCD_PRIVATE_H_
 
-/* Function Prototypes */
+/* Options (LCD_config.h) */
+#define LCD_DISABLED              0
+#define LCD_ENABLED               1
+
+#define LCD_4_BIT_MODE            4
+#define LCD_8_BIT_MODE            8
 
 /*
- * Function: private_voidWriteHalfPort
- * -----------------------------------
- * Writes a 4-bit value to the LCD data lines.
- *
- * This static function is used internally within the LCD driver to send
- * half of a byte (4 bits) to the LCD in 4-bit mode operation. It directly
- * manipulates the data lines of the LCD connected to the microcontroller.
- * This function is marked static to limit its scope to this source file,
- * ensuring that it is not callable from outside the LCD module.
- *
- * Parameters:
- *   copy_u8Value - An 8-bit unsigned integer where only the lower 4 bits
- *                  are relevant and will be sent to the LCD data lines.
- *
- * Returns:
- *   void - This function does not return a value.
+ * Data Lines Port Mapping:
+ *   When the data lines of the mode (D4..D7, or D0..D7 in 8-bit mode) are wired to the
+ *   same port, a transfer is written with one masked port write. LCD_DATA_PINS_MASK
+ *   selects the data pins within that port and LCD_DATA_TO_PORT places the bits of a
+ *   nibble (4-bit mode) or byte (8-bit mode) on their configured pins.
  */
-static void private_voidWriteHalfPort(u8 copy_u8Value);
+#define LCD_DATA_HIGH_ONE_PORT    ((LCD_D4_PORT == LCD_D5_PORT) && (LCD_D4_PORT == LCD_D6_PORT) && (LCD_D4_PORT == LCD_D7_PORT))
+#define LCD_DATA_LOW_ONE_PORT     ((LCD_D0_PORT == LCD_D4_PORT) && (LCD_D1_PORT == LCD_D4_PORT) && \
+                                   (LCD_D2_PORT == LCD_D4_PORT) && (LCD_D3_PORT == LCD_D4_PORT))
+#define LCD_DATA_ONE_PORT         (LCD_DATA_HIGH_ONE_PORT && ((LCD_MODE == LCD_4_BIT_MODE) || LCD_DATA_LOW_ONE_PORT))
+
+#define LCD_DATA_HIGH_PINS_MASK   ((1 << LCD_D4_PIN) | (1 << LCD_D5_PIN) | (1 << LCD_D6_PIN) | (1 << LCD_D7_PIN))
+#define LCD_DATA_LOW_PINS_MASK    ((1 << LCD_D0_PIN) | (1 << LCD_D1_PIN) | (1 << LCD_D2_PIN) | (1 << LCD_D3_PIN))
+#define LCD_DATA_PINS_MASK        ((LCD_MODE == LCD_8_BIT_MODE) ? (LCD_DATA_LOW_PINS_MASK | LCD_DATA_HIGH_PINS_MASK) : LCD_DATA_HIGH_PINS_MASK)
+
+#define LCD_NIBBLE_TO_PORT(Nibble) ((GET_BIT((Nibble), 0) << LCD_D4_PIN) | \
+                                    (GET_BIT((Nibble), 1) << LCD_D5_PIN) | \
+                                    (GET_BIT((Nibble), 2) << LCD_D6_PIN) | \
+                                    (GET_BIT((Nibble), 3) << LCD_D7_PIN))
+
+#define LCD_BYTE_TO_PORT(Byte)     ((GET_BIT((Byte), 0) << LCD_D0_PIN) | \
+                                    (GET_BIT((Byte), 1) << LCD_D1_PIN) | \
+                                    (GET_BIT((Byte), 2) << LCD_D2_PIN) | \
+                                    (GET_BIT((Byte), 3) << LCD_D3_PIN) | \
+                                    LCD_NIBBLE_TO_PORT((Byte) >> 4))
+
+#define LCD_DATA_TO_PORT(Value)    ((LCD_MODE == LCD_8_BIT_MODE) ? LCD_BYTE_TO_PORT(Value) : LCD_NIBBLE_TO_PORT(Value))
+
+/* Width of the data bus in bits (DIO bus when the data lines span several ports) */
+#define LCD_DATA_WIDTH            LCD_MODE
+
+/*
+ * Function Set sent by LCD_voidInit: interface width (DL), 2 lines, 5x8 font.
+ * In 4-bit mode the first transfer carries only the upper nibble, which switches the
+ * controller (still in 8-bit mode after power-on) to 4-bit mode.
+ */
+#define LCD_FUNCTION_SET_4_BIT    0b00101000
+#define LCD_FUNCTION_SET_8_BIT    0b00111000
+#define LCD_FUNCTION_SET          ((LCD_MODE == LCD_8_BIT_MODE) ? LCD_FUNCTION_SET_8_BIT : LCD_FUNCTION_SET_4_BIT)
+
+/*
+ * Timing (HD44780U datasheet, 270 kHz oscillator):
+ *   LCD_E_PULSE_US - Enable high time PW_EH, 450 ns; also covers the 360 ns data delay
+ *                    of a busy flag read. _delay_us rounds it up to whole CPU cycles.
+ *   LCD_E_CYCLE_US - Enable cycle time tcycE, 1000 ns; paces the 8-bit busy flag polls.
+ *   LCD_EXEC_..._US - Execution time of each instruction class. An instruction's class
+ *                    is the position of its highest set bit; data writes are a class of
+ *                    their own. The times are turned into _delay_loop_2 counts (4 cycles
+ *                    per count) from F_CPU at compile time by LCD_US_TO_LOOPS.
+ */
+#define LCD_E_PULSE_US                0.45
+#define LCD_E_CYCLE_US                1.0
+
+#define LCD_EXEC_CLEAR_US             1520
+#define LCD_EXEC_HOME_US              1520
+#define LCD_EXEC_ENTRY_MODE_US        37
+#define LCD_EXEC_DISPLAY_CONTROL_US   37
+#define LCD_EXEC_SHIFT_US             37
+#define LCD_EXEC_FUNCTION_SET_US      37
+#define LCD_EXEC_CGRAM_ADDRESS_US     37
+#define LCD_EXEC_DDRAM_ADDRESS_US     37
+#define LCD_EXEC_WRITE_DATA_US        37
+
+/* Instruction classes: 0..7 = highest set bit of the instruction, then data */
+#define LCD_CLASS_CLEAR               0
+#define LCD_CLASS_FUNCTION_SET        5
+#define LCD_CLASS_WRITE_DATA          8
+#define LCD_CLASS_NUM                 9
+
+#define LCD_US_TO_LOOPS(Us)           ((u16)((((F_CPU / 1000UL) * (Us)) / 1000UL + 3UL) / 4UL))
+
+/*
+ * Transmit Queue (LCD_ASYNC):
+ *   LCD_US_TO_TICKS gives the ticks to skip after a byte of the given execution time.
+ *   The next byte goes out (skipped ticks + 1) tick periods later, which is always more
+ *   than the execution time.
+ */
+#define LCD_US_TO_TICKS(Us)           ((u8)((Us) / TIMER0_TICK_PERIOD_US))
+
+/*
+ * Framebuffer Layout:
+ *   The 80 cells are stored in DDRAM address order, which is also the order the
+ *   controller's auto-increment follows: line 1 (0x00), line 3 (0x14), line 2 (0x40),
+ *   line 4 (0x54), and back to line 1 after the last cell. Index 0..39 is DDRAM
+ *   address 0x00..0x27 and index 40..79 is 0x40..0x67.
+ *   LCD_BUFFER_MAX_GAP: clean cells between two changed ones that the flush sends
+ *   again instead of a DDRAM address command (one byte either way at 1 cell).
+ */
+#define LCD_BUFFER_SIZE               80
+#define LCD_BUFFER_LINE_SIZE          20
+#define LCD_BUFFER_HALF               40
+#define LCD_BUFFER_MAX_GAP            1
+#define LCD_ADDRESS_UNKNOWN           0xFF
+
+#define LCD_BUFFER_INDEX_TO_DDRAM(Index)  ((Index) < LCD_BUFFER_HALF ? (Index) : (Index) + (0x40 - LCD_BUFFER_HALF))
 
 #endif /* LCD_PRIVATE_H_ */
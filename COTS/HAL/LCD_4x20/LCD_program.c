@@ -4,11 +4,11 @@
  * Description:
  *     This file contains the implementation of functions for interfacing with an LCD display
  *     using the AVR ATmega32 microcontroller. It provides functionality for initializing the
- *     LCD in 4-bit mode, writing characters and strings to the display, and controlling the
+ *     LCD in 4-bit or 8-bit mode, writing characters and strings to the display, and controlling the
  *     display properties such as cursor position and display shift. The implementation is
  *     based on the HD44780 LCD controller, commonly used in alphanumeric LCDs. This driver
  *     supports various LCD operations including displaying numbers, strings, custom characters,
- *     and handling the LCD in 4-bit communication mode.
+ *     and handling the LCD in 4-bit or 8-bit communication mode.
  *
  *     The functions in this file are designed to abstract the lower-level details of interfacing
  *     with the LCD, providing a simple and intuitive API for displaying data. This includes
@@ -19,12 +19,13 @@
  * Date: [Creation or Last Modification Date]
  *
  * Notes:
- *     - The LCD is assumed to be connected in a 4-bit mode.
+ *     - The LCD is connected in 4-bit or 8-bit mode (LCD_MODE in LCD_config.h).
  *     - This driver is designed to be modular and easily portable.
  *     - The file relies on the DIO driver for AVR ATmega32 for low-level pin control.
  */
 
 #include <util/delay.h> 
+#include <util/delay_basic.h>
 
 /* UTILES_LIB */
 #include "../../UTIL_LIB/STD_TYPES.h"
@@ -33,20 +34,148 @@
 /* MCAL */
 #include "../../MCAL/DIO/DIO_interface.h"
 #include "../../MCAL/DIO/DIO_private.h"
+#include "../../MCAL/DIO/DIO_config.h"
 
 /* HAL */
-#include "../LCD/LCD_interface.h"
+#include "./LCD_interface.h"
+#include "./LCD_config.h"
 #include "./LCD_private.h"
-#include "../LCD/LCD_config.h"
+
+#if (LCD_SHARED_BUS == LCD_ENABLED) && (LCD_RW_WIRED == LCD_ENABLED)
+#error "LCD_RW_WIRED is not supported with LCD_SHARED_BUS: the arbiter writes the LCD pins only"
+#endif
+
+#if (LCD_SHARED_BUS == LCD_ENABLED) && (LCD_MODE == LCD_8_BIT_MODE)
+#error "LCD_8_BIT_MODE is not supported with LCD_SHARED_BUS: the arbiter sends nibbles on D4..D7"
+#endif
+
+#if (LCD_SHARED_BUS == LCD_ENABLED) && (LCD_ASYNC == LCD_ENABLED)
+#error "LCD_ASYNC is not supported with LCD_SHARED_BUS: BUS_ARB already queues the LCD bytes"
+#endif
+
+#if DIO_SHADOW_MODE == DIO_SHADOW_DEFERRED
+#error "LCD needs its E strobe on the pin at once: DIO_SHADOW_DEFERRED is not supported"
+#endif
+
+/* With the generated pin map, the pins of LCD_config.h must be the ones of PINMAP/pinmap.txt */
+#if DIO_PIN_MAP == DIO_PIN_MAP_GENERATED
+#if (DIO_PIN_ID(LCD_RS_PORT, LCD_RS_PIN) != PINMAP_LCD_RS_ID) || (DIO_PIN_ID(LCD_E_PORT, LCD_E_PIN) != PINMAP_LCD_E_ID)
+#error "LCD: RS/E do not match the pin map"
+#endif
+
+#if (LCD_RW_WIRED == LCD_ENABLED) && (DIO_PIN_ID(LCD_RW_PORT, LCD_RW_PIN) != PINMAP_LCD_RW_ID)
+#error "LCD: R/W does not match the pin map"
+#endif
+
+#if (DIO_PIN_ID(LCD_D4_PORT, LCD_D4_PIN) != PINMAP_LCD_D4_ID) || (DIO_PIN_ID(LCD_D5_PORT, LCD_D5_PIN) != PINMAP_LCD_D5_ID) || \
+    (DIO_PIN_ID(LCD_D6_PORT, LCD_D6_PIN) != PINMAP_LCD_D6_ID) || (DIO_PIN_ID(LCD_D7_PORT, LCD_D7_PIN) != PINMAP_LCD_D7_ID)
+#error "LCD: D4..D7 do not match the pin map"
+#endif
+
+#if (LCD_MODE == LCD_8_BIT_MODE) && \
+    ((DIO_PIN_ID(LCD_D0_PORT, LCD_D0_PIN) != PINMAP_LCD_D0_ID) || (DIO_PIN_ID(LCD_D1_PORT, LCD_D1_PIN) != PINMAP_LCD_D1_ID) || \
+     (DIO_PIN_ID(LCD_D2_PORT, LCD_D2_PIN) != PINMAP_LCD_D2_ID) || (DIO_PIN_ID(LCD_D3_PORT, LCD_D3_PIN) != PINMAP_LCD_D3_ID))
+#error "LCD: D0..D3 do not match the pin map (generated with -D LCD_8_BIT?)"
+#endif
+#endif /* DIO_PIN_MAP */
+
+#if LCD_SHARED_BUS == LCD_ENABLED
+/* Pins shared with the seven-segment display: transfers go through the arbiter */
+#include "../BUS_ARB/BUS_ARB_interface.h"
+#elif !LCD_DATA_ONE_PORT
+/* Data lines spread over several ports: D4..D7 (D0..D7 in 8-bit mode) are driven as a DIO bus */
+static Dio_BUS LCD_DataBus;
+#endif
+
+/* Framebuffer in DDRAM address order (see LCD_private.h) and its changed cells, one bit each */
+static u8 LCD_Au8Buffer[LCD_BUFFER_SIZE];
+static u8 LCD_Au8BufferDirty[LCD_BUFFER_SIZE / 8];
+static u8 LCD_u8BufferCursor;
+
+/* Buffer index of the first cell of each line */
+static const u8 LCD_Au8BufferLine[4] = {0, 2 * LCD_BUFFER_LINE_SIZE, LCD_BUFFER_LINE_SIZE, 3 * LCD_BUFFER_LINE_SIZE};
+
+/* Controller address counter as a buffer index, LCD_ADDRESS_UNKNOWN when not known */
+static u8 LCD_u8Address = LCD_ADDRESS_UNKNOWN;
+
+#if LCD_ASYNC == LCD_ENABLED
+#include "../../MCAL/TIMER/TIMER_config.h"
+
+#if (LCD_QUEUE_SIZE & (LCD_QUEUE_SIZE - 1)) || (LCD_QUEUE_SIZE > 128)
+#error "LCD_QUEUE_SIZE must be a power of two up to 128"
+#endif
+
+#if (LCD_EXEC_CLEAR_US / TIMER0_TICK_PERIOD_US) > 255
+#error "LCD_ASYNC: the tick period is too short to count the clear display time in a u8"
+#endif
+
+/* Transmit queue: written by LCD_voidSendCmnd/LCD_voidSendChar, read by LCD_voidTick */
+static volatile u8 LCD_Au8QueueRs[LCD_QUEUE_SIZE];
+static volatile u8 LCD_Au8QueueByte[LCD_QUEUE_SIZE];
+static volatile u8 LCD_u8QueueHead = 0;
+static volatile u8 LCD_u8QueueTail = 0;
+
+/* Ticks to skip while the controller executes the last byte */
+static u8 LCD_u8WaitTicks = 0;
+
+/* Execution time of each instruction class, in ticks to skip */
+static const u8 LCD_Au8ExecTicks[LCD_CLASS_NUM] =
+{
+    LCD_US_TO_TICKS(LCD_EXEC_CLEAR_US),
+    LCD_US_TO_TICKS(LCD_EXEC_HOME_US),
+    LCD_US_TO_TICKS(LCD_EXEC_ENTRY_MODE_US),
+    LCD_US_TO_TICKS(LCD_EXEC_DISPLAY_CONTROL_US),
+    LCD_US_TO_TICKS(LCD_EXEC_SHIFT_US),
+    LCD_US_TO_TICKS(LCD_EXEC_FUNCTION_SET_US),
+    LCD_US_TO_TICKS(LCD_EXEC_CGRAM_ADDRESS_US),
+    LCD_US_TO_TICKS(LCD_EXEC_DDRAM_ADDRESS_US),
+    LCD_US_TO_TICKS(LCD_EXEC_WRITE_DATA_US)
+};
+#endif
+
+#if LCD_SHARED_BUS == LCD_DISABLED
+/* Bytes put since the last notification; cleared by the tick once they are executed */
+static volatile u8 LCD_u8Pending = 0;
+
+static void (*LCD_pvCallBack)(void) = NULL;
+#endif
+
+#if LCD_SHARED_BUS == LCD_DISABLED
+/* Execution time of each instruction class, in _delay_loop_2 counts for this F_CPU */
+static const u16 LCD_Au16ExecLoops[LCD_CLASS_NUM] =
+{
+    LCD_US_TO_LOOPS(LCD_EXEC_CLEAR_US),
+    LCD_US_TO_LOOPS(LCD_EXEC_HOME_US),
+    LCD_US_TO_LOOPS(LCD_EXEC_ENTRY_MODE_US),
+    LCD_US_TO_LOOPS(LCD_EXEC_DISPLAY_CONTROL_US),
+    LCD_US_TO_LOOPS(LCD_EXEC_SHIFT_US),
+    LCD_US_TO_LOOPS(LCD_EXEC_FUNCTION_SET_US),
+    LCD_US_TO_LOOPS(LCD_EXEC_CGRAM_ADDRESS_US),
+    LCD_US_TO_LOOPS(LCD_EXEC_DDRAM_ADDRESS_US),
+    LCD_US_TO_LOOPS(LCD_EXEC_WRITE_DATA_US)
+};
+#endif
+
+/* Private Functions (described at their definitions) */
+#if LCD_SHARED_BUS == LCD_DISABLED
+static void private_voidWriteDataPort(u8 copy_u8Value);
+static void private_voidSendByte(u8 copy_u8Rs, u8 copy_u8Byte);
+static void private_voidPulseEnable(void);
+#if LCD_ASYNC == LCD_DISABLED
+static void private_voidWaitReady(void);
+#endif
+#endif
+static void private_voidPutByte(u8 copy_u8Rs, u8 copy_u8Byte);
+static void private_voidTrackAddress(u8 copy_u8Rs, u8 copy_u8Byte);
 
 /*
  * Function: LCD_voidInit
  * ----------------------
- * Initializes the LCD display for use in a 4-bit operation mode.
+ * Initializes the LCD display for use in 4-bit or 8-bit operation mode.
  *
  * This function performs the necessary startup sequence to prepare
  * the LCD for receiving commands and data. It sets up the LCD for
- * 4-bit mode operation, configures the display characteristics such
+ * the interface width selected by LCD_MODE, configures the display characteristics such
  * as display on/off, cursor visibility, and blinking. It also sets
  * the LCD entry mode for cursor movement and display shifting.
  *
@@ -58,6 +187,16 @@
  */
 void LCD_voidInit(void)
 {
+#if LCD_SHARED_BUS == LCD_ENABLED
+    // Pins owned by the arbiter: wait for the power, then queue the 4-bit mode nibble
+    _delay_ms(35);
+    BUS_ARB_voidLcdWrite(BUS_ARB_LCD_NIBBLE, 0b0010);
+#else
+    // RS low (instruction) and E low before they become outputs: the pin map idles them
+    // high, as the seven-segment COM lines they share on the kit
+    DIO_setPinValue(LCD_RS_PORT, LCD_RS_PIN, DIO_PIN_LOW);
+    DIO_setPinValue(LCD_E_PORT, LCD_E_PIN, DIO_PIN_LOW);
+
     // Configure LCD control and data pins as outputs
     DIO_setPinDirection(LCD_RS_PORT, LCD_RS_PIN, DIO_PIN_OUTPUT);
     DIO_setPinDirection(LCD_E_PORT, LCD_E_PIN, DIO_PIN_OUTPUT);
@@ -65,29 +204,71 @@ void LCD_voidInit(void)
     DIO_setPinDirection(LCD_D5_PORT, LCD_D5_PIN, DIO_PIN_OUTPUT);
     DIO_setPinDirection(LCD_D6_PORT, LCD_D6_PIN, DIO_PIN_OUTPUT);
     DIO_setPinDirection(LCD_D7_PORT, LCD_D7_PIN, DIO_PIN_OUTPUT);
+#if LCD_MODE == LCD_8_BIT_MODE
+    DIO_setPinDirection(LCD_D0_PORT, LCD_D0_PIN, DIO_PIN_OUTPUT);
+    DIO_setPinDirection(LCD_D1_PORT, LCD_D1_PIN, DIO_PIN_OUTPUT);
+    DIO_setPinDirection(LCD_D2_PORT, LCD_D2_PIN, DIO_PIN_OUTPUT);
+    DIO_setPinDirection(LCD_D3_PORT, LCD_D3_PIN, DIO_PIN_OUTPUT);
+#endif
+#if LCD_RW_WIRED == LCD_ENABLED
+    // R/W low: write mode except while the busy flag is read
+    DIO_setPinValue(LCD_RW_PORT, LCD_RW_PIN, DIO_PIN_LOW);
+    DIO_setPinDirection(LCD_RW_PORT, LCD_RW_PIN, DIO_PIN_OUTPUT);
+#endif
+
+#if !LCD_DATA_ONE_PORT
+    {
+        // Bus bit 0 is the lowest data line of the mode
+        const Dio_CHANNEL_NUM Local_ADataChannels[LCD_DATA_WIDTH] =
+        {
+#if LCD_MODE == LCD_8_BIT_MODE
+            (Dio_CHANNEL_NUM)(LCD_D0_PORT*8 + LCD_D0_PIN),
+            (Dio_CHANNEL_NUM)(LCD_D1_PORT*8 + LCD_D1_PIN),
+            (Dio_CHANNEL_NUM)(LCD_D2_PORT*8 + LCD_D2_PIN),
+            (Dio_CHANNEL_NUM)(LCD_D3_PORT*8 + LCD_D3_PIN),
+#endif
+            (Dio_CHANNEL_NUM)(LCD_D4_PORT*8 + LCD_D4_PIN),
+            (Dio_CHANNEL_NUM)(LCD_D5_PORT*8 + LCD_D5_PIN),
+            (Dio_CHANNEL_NUM)(LCD_D6_PORT*8 + LCD_D6_PIN),
+            (Dio_CHANNEL_NUM)(LCD_D7_PORT*8 + LCD_D7_PIN)
+        };
+        DIO_initBus(&LCD_DataBus, Local_ADataChannels, LCD_DATA_WIDTH);
+    }
+#endif
 
     // Wait for the power to stabilize (VDD to rise to 4.5V)
     _delay_ms(35);
 
-    // Initialize LCD in 4-bit mode
-    // Function Set: Interface is 4 bits, 2 line display, 5x8 font
-    private_voidWriteHalfPort(0b0010);  // Send first part (only 4 MSB bits of command)
-    DIO_setPinValue(LCD_E_PORT, LCD_E_PIN, DIO_PIN_HIGH);
-    _delay_ms(1);
-    DIO_setPinValue(LCD_E_PORT, LCD_E_PIN, DIO_PIN_LOW);
-    LCD_voidSendCmnd(0b00101000);       // Send second part (full command)
-    _delay_us(45);
+    // Function Set: Interface is 4 or 8 bits (LCD_MODE), 2 line display, 5x8 font
+    // The controller is still in 8-bit mode: no busy flag yet, wait the execution time
+#if LCD_MODE == LCD_8_BIT_MODE
+    private_voidWriteDataPort(LCD_FUNCTION_SET);       // Whole command in one transfer
+#else
+    private_voidWriteDataPort(LCD_FUNCTION_SET >> 4);  // Send first part (only 4 MSB bits of command)
+#endif
+    private_voidPulseEnable();
+    _delay_loop_2(LCD_Au16ExecLoops[LCD_CLASS_FUNCTION_SET]);
+#endif
+    // From here on every transfer waits for the controller by itself (LCD_ASYNC: the
+    // commands are queued and go out from LCD_voidTick)
+    LCD_voidSendCmnd(LCD_FUNCTION_SET);                // Full command again (lines and font in 4-bit mode)
 
     // Display On/Off Control: Display ON, Cursor ON, Blink ON
     LCD_voidSendCmnd(0b00001111);
-    _delay_us(45);
 
     // Clear Display
     LCD_voidSendCmnd(0b00000001);
-    _delay_ms(2);
 
     // Set Entry Mode: Increment cursor, No shift of display
     LCD_voidSendCmnd(0b00000110);
+
+    // The framebuffer matches the cleared display
+    for (LCD_u8BufferCursor = 0; LCD_u8BufferCursor < LCD_BUFFER_SIZE; LCD_u8BufferCursor++)
+    {
+        LCD_Au8Buffer[LCD_u8BufferCursor] = ' ';
+        LCD_Au8BufferDirty[LCD_u8BufferCursor / 8] = 0;
+    }
+    LCD_u8BufferCursor = 0;
 }
 
 /*
@@ -97,9 +278,13 @@ void LCD_voidInit(void)
  *
  * This function is used to send various command instructions to the LCD.
  * The command is sent in two parts in 4-bit mode: the most significant 4 bits
- * are sent first, followed by the least significant 4 bits. Each part is
+ * are sent first, followed by the least significant 4 bits (in 8-bit mode it
+ * goes out as one part). Each part is
  * written to the LCD's data pins, and an enable pulse is sent to signal
- * the LCD controller to read these bits.
+ * the LCD controller to read these bits. The function returns once the LCD
+ * can take the next transfer (R/W not wired) or right after the transfer
+ * (R/W wired: the next transfer polls the busy flag first). With LCD_ASYNC
+ * the command is only queued and sent later by LCD_voidTick.
  *
  * Parameters:
  *   copy_u8Cmnd - The 8-bit command instruction to be sent to the LCD.
@@ -112,24 +297,8 @@ void LCD_voidInit(void)
  */
 void LCD_voidSendCmnd(u8 copy_u8Cmnd)
 {
-    // Set RS pin to 0 to indicate command mode
-    DIO_setPinValue(LCD_RS_PORT, LCD_RS_PIN, DIO_PIN_LOW);
-
-    // Send the most significant 4 bits of the command
-    private_voidWriteHalfPort(copy_u8Cmnd >> 4);
-
-    // Generate an enable pulse to latch the data
-    DIO_setPinValue(LCD_E_PORT, LCD_E_PIN, DIO_PIN_HIGH);
-    _delay_ms(1);
-    DIO_setPinValue(LCD_E_PORT, LCD_E_PIN, DIO_PIN_LOW);
-
-    // Send the least significant 4 bits of the command
-    private_voidWriteHalfPort(copy_u8Cmnd);
-
-    // Generate another enable pulse to latch the data
-    DIO_setPinValue(LCD_E_PORT, LCD_E_PIN, DIO_PIN_HIGH);
-    _delay_ms(1);
-    DIO_setPinValue(LCD_E_PORT, LCD_E_PIN, DIO_PIN_LOW);
+    // RS low: command mode
+    private_voidPutByte(DIO_PIN_LOW, copy_u8Cmnd);
 }
 
 
@@ -140,9 +309,9 @@ void LCD_voidSendCmnd(u8 copy_u8Cmnd)
  *
  * This function sends an 8-bit data (character) to the LCD for display. The character
  * is sent in two parts when operating in 4-bit mode: first the most significant 4 bits
- * are sent, followed by the least significant 4 bits. Each part is written to the LCD's
+ * are sent, followed by the least significant 4 bits (one part in 8-bit mode). Each part is written to the LCD's
  * data pins, and an enable pulse is sent to signal the LCD controller to read and process
- * these bits.
+ * these bits. Timing and queueing are handled as in LCD_voidSendCmnd.
  *
  * Parameters:
  *   copy_u8Data - The character to be displayed on the LCD, passed as an 8-bit unsigned integer.
@@ -155,24 +324,8 @@ void LCD_voidSendCmnd(u8 copy_u8Cmnd)
  */
 void LCD_voidSendChar(u8 copy_u8Data)
 {
-    // Set RS pin to 1 to indicate data mode (for displaying characters)
-    DIO_setPinValue(LCD_RS_PORT, LCD_RS_PIN, DIO_PIN_HIGH);
-
-    // Send the most significant 4 bits of the character
-    private_voidWriteHalfPort(copy_u8Data >> 4);
-
-    // Generate an enable pulse to latch the data
-    DIO_setPinValue(LCD_E_PORT, LCD_E_PIN, DIO_PIN_HIGH);
-    _delay_ms(1);
-    DIO_setPinValue(LCD_E_PORT, LCD_E_PIN, DIO_PIN_LOW);
-
-    // Send the least significant 4 bits of the character
-    private_voidWriteHalfPort(copy_u8Data);
-
-    // Generate another enable pulse to latch the data
-    DIO_setPinValue(LCD_E_PORT, LCD_E_PIN, DIO_PIN_HIGH);
-    _delay_ms(1);
-    DIO_setPinValue(LCD_E_PORT, LCD_E_PIN, DIO_PIN_LOW);
+    // RS high: data mode (for displaying characters)
+    private_voidPutByte(DIO_PIN_HIGH, copy_u8Data);
 }
 
 
@@ -200,6 +353,9 @@ void LCD_voidSendChar(u8 copy_u8Data)
  *     - The LCD must be initialized with LCD_voidInit() before calling this function.
  *     - The string is displayed at the current cursor position on the LCD.
  *     - If the string is longer than the LCD's width, it will continue on the next line or wrap around.
+ *     - With LCD_ASYNC (or the shared bus) the characters are only queued; they are on the
+ *       display once LCD_voidWaitIdle returns (or, with LCD_ASYNC, the LCD_voidSetCallBack
+ *       function runs).
  */
 void LCD_voidWriteString(u8* copy_pu8String)
 {
@@ -220,60 +376,293 @@ void LCD_voidWriteString(u8* copy_pu8String)
 
 /* Function Prototypes */
 
+#if LCD_SHARED_BUS == LCD_DISABLED
+/* Pin level transfers: not used with the shared bus, where BUS_ARB drives the pins */
+
 /*
- * Function: private_voidWriteHalfPort
+ * Function: private_voidWriteDataPort
  * -----------------------------------
- * Writes a 4-bit value to the LCD data lines.
+ * Writes one transfer to the LCD data lines.
  *
- * This static function is used internally within the LCD driver to send
- * half of a byte (4 bits) to the LCD in 4-bit mode operation. It directly
- * manipulates the data lines of the LCD connected to the microcontroller.
+ * This static function is used internally within the LCD driver to put
+ * half of a byte (4 bits, on D4..D7) in 4-bit mode, or a whole byte (on D0..D7)
+ * in 8-bit mode, on the data lines. It directly manipulates the data lines of
+ * the LCD connected to the microcontroller.
  * This function is marked static to limit its scope to this source file,
  * ensuring that it is not callable from outside the LCD module.
  *
  * Parameters:
- *   copy_u8Value - An 8-bit unsigned integer where only the lower 4 bits
- *                  are relevant and will be sent to the LCD data lines.
+ *   copy_u8Value - The value to put on the data lines; in 4-bit mode only
+ *                  the lower 4 bits are relevant.
+ *
+ * Returns:
+ *   void - This function does not return a value.
+ */
+static void private_voidWriteDataPort(u8 copy_u8Value)
+{
+#if LCD_DATA_ONE_PORT
+	// All data lines share one port: update them in a single masked write
+	DIO_writePortMasked(LCD_D4_PORT, LCD_DATA_PINS_MASK, LCD_DATA_TO_PORT(copy_u8Value));
+#elif LCD_MODE == LCD_8_BIT_MODE
+	// Data lines on several ports: one masked write per port through the data bus
+	DIO_writeBus(&LCD_DataBus, copy_u8Value);
+#else
+	DIO_writeBus(&LCD_DataBus, copy_u8Value & 0x0F);
+#endif
+}
+
+/*
+ * Function: private_voidSendByte
+ * ------------------------------
+ * Sends one byte to the LCD (two nibbles, or one transfer in 8-bit mode) and handles
+ * the controller timing.
+ *
+ * With R/W wired, the busy flag is polled before the transfer, so the time the
+ * controller needs to execute the byte overlaps with the caller's work. Without
+ * R/W, the datasheet execution time of the byte's instruction class is waited after
+ * the transfer. With LCD_ASYNC the byte is sent from LCD_voidTick, which must not wait:
+ * the busy flag is not polled, even with R/W wired, and the execution time becomes a
+ * number of ticks to skip before the next byte.
+ *
+ * Parameters:
+ *   copy_u8Rs   - DIO_PIN_LOW for an instruction, DIO_PIN_HIGH for data.
+ *   copy_u8Byte - The byte to send.
  *
  * Returns:
  *   void - This function does not return a value.
  */
-void private_voidWriteHalfPort(u8 copy_u8Value)
+static void private_voidSendByte(u8 copy_u8Rs, u8 copy_u8Byte)
 {
-	if(GET_BIT(copy_u8Value,0) == 1)
+#if (LCD_RW_WIRED == LCD_DISABLED) || (LCD_ASYNC == LCD_ENABLED)
+	u8 Local_u8Class = LCD_CLASS_WRITE_DATA;
+#endif
+
+#if LCD_ASYNC == LCD_DISABLED
+	private_voidWaitReady();
+#endif
+
+	DIO_setPinValue(LCD_RS_PORT, LCD_RS_PIN, copy_u8Rs);
+
+#if LCD_MODE == LCD_8_BIT_MODE
+	// Whole byte on D0..D7, latched by one enable pulse
+	private_voidWriteDataPort(copy_u8Byte);
+	private_voidPulseEnable();
+#else
+	// Most significant nibble first, each one latched by an enable pulse
+	private_voidWriteDataPort(copy_u8Byte >> 4);
+	private_voidPulseEnable();
+	private_voidWriteDataPort(copy_u8Byte);
+	private_voidPulseEnable();
+#endif
+
+#if (LCD_RW_WIRED == LCD_DISABLED) || (LCD_ASYNC == LCD_ENABLED)
+	if (copy_u8Rs == DIO_PIN_LOW)
 	{
-		DIO_setPinValue(LCD_D4_PORT,LCD_D4_PIN,DIO_PIN_HIGH);
+		// Instruction class: position of the highest set bit (0x00 is treated as clear)
+		Local_u8Class = 7;
+		while ((Local_u8Class > 0) && !GET_BIT(copy_u8Byte, Local_u8Class))
+		{
+			Local_u8Class--;
+		}
 	}
-	else if(GET_BIT(copy_u8Value,0) == 0)
+#if LCD_ASYNC == LCD_ENABLED
+	LCD_u8WaitTicks = LCD_Au8ExecTicks[Local_u8Class];
+#else
+	_delay_loop_2(LCD_Au16ExecLoops[Local_u8Class]);
+#endif
+#endif
+}
+#endif
+
+/*
+ * Function: private_voidPutByte
+ * -----------------------------
+ * Hands one byte of an LCD call to the transmit path.
+ *
+ * The tracked address counter is updated here, in call order, so the framebuffer flush
+ * sees the address the controller will have once the queued bytes are out. The byte is
+ * then queued to BUS_ARB (shared bus), queued for LCD_voidTick (LCD_ASYNC, waiting only
+ * while the queue is full) or sent right away.
+ *
+ * Parameters:
+ *   copy_u8Rs   - DIO_PIN_LOW for an instruction, DIO_PIN_HIGH for data.
+ *   copy_u8Byte - The byte to send.
+ *
+ * Returns:
+ *   void - This function does not return a value.
+ */
+static void private_voidPutByte(u8 copy_u8Rs, u8 copy_u8Byte)
+{
+#if LCD_ASYNC == LCD_ENABLED
+	u8 Local_u8Next = (LCD_u8QueueHead + 1) & (LCD_QUEUE_SIZE - 1);
+#endif
+
+	private_voidTrackAddress(copy_u8Rs, copy_u8Byte);
+
+#if LCD_SHARED_BUS == LCD_ENABLED
+	BUS_ARB_voidLcdWrite((copy_u8Rs == DIO_PIN_LOW) ? BUS_ARB_LCD_COMMAND : BUS_ARB_LCD_DATA, copy_u8Byte);
+#elif LCD_ASYNC == LCD_ENABLED
+	// Queue full: wait for the tick to send the oldest byte
+	while (Local_u8Next == LCD_u8QueueTail)
 	{
-		DIO_setPinValue(LCD_D4_PORT,LCD_D4_PIN,DIO_PIN_LOW);
 	}
-	
-	if(GET_BIT(copy_u8Value,1) == 1)
+
+	// Entry first, then the index, then the pending flag: the tick never sees a
+	// half-written entry, and never reports the queue drained before this byte is out
+	LCD_Au8QueueRs[LCD_u8QueueHead] = copy_u8Rs;
+	LCD_Au8QueueByte[LCD_u8QueueHead] = copy_u8Byte;
+	LCD_u8QueueHead = Local_u8Next;
+	LCD_u8Pending = 1;
+#else
+	private_voidSendByte(copy_u8Rs, copy_u8Byte);
+	LCD_u8Pending = 1;
+#endif
+}
+
+#if LCD_SHARED_BUS == LCD_DISABLED
+/*
+ * Function: private_voidPulseEnable
+ * ---------------------------------
+ * Generates one enable pulse; the controller latches the data lines on the falling edge.
+ *
+ * Parameters:
+ *   void - No parameters.
+ *
+ * Returns:
+ *   void - This function does not return a value.
+ */
+static void private_voidPulseEnable(void)
+{
+	DIO_setPinValue(LCD_E_PORT, LCD_E_PIN, DIO_PIN_HIGH);
+	_delay_us(LCD_E_PULSE_US);
+	DIO_setPinValue(LCD_E_PORT, LCD_E_PIN, DIO_PIN_LOW);
+}
+
+/*
+ * Function: private_voidWaitReady
+ * -------------------------------
+ * Polls the busy flag until the controller accepts a new transfer.
+ *
+ * In 4-bit mode a read takes two enable pulses: the first returns the busy flag on D7,
+ * the second the low address counter bits, which are ignored. In 8-bit mode one pulse
+ * returns the whole byte. The data lines are inputs
+ * while R/W is high. The wait ends after LCD_BUSY_TIMEOUT_US polls of at least 1 us each,
+ * so a display that never answers costs a bounded delay per transfer. Without R/W
+ * wiring the function does nothing. Not built with LCD_ASYNC: the bytes are sent from
+ * the tick interrupt, paced by the ticks, and a poll of up to LCD_BUSY_TIMEOUT_US would
+ * run with interrupts disabled.
+ *
+ * Parameters:
+ *   void - No parameters.
+ *
+ * Returns:
+ *   void - This function does not return a value.
+ */
+#if LCD_ASYNC == LCD_DISABLED
+static void private_voidWaitReady(void)
+{
+#if LCD_RW_WIRED == LCD_ENABLED
+	u16 Local_u16Polls;
+	u8 Local_u8Busy = DIO_PIN_LOW;
+
+	// Release the data lines before the controller drives them
+#if LCD_DATA_ONE_PORT
+	DIO_writePortDirectionMasked(LCD_D4_PORT, LCD_DATA_PINS_MASK, DIO_PORT_INPUT);
+#else
+	DIO_setBusDirection(&LCD_DataBus, DIO_PIN_INPUT);
+#endif
+	DIO_setPinValue(LCD_RS_PORT, LCD_RS_PIN, DIO_PIN_LOW);
+	DIO_setPinValue(LCD_RW_PORT, LCD_RW_PIN, DIO_PIN_HIGH);
+
+	for (Local_u16Polls = 0; Local_u16Polls < LCD_BUSY_TIMEOUT_US; Local_u16Polls++)
 	{
-		DIO_setPinValue(LCD_D5_PORT,LCD_D5_PIN,DIO_PIN_HIGH);
+		// First nibble: busy flag on D7
+		DIO_setPinValue(LCD_E_PORT, LCD_E_PIN, DIO_PIN_HIGH);
+		_delay_us(LCD_E_PULSE_US);
+		DIO_getPinValue(LCD_D7_PORT, LCD_D7_PIN, &Local_u8Busy);
+		DIO_setPinValue(LCD_E_PORT, LCD_E_PIN, DIO_PIN_LOW);
+
+#if LCD_MODE == LCD_4_BIT_MODE
+		// Second nibble: completes the read
+		private_voidPulseEnable();
+#else
+		// Rest of the enable cycle: every poll lasts at least 1 us
+		_delay_us(LCD_E_CYCLE_US - LCD_E_PULSE_US);
+#endif
+
+		if (Local_u8Busy == DIO_PIN_LOW)
+		{
+			break;
+		}
 	}
-	else if(GET_BIT(copy_u8Value,1) == 0)
+
+	// Back to write mode: R/W low before the data lines drive again
+	DIO_setPinValue(LCD_RW_PORT, LCD_RW_PIN, DIO_PIN_LOW);
+#if LCD_DATA_ONE_PORT
+	DIO_writePortDirectionMasked(LCD_D4_PORT, LCD_DATA_PINS_MASK, DIO_PORT_OUTPUT);
+#else
+	DIO_setBusDirection(&LCD_DataBus, DIO_PIN_OUTPUT);
+#endif
+#endif
+}
+#endif
+#endif
+
+/*
+ * Function: private_voidTrackAddress
+ * ----------------------------------
+ * Follows the controller's DDRAM address counter for the framebuffer flush.
+ *
+ * Data writes move the counter to the next cell in DDRAM order, which wraps from line 3
+ * to line 2 and from line 4 to line 1 like the controller does. Set DDRAM address, clear
+ * and return home load it. Display control, function set and the increment entry mode
+ * leave it alone; any other instruction may move it and makes it unknown.
+ *
+ * Parameters:
+ *   copy_u8Rs   - DIO_PIN_LOW for an instruction, DIO_PIN_HIGH for data.
+ *   copy_u8Byte - The byte sent.
+ *
+ * Returns:
+ *   void - This function does not return a value.
+ */
+static void private_voidTrackAddress(u8 copy_u8Rs, u8 copy_u8Byte)
+{
+	if (copy_u8Rs == DIO_PIN_HIGH)
 	{
-		DIO_setPinValue(LCD_D5_PORT,LCD_D5_PIN,DIO_PIN_LOW);
+		if (LCD_u8Address != LCD_ADDRESS_UNKNOWN)
+		{
+			LCD_u8Address = (LCD_u8Address + 1) % LCD_BUFFER_SIZE;
+		}
 	}
-	
-	if(GET_BIT(copy_u8Value,2) == 1)
+	else if (GET_BIT(copy_u8Byte, 7))
 	{
-		DIO_setPinValue(LCD_D6_PORT,LCD_D6_PIN,DIO_PIN_HIGH);
+		// Set DDRAM address: only addresses of the 4x20 cells are followed
+		copy_u8Byte &= 0x7F;
+		if (copy_u8Byte < LCD_BUFFER_HALF)
+		{
+			LCD_u8Address = copy_u8Byte;
+		}
+		else if ((copy_u8Byte >= 0x40) && (copy_u8Byte < 0x40 + LCD_BUFFER_HALF))
+		{
+			LCD_u8Address = copy_u8Byte - (0x40 - LCD_BUFFER_HALF);
+		}
+		else
+		{
+			LCD_u8Address = LCD_ADDRESS_UNKNOWN;
+		}
 	}
-	else if(GET_BIT(copy_u8Value,2) == 0)
+	else if ((copy_u8Byte & 0xFC) == 0x00)
 	{
-		DIO_setPinValue(LCD_D6_PORT,LCD_D6_PIN,DIO_PIN_LOW);
+		// Clear display / return home
+		LCD_u8Address = 0;
 	}
-	
-	if(GET_BIT(copy_u8Value,3) == 1)
+	else if (((copy_u8Byte & 0xF8) == 0x08) || ((copy_u8Byte & 0xE0) == 0x20) || (copy_u8Byte == 0x06))
 	{
-		DIO_setPinValue(LCD_D7_PORT,LCD_D7_PIN,DIO_PIN_HIGH);
+		// Display control, function set, increment entry mode: counter unchanged
 	}
-	else if(GET_BIT(copy_u8Value,3) == 0)
+	else
 	{
-		DIO_setPinValue(LCD_D7_PORT,LCD_D7_PIN,DIO_PIN_LOW);
+		LCD_u8Address = LCD_ADDRESS_UNKNOWN;
 	}
 }
 
@@ -449,8 +838,13 @@ void LCD_voidDisplayFloat(f32 number) {
  *     LCD_voidClear(); // Clears the entire LCD display.
  *
  * Note:
- *     - The clearing process takes a certain amount of time (usually a few milliseconds).
- *     - It is advisable to introduce a small delay after calling this function to ensure that the LCD has completed the clearing operation before proceeding with further display actions.
+ *     - The clearing process takes 1.52 ms. In blocking mode the driver waits for it before
+ *       the next transfer (busy flag) or before returning (R/W not wired), so no extra delay
+ *       is needed.
+ *     - With LCD_ASYNC (or the shared bus) the command is only queued and the function
+ *       returns at once; the tick sends it and holds the next bytes back for the 1.52 ms.
+ *       The display is cleared once LCD_voidWaitIdle returns (or, with LCD_ASYNC, the
+ *       LCD_voidSetCallBack function runs).
  */
 void LCD_voidClear(void)
 {
@@ -812,6 +1206,309 @@ void LCD_voidWriteHex(u8 copy_u8Data)
 }
 
 
+/*
+ * Function: LCD_voidBufferGoTo
+ * ----------------------------
+ * Description:
+ *     Moves the framebuffer cursor to a cell. Nothing is sent to the LCD.
+ *
+ * Parameters:
+ *     - copy_u8Line: LCD_LINE_ONE .. LCD_LINE_FOUR.
+ *     - copy_u8Cell: Column 0 to 19.
+ *
+ * Returns:
+ *     void: This function does not return a value. Invalid positions are ignored.
+ */
+void LCD_voidBufferGoTo(u8 copy_u8Line, u8 copy_u8Cell)
+{
+	if ((copy_u8Line <= LCD_LINE_FOUR) && (copy_u8Cell < LCD_BUFFER_LINE_SIZE))
+	{
+		LCD_u8BufferCursor = LCD_Au8BufferLine[copy_u8Line] + copy_u8Cell;
+	}
+}
+
+/*
+ * Function: LCD_voidBufferWriteChar
+ * ---------------------------------
+ * Description:
+ *     Writes a character into the framebuffer at the cursor and advances the cursor in
+ *     the same order as the LCD (line 1, 3, 2, 4). The cell is marked for the next
+ *     LCD_u8Flush only if its content changes.
+ *
+ * Parameters:
+ *     - copy_u8Data: The character.
+ *
+ * Returns:
+ *     void: This function does not return a value.
+ */
+void LCD_voidBufferWriteChar(u8 copy_u8Data)
+{
+	if (LCD_Au8Buffer[LCD_u8BufferCursor] != copy_u8Data)
+	{
+		LCD_Au8Buffer[LCD_u8BufferCursor] = copy_u8Data;
+		SET_BIT(LCD_Au8BufferDirty[LCD_u8BufferCursor / 8], LCD_u8BufferCursor % 8);
+	}
+	LCD_u8BufferCursor = (LCD_u8BufferCursor + 1) % LCD_BUFFER_SIZE;
+}
+
+/*
+ * Function: LCD_voidBufferWriteString
+ * -----------------------------------
+ * Description:
+ *     Writes a null-terminated string into the framebuffer at the cursor.
+ *
+ * Parameters:
+ *     - copy_pu8String: Pointer to the string. NULL is ignored.
+ *
+ * Returns:
+ *     void: This function does not return a value.
+ */
+void LCD_voidBufferWriteString(u8* copy_pu8String)
+{
+	if (copy_pu8String != NULL)
+	{
+		while (*copy_pu8String != '\0')
+		{
+			LCD_voidBufferWriteChar(*copy_pu8String);
+			copy_pu8String++;
+		}
+	}
+}
+
+/*
+ * Function: LCD_voidBufferWriteNumber
+ * -----------------------------------
+ * Description:
+ *     Writes a signed number in decimal into the framebuffer at the cursor.
+ *
+ * Parameters:
+ *     - copy_s32Data: The number.
+ *
+ * Returns:
+ *     void: This function does not return a value.
+ */
+void LCD_voidBufferWriteNumber(s32 copy_s32Data)
+{
+	u8 Local_Au8Digits[10];
+	u8 Local_u8Count = 0;
+	u32 Local_u32Value = (u32)copy_s32Data;
+
+	if (copy_s32Data < 0)
+	{
+		LCD_voidBufferWriteChar('-');
+		Local_u32Value = (u32)0 - Local_u32Value;
+	}
+
+	do
+	{
+		Local_Au8Digits[Local_u8Count++] = '0' + (Local_u32Value % 10);
+		Local_u32Value /= 10;
+	} while (Local_u32Value != 0);
+
+	while (Local_u8Count > 0)
+	{
+		LCD_voidBufferWriteChar(Local_Au8Digits[--Local_u8Count]);
+	}
+}
+
+/*
+ * Function: LCD_voidBufferClear
+ * -----------------------------
+ * Description:
+ *     Fills the framebuffer with spaces and moves its cursor to line 1, cell 0. Only
+ *     the cells that were not blank are sent by the next flush.
+ *
+ * Parameters:
+ *     void
+ *
+ * Returns:
+ *     void: This function does not return a value.
+ */
+void LCD_voidBufferClear(void)
+{
+	u8 Local_u8Index;
+
+	LCD_u8BufferCursor = 0;
+	for (Local_u8Index = 0; Local_u8Index < LCD_BUFFER_SIZE; Local_u8Index++)
+	{
+		LCD_voidBufferWriteChar(' ');
+	}
+}
+
+/*
+ * Function: LCD_u8Flush
+ * ---------------------
+ * Description:
+ *     Sends the framebuffer cells changed since the last flush.
+ *     The cells are walked in DDRAM order starting at the controller's address counter,
+ *     so runs of changed cells are written with auto-increment. A DDRAM address command
+ *     is sent only when the next changed cell is not at the counter. Gaps of up to
+ *     LCD_BUFFER_MAX_GAP unchanged cells are written again instead, at the same cost.
+ *
+ * Parameters:
+ *     void
+ *
+ * Returns:
+ *     u8: Number of bytes sent to the LCD (address commands plus characters), at most 84.
+ *
+ * Note:
+ *     - Cells written directly (LCD_voidSendChar, LCD_voidWriteString, ...) are not seen
+ *       by the framebuffer; use one or the other for a given area of the display.
+ */
+u8 LCD_u8Flush(void)
+{
+	u8 Local_u8Start;
+	u8 Local_u8Step;
+	u8 Local_u8Index;
+	u8 Local_u8Gap;
+	u8 Local_u8Sent = 0;
+
+	Local_u8Start = (LCD_u8Address == LCD_ADDRESS_UNKNOWN) ? 0 : LCD_u8Address;
+
+	for (Local_u8Step = 0; Local_u8Step < LCD_BUFFER_SIZE; Local_u8Step++)
+	{
+		Local_u8Index = (Local_u8Start + Local_u8Step) % LCD_BUFFER_SIZE;
+
+		if (!GET_BIT(LCD_Au8BufferDirty[Local_u8Index / 8], Local_u8Index % 8))
+		{
+			continue;
+		}
+
+		if (LCD_u8Address != Local_u8Index)
+		{
+			Local_u8Gap = (LCD_u8Address == LCD_ADDRESS_UNKNOWN) ? LCD_BUFFER_SIZE :
+			              (Local_u8Index + LCD_BUFFER_SIZE - LCD_u8Address) % LCD_BUFFER_SIZE;
+
+			if (Local_u8Gap <= LCD_BUFFER_MAX_GAP)
+			{
+				// Rewrite the unchanged cells in between, the counter follows
+				while (LCD_u8Address != Local_u8Index)
+				{
+					LCD_voidSendChar(LCD_Au8Buffer[LCD_u8Address]);
+					Local_u8Sent++;
+				}
+			}
+			else
+			{
+				LCD_voidSendCmnd(0x80 + LCD_BUFFER_INDEX_TO_DDRAM(Local_u8Index));
+				Local_u8Sent++;
+			}
+		}
+
+		LCD_voidSendChar(LCD_Au8Buffer[Local_u8Index]);
+		CLR_BIT(LCD_Au8BufferDirty[Local_u8Index / 8], Local_u8Index % 8);
+		Local_u8Sent++;
+	}
+
+	return Local_u8Sent;
+}
+
+/*
+ * Function: LCD_voidTick
+ * ----------------------
+ * Description:
+ *     Transmit step, to be called at every Timer0 tick.
+ *     With LCD_ASYNC it skips the tick while the controller still executes the last
+ *     byte, otherwise sends the oldest queued byte (two nibbles, a few microseconds) and
+ *     schedules the ticks to skip for it. The first tick that finds nothing left to send
+ *     (without LCD_ASYNC: any tick after a call) calls the LCD_voidSetCallBack function
+ *     once for all the bytes put since the last notification. Does nothing with the
+ *     shared bus.
+ *
+ * Parameters:
+ *     void: This function does not take any parameters.
+ *
+ * Returns:
+ *     void: This function does not return a value.
+ *
+ * Example Usage:
+ *     TIMER0_voidSetCallBack(LCD_voidTick);
+ *     TIMER0_voidInitTick();
+ */
+void LCD_voidTick(void)
+{
+#if LCD_ASYNC == LCD_ENABLED
+	// Controller still busy with the last byte
+	if (LCD_u8WaitTicks > 0)
+	{
+		LCD_u8WaitTicks--;
+		return;
+	}
+
+	if (LCD_u8QueueTail != LCD_u8QueueHead)
+	{
+		private_voidSendByte(LCD_Au8QueueRs[LCD_u8QueueTail], LCD_Au8QueueByte[LCD_u8QueueTail]);
+		LCD_u8QueueTail = (LCD_u8QueueTail + 1) & (LCD_QUEUE_SIZE - 1);
+		return;
+	}
+#endif
+
+#if LCD_SHARED_BUS == LCD_DISABLED
+	// Everything put is on the display: notify once
+	if (LCD_u8Pending)
+	{
+		LCD_u8Pending = 0;
+		if (LCD_pvCallBack != NULL)
+		{
+			LCD_pvCallBack();
+		}
+	}
+#endif
+}
+
+/*
+ * Function: LCD_voidSetCallBack
+ * -----------------------------
+ * Description:
+ *     Sets the function called (from LCD_voidTick, in interrupt context) when the
+ *     bytes of the calls made so far are on the display: with LCD_ASYNC when the queue
+ *     has drained and its last byte has been executed. NULL removes it. Not available
+ *     with the shared bus.
+ *
+ * Parameters:
+ *     - copy_pvCallBack: Completion function, or NULL.
+ *
+ * Returns:
+ *     void: This function does not return a value.
+ */
+void LCD_voidSetCallBack(void (*copy_pvCallBack)(void))
+{
+#if LCD_SHARED_BUS == LCD_DISABLED
+	LCD_pvCallBack = copy_pvCallBack;
+#else
+	(void)copy_pvCallBack;
+#endif
+}
+
+/*
+ * Function: LCD_voidWaitIdle
+ * --------------------------
+ * Description:
+ *     Flush and wait: returns once every byte queued so far is on the display.
+ *     With LCD_ASYNC it waits for LCD_voidTick to drain the transmit queue, with the
+ *     shared bus for BUS_ARB to send the queued bytes; both need their tick running.
+ *     Otherwise the bytes are already out and it returns at once.
+ *
+ * Parameters:
+ *     void: This function does not take any parameters.
+ *
+ * Returns:
+ *     void: This function does not return a value.
+ *
+ * Note:
+ *     - Must not be called with interrupts disabled or from an ISR.
+ */
+void LCD_voidWaitIdle(void)
+{
+#if LCD_SHARED_BUS == LCD_ENABLED
+	BUS_ARB_voidLcdFlush();
+#elif LCD_ASYNC == LCD_ENABLED
+	while (LCD_u8Pending)
+	{
+	}
+#endif
+}
+
 /*
  *Create a pattern and store in an address in CGRAM
  *The whole CGRAM is 8 bytes (1 special character) * 8 character slots = 64 bytes --> 0x00 to 0x07 addresses
@@ -846,7 +1543,6 @@ void LCD_voidCreateCharacter(u8 *copy_Pu8CharArr, u8 copy_u8Location)
     // Multiplying the desired location by 8 calculates the offset from the base address.
     // For example, location 2 would be: 0x40 + (2 * 8) = 0x50.
 	LCD_voidSendCmnd(0x40 + (copy_u8Location*8));
-	_delay_us(50);
 	//pass u8 array[8], representing the special character, to CGRAM using a for loop
 
     // Loop through each byte of the custom character array and send it to the current CGRAM address.
@@ -854,7 +1550,6 @@ void LCD_voidCreateCharacter(u8 *copy_Pu8CharArr, u8 copy_u8Location)
 	for(Local_u8Counter = 0; Local_u8Counter < 8; Local_u8Counter++)
 	{
 		LCD_voidSendChar(copy_Pu8CharArr[Local_u8Counter]);
-		_delay_us(100);
 	}
 
 	//on exit go back to DDRAM by setting DDRAM instruction
@@ -862,5 +1557,4 @@ void LCD_voidCreateCharacter(u8 *copy_Pu8CharArr, u8 copy_u8Location)
     // After storing the custom character, switch back to the Display Data RAM (DDRAM) address mode.
     // This is typically done using the 0x80 command for LCDs.
 	LCD_voidSendCmnd(0x80);
-	_delay_us(100);
 }
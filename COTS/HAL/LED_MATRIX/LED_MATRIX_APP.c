@@ -0,0 +1,76 @@
+/*
+ * File: LED_MATRIX_APP.c
+ *
+ * Description:
+ *     Test file for the LED matrix module on an AVR ATmega32 engineering kit.
+ *     The matrix is refreshed from the TIMER0 tick while the main loop only updates the
+ *     framebuffer, used as a status panel:
+ *       row 0       : heartbeat pixel fading in and out
+ *       row 1       : brightness ramp over the columns
+ *       other rows  : scrolling bar
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <avr/interrupt.h>
+#include <util/delay.h>
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../../MCAL/DIO/DIO_interface.h"
+#include "../../MCAL/DIO/DIO_private.h"
+#include "../../MCAL/DIO/DIO_config.h"
+#include "../../MCAL/TIMER/TIMER_interface.h"
+
+/* HAL */
+#include "./LED_MATRIX_interface.h"
+#include "./LED_MATRIX_config.h"
+#include "./LED_MATRIX_private.h"
+
+int main(void)
+{
+	u8 Local_u8Column;
+	u8 Local_u8Row;
+	u8 Local_u8Step = 0;
+	u8 Local_u8Heartbeat;
+
+	LED_MATRIX_voidInit();
+	TIMER0_voidSetCallBack(LED_MATRIX_voidTick);
+	TIMER0_voidInitTick();
+	sei();
+
+	/* Row 1: brightness ramp */
+	for(Local_u8Column = 0; Local_u8Column < LED_MATRIX_COLUMNS; Local_u8Column++)
+	{
+		LED_MATRIX_voidSetPixel(1, Local_u8Column,
+		                        (u8)((LED_MATRIX_BRIGHTNESS_MAX * (Local_u8Column + 1UL)) / LED_MATRIX_COLUMNS));
+	}
+
+	while(1)
+	{
+		/* Row 0: heartbeat, triangle wave on the first pixel */
+		Local_u8Heartbeat = (u8)(Local_u8Step << 3);
+		if(GET_BIT(Local_u8Step, 5))
+		{
+			Local_u8Heartbeat = (u8)~Local_u8Heartbeat;
+		}
+		LED_MATRIX_voidSetPixel(0, 0, Local_u8Heartbeat);
+
+		/* Other rows: one column bar moving every 8 steps */
+		for(Local_u8Row = 2; Local_u8Row < LED_MATRIX_ROWS; Local_u8Row++)
+		{
+			LED_MATRIX_voidSetRow(Local_u8Row, (u8)(1 << ((Local_u8Step >> 3) % LED_MATRIX_COLUMNS)),
+			                      LED_MATRIX_BRIGHTNESS_MAX);
+		}
+
+		Local_u8Step++;
+		_delay_ms(20);
+	}
+
+	return 0;
+}
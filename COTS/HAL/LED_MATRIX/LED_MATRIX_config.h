@@ -0,0 +1,76 @@
+/*
+ * File: LED_MATRIX_config.h
+ *
+ * Description:
+ *     Configuration header file for the LED matrix module for AVR ATmega32.
+ *
+ * Usage:
+ *     - LED_MATRIX_TYPE: LED_MATRIX_ROW_COLUMN or LED_MATRIX_CHARLIEPLEX.
+ *     - Row/column matrix:
+ *         LED_MATRIX_ROW_CHANNELS / LED_MATRIX_ROWS_NUM: Row lines (Dio_PINx_n), 1 to 8.
+ *         LED_MATRIX_COLUMN_CHANNELS / LED_MATRIX_COLUMNS_NUM: Column lines, 1 to 8.
+ *         LED_MATRIX_ROW_ACTIVE / LED_MATRIX_COLUMN_ACTIVE: Level that selects a row and
+ *         lights a column (DIO_PIN_HIGH or DIO_PIN_LOW), e.g. rows driving anodes through
+ *         a high-side transistor and columns sinking through resistors.
+ *     - Charlieplexed array:
+ *         LED_MATRIX_CHARLIE_CHANNELS / LED_MATRIX_CHARLIE_PINS_NUM: 2 to 8 pins, each
+ *         with a series resistor; N pins drive N * (N - 1) LEDs (N rows, N - 1 columns).
+ *     - LED_MATRIX_BAM_BITS: Displayed brightness bits per pixel, 1 to 4 (1 = on/off).
+ *
+ *     Buses are built with DIO_initBus: channels of one port with a common offset are
+ *     written together, so keeping each group on as few ports as possible keeps the
+ *     tick short.
+ *
+ *     The matrix lines must not be used by any other driver. The board has no 12 free
+ *     pins, so the defaults take the pins of the display bus and the keypad: rows on
+ *     PC0..PC4 (keypad rows and two free pins), columns on PB0..PB6 (LCD/SEV_SEG bus and
+ *     the LCD R/W pin). A board with the LED matrix has no LCD, seven-segment display or
+ *     keypad; the status LEDs, HC595, SOFT_I2C and LM35 pins stay free.
+ *
+ *     With DIO_PIN_MAP_GENERATED (DIO_config.h) the lines and their number come from the
+ *     ROW/COLUMN or CHARLIE bus of the board pin map (PINMAP/pinmap.txt, generated with
+ *     -D LED_MATRIX, plus -D LED_MATRIX_CHARLIEPLEX for a charlieplexed array).
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef LED_MATRIX_CONFIG_H_
+#define LED_MATRIX_CONFIG_H_
+
+/* Matrix type */
+#define LED_MATRIX_TYPE               LED_MATRIX_ROW_COLUMN
+
+#if DIO_PIN_MAP == DIO_PIN_MAP_GENERATED
+
+/* Lines from the board pin map */
+#define LED_MATRIX_ROWS_NUM           PINMAP_LED_MATRIX_ROW_WIDTH
+#define LED_MATRIX_ROW_CHANNELS       PINMAP_LED_MATRIX_ROW_CHANNELS
+#define LED_MATRIX_COLUMNS_NUM        PINMAP_LED_MATRIX_COLUMN_WIDTH
+#define LED_MATRIX_COLUMN_CHANNELS    PINMAP_LED_MATRIX_COLUMN_CHANNELS
+#define LED_MATRIX_CHARLIE_PINS_NUM   PINMAP_LED_MATRIX_CHARLIE_WIDTH
+#define LED_MATRIX_CHARLIE_CHANNELS   PINMAP_LED_MATRIX_CHARLIE_CHANNELS
+
+#else
+
+/* Row/column matrix: 5 rows x 7 columns status panel (replaces the displays and the keypad) */
+#define LED_MATRIX_ROWS_NUM           5
+#define LED_MATRIX_ROW_CHANNELS       {Dio_PINC_0, Dio_PINC_1, Dio_PINC_2, Dio_PINC_3, Dio_PINC_4}
+
+#define LED_MATRIX_COLUMNS_NUM        7
+#define LED_MATRIX_COLUMN_CHANNELS    {Dio_PINB_0, Dio_PINB_1, Dio_PINB_2, Dio_PINB_3, Dio_PINB_4, Dio_PINB_5, Dio_PINB_6}
+
+/* Charlieplexed array: 4 pins, 12 LEDs */
+#define LED_MATRIX_CHARLIE_PINS_NUM   4
+#define LED_MATRIX_CHARLIE_CHANNELS   {Dio_PINC_0, Dio_PINC_1, Dio_PINC_2, Dio_PINC_3}
+
+#endif /* DIO_PIN_MAP */
+
+/* Row/column matrix: rows select high, columns light low */
+#define LED_MATRIX_ROW_ACTIVE         DIO_PIN_HIGH
+#define LED_MATRIX_COLUMN_ACTIVE      DIO_PIN_LOW
+
+/* Brightness bits per pixel */
+#define LED_MATRIX_BAM_BITS           2
+
+#endif /* LED_MATRIX_CONFIG_H_ */
@@ -0,0 +1,81 @@
+/*
+ * File: LED_MATRIX_interface.h
+ *
+ * Description:
+ *     Header file for the LED matrix module for AVR ATmega32.
+ *     Drives a row/column LED matrix or a charlieplexed LED array on DIO channels
+ *     (LED_MATRIX_config.h) from a periodic tick, one row at a time, with per-pixel
+ *     brightness by bit-angle modulation (BAM): brightness bit b of every pixel of the
+ *     row is shown for 2^b ticks, so a row takes 2^LED_MATRIX_BAM_BITS - 1 ticks.
+ *
+ *     Refresh rate = tick rate / (rows * (2^LED_MATRIX_BAM_BITS - 1)), e.g. 5 rows,
+ *     2 bits and a 1 ms tick give 67 Hz; 8 rows, 3 bits and a 125 us tick give 143 Hz.
+ *
+ *     A tick costs at most three DIO bus writes (one masked write per port involved):
+ *     blank, select row, show columns when moving to the next row, and one write when
+ *     moving to the next brightness bit. The values are precomputed when pixels change.
+ *
+ *     Pixels are addressed by row and column. In charlieplex mode a "row" is the pin
+ *     driven high and its columns are the other pins in order, skipping the row pin:
+ *     pixel (r, c) is the LED from pin r to pin c (c < r) or pin c + 1 (c >= r).
+ *
+ * Usage:
+ *     LED_MATRIX_voidInit();
+ *     TIMER0_voidSetCallBack(LED_MATRIX_voidTick);
+ *     TIMER0_voidInitTick();
+ *     sei();
+ *     LED_MATRIX_voidSetPixel(0, 2, LED_MATRIX_BRIGHTNESS_MAX);
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef LED_MATRIX_INTERFACE_H_
+#define LED_MATRIX_INTERFACE_H_
+
+/* Brightness Range (independent of LED_MATRIX_BAM_BITS) */
+#define LED_MATRIX_BRIGHTNESS_OFF    0
+#define LED_MATRIX_BRIGHTNESS_MAX    255
+
+/* Function: LED_MATRIX_voidInit
+ * Description:
+ *     Builds the DIO buses, configures the pins with every LED off and clears the
+ *     framebuffer. Must be called before the tick starts.
+ */
+void LED_MATRIX_voidInit(void);
+
+/* Function: LED_MATRIX_voidTick
+ * Description:
+ *     One refresh step. Called from a periodic interrupt, typically as the TIMER0 tick
+ *     callback.
+ */
+void LED_MATRIX_voidTick(void);
+
+/* Function: LED_MATRIX_voidSetPixel
+ * Description:
+ *     Sets the brightness of one pixel, 0 (off) to LED_MATRIX_BRIGHTNESS_MAX. Only the
+ *     top LED_MATRIX_BAM_BITS bits are displayed (with 2 bits: 0-63 off, 64-127 one
+ *     third, ...). Invalid positions are ignored. Safe to call while the tick runs.
+ */
+void LED_MATRIX_voidSetPixel(u8 Copy_u8Row, u8 Copy_u8Column, u8 Copy_u8Brightness);
+
+/* Function: LED_MATRIX_u8GetPixel
+ * Description:
+ *     Returns the brightness last set for one pixel (0 for invalid positions).
+ */
+u8 LED_MATRIX_u8GetPixel(u8 Copy_u8Row, u8 Copy_u8Column);
+
+/* Function: LED_MATRIX_voidSetRow
+ * Description:
+ *     Sets a whole row from a bitmap (bit c = column c): set bits get Copy_u8Brightness,
+ *     cleared bits are turned off.
+ */
+void LED_MATRIX_voidSetRow(u8 Copy_u8Row, u8 Copy_u8Bitmap, u8 Copy_u8Brightness);
+
+/* Function: LED_MATRIX_voidClear
+ * Description:
+ *     Turns every pixel off.
+ */
+void LED_MATRIX_voidClear(void);
+
+#endif /* LED_MATRIX_INTERFACE_H_ */
@@ -0,0 +1,28 @@
+/*
+ * File: LED_MATRIX_private.h
+ *
+ * Description:
+ *     Private header file for the LED matrix module for AVR ATmega32.
+ *     It defines the matrix types and the dimensions derived from the configuration.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef LED_MATRIX_PRIVATE_H_
+#define LED_MATRIX_PRIVATE_H_
+
+/* Matrix Types */
+#define LED_MATRIX_ROW_COLUMN        0
+#define LED_MATRIX_CHARLIEPLEX       1
+
+/* Framebuffer dimensions */
+#if LED_MATRIX_TYPE == LED_MATRIX_CHARLIEPLEX
+#define LED_MATRIX_ROWS              LED_MATRIX_CHARLIE_PINS_NUM
+#define LED_MATRIX_COLUMNS           (LED_MATRIX_CHARLIE_PINS_NUM - 1)
+#else
+#define LED_MATRIX_ROWS              LED_MATRIX_ROWS_NUM
+#define LED_MATRIX_COLUMNS           LED_MATRIX_COLUMNS_NUM
+#endif
+
+#endif /* LED_MATRIX_PRIVATE_H_ */
@@ -0,0 +1,280 @@
+/*
+ * File: LED_MATRIX_program.c
+ *
+ * Description:
+ *     Implementation of the LED matrix module for AVR ATmega32.
+ *     For every row and brightness bit the bus values to output are kept ready
+ *     (LED_MATRIX_Au8Plane), so the tick only copies precomputed values to the DIO buses.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../../MCAL/DIO/DIO_interface.h"
+#include "../../MCAL/DIO/DIO_private.h"
+#include "../../MCAL/DIO/DIO_config.h"
+
+/* HAL */
+#include "./LED_MATRIX_interface.h"
+#include "./LED_MATRIX_config.h"
+#include "./LED_MATRIX_private.h"
+
+#if (LED_MATRIX_BAM_BITS < 1) || (LED_MATRIX_BAM_BITS > 4)
+#error "LED_MATRIX_BAM_BITS must be 1 to 4"
+#endif
+
+#if (DIO_PIN_MAP == DIO_PIN_MAP_GENERATED) && (LED_MATRIX_TYPE == LED_MATRIX_CHARLIEPLEX) && \
+    !defined(PINMAP_LED_MATRIX_CHARLIE_CHANNELS)
+#error "LED_MATRIX: the pin map has no CHARLIE bus (generate it with -D LED_MATRIX -D LED_MATRIX_CHARLIEPLEX)"
+#endif
+
+#if (DIO_PIN_MAP == DIO_PIN_MAP_GENERATED) && (LED_MATRIX_TYPE == LED_MATRIX_ROW_COLUMN) && \
+    (!defined(PINMAP_LED_MATRIX_ROW_CHANNELS) || !defined(PINMAP_LED_MATRIX_COLUMN_CHANNELS))
+#error "LED_MATRIX: the pin map has no ROW/COLUMN buses (generate it with -D LED_MATRIX)"
+#endif
+
+#if (LED_MATRIX_ROWS < 1) || (LED_MATRIX_ROWS > DIO_BUS_MAX_WIDTH) || \
+    (LED_MATRIX_COLUMNS < 1) || (LED_MATRIX_COLUMNS > DIO_BUS_MAX_WIDTH)
+#error "LED_MATRIX: rows and columns must be 1 to 8 (charlieplex: 2 to 8 pins)"
+#endif
+
+/* Framebuffer: brightness as set by the application */
+static u8 LED_MATRIX_Au8Pixel[LED_MATRIX_ROWS][LED_MATRIX_COLUMNS];
+
+/*
+ * Precomputed bus value of each row and brightness bit:
+ *   row/column : column bus value (active level already applied)
+ *   charlieplex: direction of the pins (row pin and lit columns are outputs)
+ */
+static volatile u8 LED_MATRIX_Au8Plane[LED_MATRIX_ROWS][LED_MATRIX_BAM_BITS];
+
+/* Refresh position */
+static u8 LED_MATRIX_u8Row = 0;
+static u8 LED_MATRIX_u8Bit = LED_MATRIX_BAM_BITS - 1;
+static u8 LED_MATRIX_u8TicksLeft = 1;
+
+#if LED_MATRIX_TYPE == LED_MATRIX_CHARLIEPLEX
+
+static Dio_BUS LED_MATRIX_strPins;
+
+/* Values of the blank step and of the selected row */
+#define LED_MATRIX_ALL_OFF        0x00
+#define LED_MATRIX_ROW_VALUE(Row) (1 << (Row))
+
+#else
+
+static Dio_BUS LED_MATRIX_strRows;
+static Dio_BUS LED_MATRIX_strColumns;
+
+#define LED_MATRIX_ROWS_MASK      ((u8)((1 << LED_MATRIX_ROWS) - 1))
+#define LED_MATRIX_COLUMNS_MASK   ((u8)((1 << LED_MATRIX_COLUMNS) - 1))
+
+/* Bus values with the active levels applied */
+#define LED_MATRIX_ROW_VALUE(Row)       ((LED_MATRIX_ROW_ACTIVE == DIO_PIN_HIGH) ? (u8)(1 << (Row)) : \
+                                         (u8)(~(1 << (Row)) & LED_MATRIX_ROWS_MASK))
+#define LED_MATRIX_COLUMN_VALUE(Lit)    ((LED_MATRIX_COLUMN_ACTIVE == DIO_PIN_HIGH) ? (u8)(Lit) : \
+                                         (u8)(~(Lit) & LED_MATRIX_COLUMNS_MASK))
+#define LED_MATRIX_ALL_OFF              LED_MATRIX_COLUMN_VALUE(0)
+
+#endif
+
+/*
+ * Function: LED_MATRIX_voidBuildRow
+ * Description:
+ *     Recomputes the bus values of one row from its pixels. Each value is stored in one
+ *     byte write, so the tick never sees a half-updated value.
+ */
+static void LED_MATRIX_voidBuildRow(u8 Copy_u8Row)
+{
+	u8 Local_u8Bit;
+	u8 Local_u8Column;
+	u8 Local_u8Lit;
+
+	for(Local_u8Bit = 0; Local_u8Bit < LED_MATRIX_BAM_BITS; Local_u8Bit++)
+	{
+		Local_u8Lit = 0;
+
+		for(Local_u8Column = 0; Local_u8Column < LED_MATRIX_COLUMNS; Local_u8Column++)
+		{
+			/* Displayed level: top LED_MATRIX_BAM_BITS bits of the brightness */
+			if(GET_BIT(LED_MATRIX_Au8Pixel[Copy_u8Row][Local_u8Column] >> (8 - LED_MATRIX_BAM_BITS), Local_u8Bit))
+			{
+				SET_BIT(Local_u8Lit, Local_u8Column);
+			}
+		}
+
+#if LED_MATRIX_TYPE == LED_MATRIX_CHARLIEPLEX
+		/* Columns map to the pins other than the row pin */
+		Local_u8Lit = (Local_u8Lit & (u8)((1 << Copy_u8Row) - 1)) |
+		              (u8)((Local_u8Lit >> Copy_u8Row) << (Copy_u8Row + 1));
+		LED_MATRIX_Au8Plane[Copy_u8Row][Local_u8Bit] = Local_u8Lit | (u8)(1 << Copy_u8Row);
+#else
+		LED_MATRIX_Au8Plane[Copy_u8Row][Local_u8Bit] = LED_MATRIX_COLUMN_VALUE(Local_u8Lit);
+#endif
+	}
+}
+
+/*
+ * Function: LED_MATRIX_voidInit
+ * Description:
+ *     Row/column: rows and columns become outputs at their inactive levels.
+ *     Charlieplex: all pins become inputs without pull-up (every LED off).
+ */
+void LED_MATRIX_voidInit(void)
+{
+	u8 Local_u8Row;
+	u8 Local_u8Column;
+
+#if LED_MATRIX_TYPE == LED_MATRIX_CHARLIEPLEX
+	static const Dio_CHANNEL_NUM Local_AChannels[LED_MATRIX_CHARLIE_PINS_NUM] = LED_MATRIX_CHARLIE_CHANNELS;
+
+	DIO_initBus(&LED_MATRIX_strPins, Local_AChannels, LED_MATRIX_CHARLIE_PINS_NUM);
+	DIO_writeBus(&LED_MATRIX_strPins, LED_MATRIX_ALL_OFF);
+	DIO_writeBusDirection(&LED_MATRIX_strPins, LED_MATRIX_ALL_OFF);
+#else
+	static const Dio_CHANNEL_NUM Local_ARows[LED_MATRIX_ROWS_NUM] = LED_MATRIX_ROW_CHANNELS;
+	static const Dio_CHANNEL_NUM Local_AColumns[LED_MATRIX_COLUMNS_NUM] = LED_MATRIX_COLUMN_CHANNELS;
+
+	DIO_initBus(&LED_MATRIX_strRows, Local_ARows, LED_MATRIX_ROWS_NUM);
+	DIO_initBus(&LED_MATRIX_strColumns, Local_AColumns, LED_MATRIX_COLUMNS_NUM);
+	DIO_writeBus(&LED_MATRIX_strColumns, LED_MATRIX_ALL_OFF);
+	DIO_writeBus(&LED_MATRIX_strRows, (LED_MATRIX_ROW_ACTIVE == DIO_PIN_HIGH) ? 0 : LED_MATRIX_ROWS_MASK);
+	DIO_setBusDirection(&LED_MATRIX_strColumns, DIO_PIN_OUTPUT);
+	DIO_setBusDirection(&LED_MATRIX_strRows, DIO_PIN_OUTPUT);
+#endif
+
+	for(Local_u8Row = 0; Local_u8Row < LED_MATRIX_ROWS; Local_u8Row++)
+	{
+		for(Local_u8Column = 0; Local_u8Column < LED_MATRIX_COLUMNS; Local_u8Column++)
+		{
+			LED_MATRIX_Au8Pixel[Local_u8Row][Local_u8Column] = LED_MATRIX_BRIGHTNESS_OFF;
+		}
+		LED_MATRIX_voidBuildRow(Local_u8Row);
+	}
+
+	LED_MATRIX_u8Row = LED_MATRIX_ROWS - 1;
+	LED_MATRIX_u8Bit = LED_MATRIX_BAM_BITS - 1;
+	LED_MATRIX_u8TicksLeft = 1;
+}
+
+/*
+ * Function: LED_MATRIX_voidTick
+ * Description:
+ *     Brightness bit b stays on for 2^b ticks. After the last bit of a row the next row
+ *     is selected: the lit lines are blanked first so the previous row's pattern never
+ *     shows on the new row (ghosting). Charlieplex order: all pins low, directions, then
+ *     the row pin high; a new bit of the same row only changes the directions.
+ */
+void LED_MATRIX_voidTick(void)
+{
+	if(--LED_MATRIX_u8TicksLeft != 0)
+	{
+		return;
+	}
+
+	LED_MATRIX_u8Bit++;
+
+	if(LED_MATRIX_u8Bit >= LED_MATRIX_BAM_BITS)
+	{
+		LED_MATRIX_u8Bit = 0;
+		LED_MATRIX_u8Row++;
+		if(LED_MATRIX_u8Row >= LED_MATRIX_ROWS)
+		{
+			LED_MATRIX_u8Row = 0;
+		}
+
+#if LED_MATRIX_TYPE == LED_MATRIX_CHARLIEPLEX
+		DIO_writeBus(&LED_MATRIX_strPins, LED_MATRIX_ALL_OFF);
+		DIO_writeBusDirection(&LED_MATRIX_strPins, LED_MATRIX_Au8Plane[LED_MATRIX_u8Row][0]);
+		DIO_writeBus(&LED_MATRIX_strPins, LED_MATRIX_ROW_VALUE(LED_MATRIX_u8Row));
+#else
+		DIO_writeBus(&LED_MATRIX_strColumns, LED_MATRIX_ALL_OFF);
+		DIO_writeBus(&LED_MATRIX_strRows, LED_MATRIX_ROW_VALUE(LED_MATRIX_u8Row));
+		DIO_writeBus(&LED_MATRIX_strColumns, LED_MATRIX_Au8Plane[LED_MATRIX_u8Row][0]);
+#endif
+	}
+	else
+	{
+#if LED_MATRIX_TYPE == LED_MATRIX_CHARLIEPLEX
+		DIO_writeBusDirection(&LED_MATRIX_strPins, LED_MATRIX_Au8Plane[LED_MATRIX_u8Row][LED_MATRIX_u8Bit]);
+#else
+		DIO_writeBus(&LED_MATRIX_strColumns, LED_MATRIX_Au8Plane[LED_MATRIX_u8Row][LED_MATRIX_u8Bit]);
+#endif
+	}
+
+	LED_MATRIX_u8TicksLeft = (u8)(1 << LED_MATRIX_u8Bit);
+}
+
+/*
+ * Function: LED_MATRIX_voidSetPixel
+ * Description:
+ *     Stores the brightness and rebuilds the row's bus values.
+ */
+void LED_MATRIX_voidSetPixel(u8 Copy_u8Row, u8 Copy_u8Column, u8 Copy_u8Brightness)
+{
+	if((Copy_u8Row >= LED_MATRIX_ROWS) || (Copy_u8Column >= LED_MATRIX_COLUMNS))
+	{
+		return;
+	}
+
+	LED_MATRIX_Au8Pixel[Copy_u8Row][Copy_u8Column] = Copy_u8Brightness;
+	LED_MATRIX_voidBuildRow(Copy_u8Row);
+}
+
+/*
+ * Function: LED_MATRIX_u8GetPixel
+ * Description:
+ *     Reads the framebuffer.
+ */
+u8 LED_MATRIX_u8GetPixel(u8 Copy_u8Row, u8 Copy_u8Column)
+{
+	if((Copy_u8Row >= LED_MATRIX_ROWS) || (Copy_u8Column >= LED_MATRIX_COLUMNS))
+	{
+		return LED_MATRIX_BRIGHTNESS_OFF;
+	}
+
+	return LED_MATRIX_Au8Pixel[Copy_u8Row][Copy_u8Column];
+}
+
+/*
+ * Function: LED_MATRIX_voidSetRow
+ * Description:
+ *     Stores a whole row, then rebuilds its bus values once.
+ */
+void LED_MATRIX_voidSetRow(u8 Copy_u8Row, u8 Copy_u8Bitmap, u8 Copy_u8Brightness)
+{
+	u8 Local_u8Column;
+
+	if(Copy_u8Row >= LED_MATRIX_ROWS)
+	{
+		return;
+	}
+
+	for(Local_u8Column = 0; Local_u8Column < LED_MATRIX_COLUMNS; Local_u8Column++)
+	{
+		LED_MATRIX_Au8Pixel[Copy_u8Row][Local_u8Column] =
+			GET_BIT(Copy_u8Bitmap, Local_u8Column) ? Copy_u8Brightness : LED_MATRIX_BRIGHTNESS_OFF;
+	}
+
+	LED_MATRIX_voidBuildRow(Copy_u8Row);
+}
+
+/*
+ * Function: LED_MATRIX_voidClear
+ * Description:
+ *     Turns every pixel off.
+ */
+void LED_MATRIX_voidClear(void)
+{
+	u8 Local_u8Row;
+
+	for(Local_u8Row = 0; Local_u8Row < LED_MATRIX_ROWS; Local_u8Row++)
+	{
+		LED_MATRIX_voidSetRow(Local_u8Row, 0, LED_MATRIX_BRIGHTNESS_OFF);
+	}
+}
@@ -0,0 +1,79 @@
+/*
+ * LM35_test.c
+ *
+ *  Created on: Nov 10, 2023
+ *      Author: elara
+ */
+
+#include <util/delay.h>
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+#include "../../MCAL/DIO/DIO_interface.h"
+#include "../../MCAL/DIO/DIO_private.h"
+#include "../../MCAL/ADC/ADC_config.h"
+#include "../../MCAL/ADC/ADC_interface.h"
+#include "../../MCAL/ADC/ADC_private.h"
+#include "./LM35_config.h"
+#include "./LM35_interface.h"
+#include "./LM35_private.h"
+#include "../LCD_4x20/LCD_interface.h"
+#include "../LCD_4x20/LCD_private.h"
+#include "../LCD_4x20/LCD_config.h"
+#include "../SEV_SEG/SEV_SEG_config.h"
+#include "../SEV_SEG/SEV_SEG_interface.h"
+#include "../SEV_SEG/SEV_SEG_private.h"
+
+#if LCD_SHARED_BUS == LCD_ENABLED
+/* LCD and seven-segment display share their pins: both run through the bus arbiter */
+#include <avr/interrupt.h>
+#include "../../MCAL/TIMER/TIMER_interface.h"
+#include "../BUS_ARB/BUS_ARB_interface.h"
+#endif
+
+int main(void)
+{
+    /* Initialize modules */
+    LM35_voidInit();          // Initialize LM35
+#if LCD_SHARED_BUS == LCD_ENABLED
+    BUS_ARB_voidInit();       // Shared pins: 7-segment refresh and LCD slots from the tick
+    TIMER0_voidSetCallBack(BUS_ARB_voidTick);
+    TIMER0_voidInitTick();
+    sei();
+    /*	4 bit-mode initialization	*/
+    LCD_voidInit();
+#else
+    SEV_SEG_voidInitialize(); // Initialize 7-segment display
+    /*	4 bit-mode initialization (pins shared with the 7-segment display: set LCD_SHARED_BUS) */
+   // LCD_voidInit();
+#endif
+
+    f32 temp;
+    u16 displayValue;
+
+    while (1) {
+        // Read temperature from LM35
+        temp = LM35_f32GetTemperature();
+
+        // Convert the temperature to a 4-digit number for display
+        // For example, 26.4 becomes 0264, 27.1 becomes 0271
+        displayValue = (u16)(temp * 10); // Multiply by 10 to shift decimal one place to the right
+
+#if LCD_SHARED_BUS == LCD_ENABLED
+        // Display this value on the 7-segment display (refreshed by the tick) and the LCD
+        BUS_ARB_voidSetNumber(displayValue);
+        LCD_voidGoTo(LCD_LINE_ONE, 0);
+        LCD_voidWriteString((u8*)"Temp: ");
+        LCD_voidDisplayFloat(temp);
+        LCD_voidWriteString((u8*)" C  ");
+#else
+        // Display this value on the 7-segment display
+        SEV_SEG_voidDisplayNumber(displayValue);
+#endif
+
+
+        // Refresh reading every 100ms
+        _delay_ms(1000);
+    }
+
+    return 0;
+}
@@ -7,6 +7,8 @@
  *     It includes definitions for the Binary Coded Decimal (BCD) pins connected to a BCD decoder and the common pins
  *     for the individual seven-segment displays. These definitions are crucial for the internal workings of the SEV_SEG
  *     module and should not be accessed directly by other modules or applications.
+ *     With DIO_PIN_MAP_GENERATED (DIO_config.h) the build fails unless the pins match the
+ *     SEV_SEG lines of the board pin map (PINMAP/pinmap.txt).
  *
  * Author: [Your Name]
  * Date: [Specify Date Here]
@@ -22,6 +24,16 @@
 #define SEV_SEG_BCD_PIN_C      DIO_PIN2  // BCD Pin C connected to PB2
 #define SEV_SEG_BCD_PIN_D      DIO_PIN4  // BCD Pin D connected to PB4
 
+/* Mask of the BCD pins within PORTB, and the PORTB image of a BCD digit. */
+/* Used to update all four BCD lines with one masked port write. */
+#define SEV_SEG_BCD_MASK       ((1 << SEV_SEG_BCD_PIN_A) | (1 << SEV_SEG_BCD_PIN_B) | \
+                                (1 << SEV_SEG_BCD_PIN_C) | (1 << SEV_SEG_BCD_PIN_D))
+
+#define SEV_SEG_BCD_TO_PORT(Number) ((GET_BIT((Number), 0) << SEV_SEG_BCD_PIN_A) | \
+                                     (GET_BIT((Number), 1) << SEV_SEG_BCD_PIN_B) | \
+                                     (GET_BIT((Number), 2) << SEV_SEG_BCD_PIN_C) | \
+                                     (GET_BIT((Number), 3) << SEV_SEG_BCD_PIN_D))
+
 /* Define the Common pins for the 7-segment displays. */
 /* These pins are used to control which digit is active in a multi-digit display setup. */
 #define SEV_SEG_COM_PIN_1      DIO_PIN3  // Common Pin 1 connected to PA3
@@ -29,4 +41,8 @@
 #define SEV_SEG_COM_PIN_3      DIO_PIN5  // Common Pin 3 connected to PB5
 #define SEV_SEG_COM_PIN_4      DIO_PIN6  // Common Pin 4 connected to PB6
 
+/* Masks of the Common pins within PORTA and PORTB, used to disable all digits at once. */
+#define SEV_SEG_COM_PORTA_MASK ((1 << SEV_SEG_COM_PIN_1) | (1 << SEV_SEG_COM_PIN_2))
+#define SEV_SEG_COM_PORTB_MASK ((1 << SEV_SEG_COM_PIN_3) | (1 << SEV_SEG_COM_PIN_4))
+
 #endif /* SEV_SEG_PRIVATE_H_ */
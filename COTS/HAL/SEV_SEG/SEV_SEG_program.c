@@ -21,12 +21,26 @@
 /* MCAL */
 #include "../../MCAL/DIO/DIO_interface.h"  // DIO interface for controlling digital input/output
 #include "../../MCAL/DIO/DIO_private.h"    // Private definitions and macros for DIO module (internal use)
+#include "../../MCAL/DIO/DIO_config.h"     // DIO configuration (pin map source)
 
 /* SEV_SEG Module Configuration */
 #include "../SEV_SEG/SEV_SEG_config.h"     // Configuration settings for the Seven Segment Display
 #include "../SEV_SEG/SEV_SEG_interface.h"  // Interface definitions for the Seven Segment Display
 #include "../SEV_SEG/SEV_SEG_private.h"    // Private definitions and macros for SEV_SEG module (internal use)
 
+/* With the generated pin map, the pins of SEV_SEG_private.h must be the ones of PINMAP/pinmap.txt */
+#if DIO_PIN_MAP == DIO_PIN_MAP_GENERATED
+#if (DIO_PIN_ID(DIO_PORTB, SEV_SEG_BCD_PIN_A) != PINMAP_SEV_SEG_BCD_A_ID) || (DIO_PIN_ID(DIO_PORTB, SEV_SEG_BCD_PIN_B) != PINMAP_SEV_SEG_BCD_B_ID) || \
+    (DIO_PIN_ID(DIO_PORTB, SEV_SEG_BCD_PIN_C) != PINMAP_SEV_SEG_BCD_C_ID) || (DIO_PIN_ID(DIO_PORTB, SEV_SEG_BCD_PIN_D) != PINMAP_SEV_SEG_BCD_D_ID)
+#error "SEV_SEG: BCD pins do not match the pin map"
+#endif
+
+#if (DIO_PIN_ID(DIO_PORTA, SEV_SEG_COM_PIN_1) != PINMAP_SEV_SEG_COM_1_ID) || (DIO_PIN_ID(DIO_PORTA, SEV_SEG_COM_PIN_2) != PINMAP_SEV_SEG_COM_2_ID) || \
+    (DIO_PIN_ID(DIO_PORTB, SEV_SEG_COM_PIN_3) != PINMAP_SEV_SEG_COM_3_ID) || (DIO_PIN_ID(DIO_PORTB, SEV_SEG_COM_PIN_4) != PINMAP_SEV_SEG_COM_4_ID)
+#error "SEV_SEG: common pins do not match the pin map"
+#endif
+#endif /* DIO_PIN_MAP */
+
 /*
  * Function: SEV_SEG_voidInitialize
  * Description:
@@ -63,11 +77,8 @@ void SEV_SEG_voidDisplayDigit(u8 digit, u8 number) {
         return; // Invalid number, do nothing
     }
 
-    // Set the BCD pins based on the number
-    DIO_setPinValue(DIO_PORTB, SEV_SEG_BCD_PIN_A, GET_BIT(number, 0));
-    DIO_setPinValue(DIO_PORTB, SEV_SEG_BCD_PIN_B, GET_BIT(number, 1));
-    DIO_setPinValue(DIO_PORTB, SEV_SEG_BCD_PIN_C, GET_BIT(number, 2));
-    DIO_setPinValue(DIO_PORTB, SEV_SEG_BCD_PIN_D, GET_BIT(number, 3));
+    // Set the BCD pins based on the number (all four lines change together)
+    DIO_writePortMasked(DIO_PORTB, SEV_SEG_BCD_MASK, SEV_SEG_BCD_TO_PORT(number));
 
     // Activate the specific digit
     switch (digit) {
@@ -125,8 +136,6 @@ void SEV_SEG_voidDisplayNumber(u16 number) {
  */
 void SEV_SEG_voidDisableDisplay(void) {
     /* Disable all displays */
-    DIO_setPinValue(DIO_PORTA, SEV_SEG_COM_PIN_1, DIO_PIN_HIGH);
-    DIO_setPinValue(DIO_PORTA, SEV_SEG_COM_PIN_2, DIO_PIN_HIGH);
-    DIO_setPinValue(DIO_PORTB, SEV_SEG_COM_PIN_3, DIO_PIN_HIGH);
-    DIO_setPinValue(DIO_PORTB, SEV_SEG_COM_PIN_4, DIO_PIN_HIGH);
+    DIO_setPortMask(DIO_PORTA, SEV_SEG_COM_PORTA_MASK);
+    DIO_setPortMask(DIO_PORTB, SEV_SEG_COM_PORTB_MASK);
 }
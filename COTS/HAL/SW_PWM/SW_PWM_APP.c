@@ -0,0 +1,102 @@
+/*
+ * File: SW_PWM_APP.c
+ *
+ * Description:
+ *     Test file for the software PWM (SW_PWM) module on an AVR ATmega32 engineering kit.
+ *
+ *     Test Set 1 (benchmark, with SW_PWM_MEASURE_ISR_CYCLES enabled): measures the cycles
+ *     spent in the PWM interrupts per period while 0..SW_PWM_CHANNELS_NUM channels run
+ *     with distinct duties, then with all channels sharing one duty. The results are
+ *     stored in SW_PWM_Au16BenchCycles for reading with the debugger.
+ *     Test Set 2: fades the kit LEDs in and out with phase-shifted duties.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <avr/interrupt.h>
+#include <util/delay.h>
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../../MCAL/DIO/DIO_interface.h"
+
+/* HAL */
+#include "./SW_PWM_interface.h"
+#include "./SW_PWM_private.h"
+#include "./SW_PWM_config.h"
+
+/*
+ * Timer1 control register: Timer1 counts CPU cycles (no prescaling) for the ISR
+ * measurement. Defined locally because this test file has no dependency on a timer driver.
+ */
+#define TCCR1B         HW_REG8(0x4E)
+
+/*
+ * Test Set 1 results: PWM interrupt cycles per period, indexed as
+ *   [0 .. SW_PWM_CHANNELS_NUM]   number of channels running with distinct duties
+ *   [SW_PWM_CHANNELS_NUM + 1]    all channels running with the same duty
+ */
+volatile u16 SW_PWM_Au16BenchCycles[SW_PWM_CHANNELS_NUM + 2];
+
+int main(void)
+{
+	u8 Local_Au8Duty[SW_PWM_CHANNELS_NUM];
+	u8 Local_u8Channel;
+	u8 Local_u8Step = 0;
+
+	SW_PWM_voidInit();
+	sei();
+
+	/* Test Set 1: ISR cycles versus number of channels */
+#if SW_PWM_MEASURE_ISR_CYCLES == SW_PWM_ENABLED
+	{
+		u8 Local_u8Active;
+
+		TCCR1B = 1;
+
+		for(Local_u8Active = 0; Local_u8Active <= SW_PWM_CHANNELS_NUM; Local_u8Active++)
+		{
+			for(Local_u8Channel = 0; Local_u8Channel < SW_PWM_CHANNELS_NUM; Local_u8Channel++)
+			{
+				/* Distinct duties spread over the period, remaining channels off */
+				Local_Au8Duty[Local_u8Channel] = (Local_u8Channel < Local_u8Active) ? (u8)(32 + 48 * Local_u8Channel) : 0;
+			}
+			SW_PWM_voidSetAllDuties(Local_Au8Duty);
+
+			_delay_ms(10);   // Several periods: the new schedule is active and measured
+			SW_PWM_Au16BenchCycles[Local_u8Active] = SW_PWM_u16GetIsrCycles();
+		}
+
+		for(Local_u8Channel = 0; Local_u8Channel < SW_PWM_CHANNELS_NUM; Local_u8Channel++)
+		{
+			Local_Au8Duty[Local_u8Channel] = 128;
+		}
+		SW_PWM_voidSetAllDuties(Local_Au8Duty);
+		_delay_ms(10);
+		SW_PWM_Au16BenchCycles[SW_PWM_CHANNELS_NUM + 1] = SW_PWM_u16GetIsrCycles();
+	}
+#endif
+
+	/* Test Set 2: phase-shifted fading */
+	while(1)
+	{
+		for(Local_u8Channel = 0; Local_u8Channel < SW_PWM_CHANNELS_NUM; Local_u8Channel++)
+		{
+			u8 Local_u8Phase = Local_u8Step + Local_u8Channel * (256 / SW_PWM_CHANNELS_NUM);
+
+			/* Triangle wave 0..254..0 */
+			Local_Au8Duty[Local_u8Channel] = (Local_u8Phase < 128) ? (u8)(Local_u8Phase * 2) : (u8)((255 - Local_u8Phase) * 2);
+		}
+		SW_PWM_voidSetAllDuties(Local_Au8Duty);
+
+		Local_u8Step++;
+		_delay_ms(8);
+	}
+
+	return 0;
+}
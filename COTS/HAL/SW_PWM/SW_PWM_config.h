@@ -0,0 +1,35 @@
+/*
+ * File: SW_PWM_config.h
+ *
+ * Description:
+ *     Configuration header file for the software PWM (SW_PWM) module for AVR ATmega32.
+ *
+ * Usage:
+ *     - SW_PWM_CHANNELS / SW_PWM_CHANNELS_NUM: DIO channels driven by the PWM engine,
+ *       addressed by their index in the list (0 .. SW_PWM_CHANNELS_NUM-1).
+ *     - SW_PWM_PRESCALER: Timer2 clock. One PWM period is 256 Timer2 counts, e.g.
+ *       SW_PWM_PRESCALER_64 at 8 MHz gives 8 us steps and a 2.048 ms (488 Hz) period.
+ *       The step must stay longer than the compare ISR (about 60 cycles), so
+ *       SW_PWM_PRESCALER_32 is the fastest usable setting at 8 MHz.
+ *     - SW_PWM_MEASURE_ISR_CYCLES: SW_PWM_ENABLED accumulates the cycles spent in the PWM
+ *       interrupts of each period, read with SW_PWM_u16GetIsrCycles. Requires Timer1 to
+ *       run from the undivided CPU clock (TCCR1B = 1), as set up by SW_PWM_APP.c.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef SW_PWM_CONFIG_H_
+#define SW_PWM_CONFIG_H_
+
+/* PWM outputs: the kit LEDs */
+#define SW_PWM_CHANNELS               {Dio_PINA_4, Dio_PINA_5, Dio_PINA_6, Dio_PINB_7}
+#define SW_PWM_CHANNELS_NUM           4
+
+/* Timer2 clock */
+#define SW_PWM_PRESCALER              SW_PWM_PRESCALER_64
+
+/* ISR cycle measurement */
+#define SW_PWM_MEASURE_ISR_CYCLES     SW_PWM_DISABLED
+
+#endif /* SW_PWM_CONFIG_H_ */
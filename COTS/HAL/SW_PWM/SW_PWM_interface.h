@@ -0,0 +1,56 @@
+/*
+ * File: SW_PWM_interface.h
+ *
+ * Description:
+ *     Header file for the software PWM (SW_PWM) module for AVR ATmega32.
+ *     Drives the DIO channels listed in SW_PWM_config.h with 8-bit duty cycles from the
+ *     Timer2 interrupts, using a sorted edge schedule (see SW_PWM_private.h).
+ *
+ *     Duty updates are double buffered: a new schedule is built in the back buffer and
+ *     swapped in by the overflow interrupt at the next period start, so a period is never
+ *     produced from a half-updated schedule.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef SW_PWM_INTERFACE_H_
+#define SW_PWM_INTERFACE_H_
+
+/* Function: SW_PWM_voidInit
+ * Description:
+ *     Configures the PWM channels as outputs (low), clears all duties and starts Timer2
+ *     with its overflow and compare interrupts. Global interrupts are enabled by the application.
+ */
+void SW_PWM_voidInit(void);
+
+/* Function: SW_PWM_voidSetDuty
+ * Description:
+ *     Sets the duty of one channel: 0 = always low, 255 = always high, otherwise high for
+ *     Duty/256 of the period. Takes effect at the next period start. Invalid channels are ignored.
+ *     Must not be called from an interrupt.
+ */
+void SW_PWM_voidSetDuty(u8 Copy_u8Channel, u8 Copy_u8Duty);
+
+/* Function: SW_PWM_voidSetAllDuties
+ * Description:
+ *     Sets the duties of all channels from an array of SW_PWM_CHANNELS_NUM values with a
+ *     single schedule rebuild, so they all change in the same period.
+ */
+void SW_PWM_voidSetAllDuties(const u8* Copy_pu8Duties);
+
+/* Function: SW_PWM_voidStop
+ * Description:
+ *     Stops Timer2, disables its interrupts and drives all PWM channels low.
+ */
+void SW_PWM_voidStop(void);
+
+/* Function: SW_PWM_u16GetIsrCycles
+ * Description:
+ *     Returns the CPU cycles spent in the PWM interrupts during the last complete period
+ *     (without the interrupt entry/exit code). Only with SW_PWM_MEASURE_ISR_CYCLES enabled;
+ *     returns 0 otherwise.
+ */
+u16 SW_PWM_u16GetIsrCycles(void);
+
+#endif /* SW_PWM_INTERFACE_H_ */
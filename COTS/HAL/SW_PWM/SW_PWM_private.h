@@ -0,0 +1,58 @@
+/*
+ * File: SW_PWM_private.h
+ *
+ * Description:
+ *     Private header file for the software PWM (SW_PWM) module for AVR ATmega32.
+ *     Timer2 registers, configuration values and the edge schedule used by the ISRs.
+ *
+ * Edge Schedule:
+ *     Timer2 runs freely over 0..255; one overflow is one PWM period. At the overflow all
+ *     channels with a non-zero duty are set (one write per port). The channels are then
+ *     cleared in ascending duty order: channels sharing a duty value share one edge, and
+ *     OCR2 is moved from edge to edge. A period therefore costs one interrupt and one write
+ *     per port per distinct duty value, whatever the number of channels.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef SW_PWM_PRIVATE_H_
+#define SW_PWM_PRIVATE_H_
+
+/* Timer2 Registers */
+#define TCCR2          HW_REG8(0x45)
+#define TCNT2          HW_REG8(0x44)
+#define OCR2           HW_REG8(0x43)
+#define TIMSK          HW_REG8(0x59)
+#define TIFR           HW_REG8(0x58)
+
+/* Timer1 counter, used as cycle counter by the ISR measurement */
+#define TCNT1          HW_REG16(0x4C)
+
+/* TIMSK / TIFR Bits */
+#define TIMSK_TOIE2    6
+#define TIMSK_OCIE2    7
+#define TIFR_TOV2      6
+#define TIFR_OCF2      7
+
+/* Timer2 Clock Select values (CS22:0) */
+#define SW_PWM_PRESCALER_1       1
+#define SW_PWM_PRESCALER_8       2
+#define SW_PWM_PRESCALER_32      3
+#define SW_PWM_PRESCALER_64      4
+#define SW_PWM_PRESCALER_128     5
+#define SW_PWM_PRESCALER_256     6
+#define SW_PWM_PRESCALER_1024    7
+
+/* Options */
+#define SW_PWM_DISABLED          0
+#define SW_PWM_ENABLED           1
+
+/* Duty values that need no clear edge */
+#define SW_PWM_DUTY_OFF          0
+#define SW_PWM_DUTY_FULL         255
+
+/* Ports addressed by the schedule masks */
+#define SW_PWM_PORTS_NUM         4
+
+#endif /* SW_PWM_PRIVATE_H_ */
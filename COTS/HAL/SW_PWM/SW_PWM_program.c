@@ -0,0 +1,376 @@
+/*
+ * File: SW_PWM_program.c
+ *
+ * Description:
+ *     Implementation of the software PWM (SW_PWM) module for AVR ATmega32.
+ *     The schedules are built in the main context; the Timer2 interrupts only walk the
+ *     active schedule and write the precomputed port masks.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <avr/interrupt.h>
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../../MCAL/DIO/DIO_interface.h"
+#include "../../MCAL/DIO/DIO_private.h"
+#include "../../MCAL/DIO/DIO_config.h"
+
+/* HAL */
+#include "./SW_PWM_interface.h"
+#include "./SW_PWM_private.h"
+#include "./SW_PWM_config.h"
+
+/* Edge schedule of one PWM period (see SW_PWM_private.h) */
+typedef struct
+{
+	u8 EdgeCount;                                            /* Number of clear edges */
+	u8 SetMask[SW_PWM_PORTS_NUM];                            /* Pins set at the period start */
+	u8 EdgeTime[SW_PWM_CHANNELS_NUM];                        /* Timer2 count of each edge, ascending */
+	u8 EdgeClearMask[SW_PWM_CHANNELS_NUM][SW_PWM_PORTS_NUM]; /* Pins cleared by each edge */
+} SwPwm_SCHEDULE;
+
+/*
+ * Port update from the ISRs: PORTx = (PORTx & Keep) | Set. With DIO shadow registers the
+ * shadow is updated as well so later DIO writes keep the PWM levels. In immediate mode the
+ * shadow equals the register, so it is written from the shadow without reading the port;
+ * in deferred mode only the PWM bits may be written now, other pending bits stay pending.
+ */
+#if DIO_SHADOW_MODE == DIO_SHADOW_DISABLED
+#define SW_PWM_PORT_UPDATE(PortId, Keep, Set)                                                  \
+	(DIO_PORT_REG(PortId) = (DIO_PORT_REG(PortId) & (Keep)) | (Set))
+#elif DIO_SHADOW_MODE == DIO_SHADOW_IMMEDIATE
+#define SW_PWM_PORT_UPDATE(PortId, Keep, Set)                                                  \
+	(DIO_PORT_REG(PortId) = DIO_Au8PortShadow[PortId] = (DIO_Au8PortShadow[PortId] & (Keep)) | (Set))
+#else
+#define SW_PWM_PORT_UPDATE(PortId, Keep, Set)                                                  \
+	(DIO_Au8PortShadow[PortId] = (DIO_Au8PortShadow[PortId] & (Keep)) | (Set),                 \
+	 DIO_PORT_REG(PortId) = (DIO_PORT_REG(PortId) & (Keep)) | (Set))
+#endif
+
+/* Private Function Prototypes */
+static void SW_PWM_voidPublish(void);
+static inline void SW_PWM_voidRunEdges(void);
+
+static const Dio_CHANNEL_NUM SW_PWM_AChannels[SW_PWM_CHANNELS_NUM] = SW_PWM_CHANNELS;
+
+/* Pins of each port owned by the PWM engine */
+static u8 SW_PWM_Au8ChannelMask[SW_PWM_PORTS_NUM];
+
+/* Requested duties, main context only */
+static u8 SW_PWM_Au8Duty[SW_PWM_CHANNELS_NUM];
+
+/*
+ * Double-buffered schedules: the ISRs use SW_PWM_ASchedule[SW_PWM_u8Active]; the main
+ * context builds the other one and sets SW_PWM_u8Pending, and the overflow ISR swaps
+ * them at the next period start. The main context only touches the back buffer while
+ * SW_PWM_u8Pending is clear, so the ISR never swaps in a half-built schedule.
+ */
+static SwPwm_SCHEDULE SW_PWM_ASchedule[2];
+static volatile u8 SW_PWM_u8Active;
+static volatile u8 SW_PWM_u8Pending;
+
+/* Next edge of the active schedule, ISR only */
+static u8 SW_PWM_u8NextEdge;
+
+#if SW_PWM_MEASURE_ISR_CYCLES == SW_PWM_ENABLED
+static u16 SW_PWM_u16CycleSum;
+static volatile u16 SW_PWM_u16PeriodCycles;
+#endif
+
+/*
+ * Function: SW_PWM_voidInit
+ * Description:
+ *     Computes the channel masks, drives the channels low as outputs, publishes an empty
+ *     schedule and starts Timer2 in normal mode with both interrupts.
+ * Returns: void
+ */
+void SW_PWM_voidInit(void)
+{
+	u8 Local_u8Channel;
+	u8 Local_u8PortId;
+
+	TCCR2 = 0;
+
+	for(Local_u8PortId = 0; Local_u8PortId < SW_PWM_PORTS_NUM; Local_u8PortId++)
+	{
+		SW_PWM_Au8ChannelMask[Local_u8PortId] = 0;
+	}
+
+	for(Local_u8Channel = 0; Local_u8Channel < SW_PWM_CHANNELS_NUM; Local_u8Channel++)
+	{
+		SET_BIT(SW_PWM_Au8ChannelMask[SW_PWM_AChannels[Local_u8Channel] / 8], SW_PWM_AChannels[Local_u8Channel] % 8);
+		SW_PWM_Au8Duty[Local_u8Channel] = SW_PWM_DUTY_OFF;
+	}
+
+	for(Local_u8PortId = 0; Local_u8PortId < SW_PWM_PORTS_NUM; Local_u8PortId++)
+	{
+		if(SW_PWM_Au8ChannelMask[Local_u8PortId] != 0)
+		{
+			DIO_writePortMasked(Local_u8PortId, SW_PWM_Au8ChannelMask[Local_u8PortId], DIO_PORT_LOW);
+			DIO_writePortDirectionMasked(Local_u8PortId, SW_PWM_Au8ChannelMask[Local_u8PortId], DIO_PORT_OUTPUT);
+		}
+	}
+
+	SW_PWM_u8Active = 0;
+	SW_PWM_u8Pending = 0;
+	SW_PWM_u8NextEdge = 0;
+	SW_PWM_ASchedule[0].EdgeCount = 0;
+	for(Local_u8PortId = 0; Local_u8PortId < SW_PWM_PORTS_NUM; Local_u8PortId++)
+	{
+		SW_PWM_ASchedule[0].SetMask[Local_u8PortId] = 0;
+	}
+
+	TCNT2 = 0;
+	TIFR = (1 << TIFR_TOV2) | (1 << TIFR_OCF2);   // Flags are cleared by writing one
+	SET_BIT(TIMSK, TIMSK_TOIE2);
+	SET_BIT(TIMSK, TIMSK_OCIE2);
+	TCCR2 = SW_PWM_PRESCALER;
+}
+
+/*
+ * Function: SW_PWM_voidSetDuty
+ * Description:
+ *     Stores the duty of one channel and publishes the rebuilt schedule.
+ * Parameters:
+ *     - Copy_u8Channel: Index of the channel in SW_PWM_CHANNELS.
+ *     - Copy_u8Duty: Duty from 0 (off) to 255 (on).
+ * Returns: void
+ */
+void SW_PWM_voidSetDuty(u8 Copy_u8Channel, u8 Copy_u8Duty)
+{
+	if(Copy_u8Channel < SW_PWM_CHANNELS_NUM)
+	{
+		SW_PWM_Au8Duty[Copy_u8Channel] = Copy_u8Duty;
+		SW_PWM_voidPublish();
+	}
+}
+
+/*
+ * Function: SW_PWM_voidSetAllDuties
+ * Description:
+ *     Stores the duties of all channels and publishes the rebuilt schedule once.
+ * Parameters:
+ *     - Copy_pu8Duties: Array of SW_PWM_CHANNELS_NUM duties.
+ * Returns: void
+ */
+void SW_PWM_voidSetAllDuties(const u8* Copy_pu8Duties)
+{
+	u8 Local_u8Channel;
+
+	if(Copy_pu8Duties != NULL)
+	{
+		for(Local_u8Channel = 0; Local_u8Channel < SW_PWM_CHANNELS_NUM; Local_u8Channel++)
+		{
+			SW_PWM_Au8Duty[Local_u8Channel] = Copy_pu8Duties[Local_u8Channel];
+		}
+		SW_PWM_voidPublish();
+	}
+}
+
+/*
+ * Function: SW_PWM_voidStop
+ * Description:
+ *     Stops Timer2 and its interrupts, then drives all PWM channels low.
+ * Returns: void
+ */
+void SW_PWM_voidStop(void)
+{
+	u8 Local_u8PortId;
+
+	TCCR2 = 0;
+	CLR_BIT(TIMSK, TIMSK_TOIE2);
+	CLR_BIT(TIMSK, TIMSK_OCIE2);
+
+	for(Local_u8PortId = 0; Local_u8PortId < SW_PWM_PORTS_NUM; Local_u8PortId++)
+	{
+		if(SW_PWM_Au8ChannelMask[Local_u8PortId] != 0)
+		{
+			DIO_writePortMasked(Local_u8PortId, SW_PWM_Au8ChannelMask[Local_u8PortId], DIO_PORT_LOW);
+		}
+	}
+}
+
+/*
+ * Function: SW_PWM_u16GetIsrCycles
+ * Description:
+ *     Returns the ISR cycles of the last complete period when the measurement is enabled.
+ */
+u16 SW_PWM_u16GetIsrCycles(void)
+{
+#if SW_PWM_MEASURE_ISR_CYCLES == SW_PWM_ENABLED
+	u16 Local_u16Cycles;
+
+	do
+	{
+		Local_u16Cycles = SW_PWM_u16PeriodCycles;
+	} while(Local_u16Cycles != SW_PWM_u16PeriodCycles);
+
+	return Local_u16Cycles;
+#else
+	return 0;
+#endif
+}
+
+/*
+ * Function: SW_PWM_voidPublish
+ * Description:
+ *     Builds the schedule of the current duties in the back buffer: the set masks, and one
+ *     clear edge per distinct duty, kept in ascending order by insertion. Then marks it
+ *     pending for the overflow ISR.
+ */
+static void SW_PWM_voidPublish(void)
+{
+	SwPwm_SCHEDULE* Local_pSchedule;
+	u8 Local_u8Channel;
+	u8 Local_u8PortId;
+
+	/* Withdraw a pending schedule first: with no pending flag the ISR cannot swap, so
+	   the back buffer stays the back buffer while it is rebuilt */
+	SW_PWM_u8Pending = 0;
+	Local_pSchedule = &SW_PWM_ASchedule[SW_PWM_u8Active ^ 1];
+
+	Local_pSchedule->EdgeCount = 0;
+	for(Local_u8PortId = 0; Local_u8PortId < SW_PWM_PORTS_NUM; Local_u8PortId++)
+	{
+		Local_pSchedule->SetMask[Local_u8PortId] = 0;
+	}
+
+	for(Local_u8Channel = 0; Local_u8Channel < SW_PWM_CHANNELS_NUM; Local_u8Channel++)
+	{
+		u8 Local_u8Duty = SW_PWM_Au8Duty[Local_u8Channel];
+		u8 Local_u8ChannelPort = SW_PWM_AChannels[Local_u8Channel] / 8;
+		u8 Local_u8PinMask = 1 << (SW_PWM_AChannels[Local_u8Channel] % 8);
+		u8 Local_u8Edge;
+
+		if(Local_u8Duty == SW_PWM_DUTY_OFF)
+		{
+			continue;
+		}
+
+		Local_pSchedule->SetMask[Local_u8ChannelPort] |= Local_u8PinMask;
+
+		if(Local_u8Duty == SW_PWM_DUTY_FULL)
+		{
+			continue;
+		}
+
+		/* Find the edge of this duty, or the position where it belongs */
+		for(Local_u8Edge = 0; Local_u8Edge < Local_pSchedule->EdgeCount; Local_u8Edge++)
+		{
+			if(Local_pSchedule->EdgeTime[Local_u8Edge] >= Local_u8Duty)
+			{
+				break;
+			}
+		}
+
+		if((Local_u8Edge == Local_pSchedule->EdgeCount) || (Local_pSchedule->EdgeTime[Local_u8Edge] != Local_u8Duty))
+		{
+			u8 Local_u8Move;
+			u8 Local_u8Port;
+
+			/* Open a new edge at Local_u8Edge */
+			for(Local_u8Move = Local_pSchedule->EdgeCount; Local_u8Move > Local_u8Edge; Local_u8Move--)
+			{
+				Local_pSchedule->EdgeTime[Local_u8Move] = Local_pSchedule->EdgeTime[Local_u8Move - 1];
+				for(Local_u8Port = 0; Local_u8Port < SW_PWM_PORTS_NUM; Local_u8Port++)
+				{
+					Local_pSchedule->EdgeClearMask[Local_u8Move][Local_u8Port] = Local_pSchedule->EdgeClearMask[Local_u8Move - 1][Local_u8Port];
+				}
+			}
+
+			Local_pSchedule->EdgeTime[Local_u8Edge] = Local_u8Duty;
+			for(Local_u8Port = 0; Local_u8Port < SW_PWM_PORTS_NUM; Local_u8Port++)
+			{
+				Local_pSchedule->EdgeClearMask[Local_u8Edge][Local_u8Port] = 0;
+			}
+			Local_pSchedule->EdgeCount++;
+		}
+
+		Local_pSchedule->EdgeClearMask[Local_u8Edge][Local_u8ChannelPort] |= Local_u8PinMask;
+	}
+
+	SW_PWM_u8Pending = 1;
+}
+
+/*
+ * Function: SW_PWM_voidRunEdges
+ * Description:
+ *     Applies every edge of the active schedule that is due or too close to be scheduled
+ *     (within one Timer2 count), then programs OCR2 for the next one.
+ */
+static inline void SW_PWM_voidRunEdges(void)
+{
+	const SwPwm_SCHEDULE* Local_pSchedule = &SW_PWM_ASchedule[SW_PWM_u8Active];
+
+	while(SW_PWM_u8NextEdge < Local_pSchedule->EdgeCount)
+	{
+		u8 Local_u8Time = Local_pSchedule->EdgeTime[SW_PWM_u8NextEdge];
+		const u8* Local_pu8Clear = Local_pSchedule->EdgeClearMask[SW_PWM_u8NextEdge];
+
+		if(Local_u8Time > (u16)TCNT2 + 1)
+		{
+			OCR2 = Local_u8Time;
+			break;
+		}
+
+		if(Local_pu8Clear[DIO_PORTA] != 0) { SW_PWM_PORT_UPDATE(DIO_PORTA, (u8)~Local_pu8Clear[DIO_PORTA], 0); }
+		if(Local_pu8Clear[DIO_PORTB] != 0) { SW_PWM_PORT_UPDATE(DIO_PORTB, (u8)~Local_pu8Clear[DIO_PORTB], 0); }
+		if(Local_pu8Clear[DIO_PORTC] != 0) { SW_PWM_PORT_UPDATE(DIO_PORTC, (u8)~Local_pu8Clear[DIO_PORTC], 0); }
+		if(Local_pu8Clear[DIO_PORTD] != 0) { SW_PWM_PORT_UPDATE(DIO_PORTD, (u8)~Local_pu8Clear[DIO_PORTD], 0); }
+
+		SW_PWM_u8NextEdge++;
+	}
+}
+
+/* Timer2 Overflow: period start */
+ISR(TIMER2_OVF_vect)
+{
+	const SwPwm_SCHEDULE* Local_pSchedule;
+#if SW_PWM_MEASURE_ISR_CYCLES == SW_PWM_ENABLED
+	u16 Local_u16Start = TCNT1;
+
+	SW_PWM_u16PeriodCycles = SW_PWM_u16CycleSum;
+	SW_PWM_u16CycleSum = 0;
+#endif
+
+	if(SW_PWM_u8Pending)
+	{
+		SW_PWM_u8Active ^= 1;
+		SW_PWM_u8Pending = 0;
+	}
+	Local_pSchedule = &SW_PWM_ASchedule[SW_PWM_u8Active];
+
+	/* Owned pins take the set mask: one write per port used by the engine */
+	if(SW_PWM_Au8ChannelMask[DIO_PORTA] != 0) { SW_PWM_PORT_UPDATE(DIO_PORTA, (u8)~SW_PWM_Au8ChannelMask[DIO_PORTA], Local_pSchedule->SetMask[DIO_PORTA]); }
+	if(SW_PWM_Au8ChannelMask[DIO_PORTB] != 0) { SW_PWM_PORT_UPDATE(DIO_PORTB, (u8)~SW_PWM_Au8ChannelMask[DIO_PORTB], Local_pSchedule->SetMask[DIO_PORTB]); }
+	if(SW_PWM_Au8ChannelMask[DIO_PORTC] != 0) { SW_PWM_PORT_UPDATE(DIO_PORTC, (u8)~SW_PWM_Au8ChannelMask[DIO_PORTC], Local_pSchedule->SetMask[DIO_PORTC]); }
+	if(SW_PWM_Au8ChannelMask[DIO_PORTD] != 0) { SW_PWM_PORT_UPDATE(DIO_PORTD, (u8)~SW_PWM_Au8ChannelMask[DIO_PORTD], Local_pSchedule->SetMask[DIO_PORTD]); }
+
+	SW_PWM_u8NextEdge = 0;
+	SW_PWM_voidRunEdges();
+
+#if SW_PWM_MEASURE_ISR_CYCLES == SW_PWM_ENABLED
+	SW_PWM_u16CycleSum += TCNT1 - Local_u16Start;
+#endif
+}
+
+/* Timer2 Compare Match: next clear edge */
+ISR(TIMER2_COMP_vect)
+{
+#if SW_PWM_MEASURE_ISR_CYCLES == SW_PWM_ENABLED
+	u16 Local_u16Start = TCNT1;
+#endif
+
+	SW_PWM_voidRunEdges();
+
+#if SW_PWM_MEASURE_ISR_CYCLES == SW_PWM_ENABLED
+	SW_PWM_u16CycleSum += TCNT1 - Local_u16Start;
+#endif
+}
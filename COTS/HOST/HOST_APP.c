@@ -0,0 +1,891 @@
+/*
+ * File: HOST_APP.c
+ *
+ * Description:
+ *     Host test file for the HOST module (build line in HOST_interface.h).
+ *     Runs the unmodified DIO, LCD, SEV_SEG, BUS_ARB, ADC, LM35 and SOFT_I2C drivers
+ *     against the simulated register file:
+ *       - an HD44780 model decodes the LCD pins from the write observer into DDRAM,
+ *         keeps the controller busy for the datasheet execution time of each byte
+ *         (counting transfers that arrive too early), answers busy flag reads and
+ *         checks that RS has the same level at both edges of every E pulse,
+ *       - an ADC model completes conversions from a read hook on ADCSRA,
+ *       - the seven-segment digit is sampled when its common pin is driven low,
+ *       - an I2C slave model (16-byte memory with a register pointer, which stretches
+ *         SCL after every acknowledge) answers on the SOFT_I2C lines.
+ *     Each check prints PASS/FAIL and the exit code is the number of failures, so the
+ *     program can run as a CI step. A second table reports the register accesses,
+ *     register writes and virtual time spent per driver call.
+ *     Every DIO_SHADOW_MODE but DIO_SHADOW_DEFERRED runs the suite: each test set starts
+ *     with the shadows resynchronised to the cleared register file.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+/* AVR LIB (host replacements) */
+#include <util/delay.h>
+
+/* UTILS_LIB */
+#include "../UTIL_LIB/STD_TYPES.h"
+#include "../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../MCAL/DIO/DIO_interface.h"
+#include "../MCAL/DIO/DIO_private.h"
+#include "../MCAL/DIO/DIO_config.h"
+#include "../MCAL/ADC/ADC_interface.h"
+#include "../MCAL/SOFT_I2C/SOFT_I2C_interface.h"
+#include "../MCAL/SOFT_I2C/SOFT_I2C_config.h"
+#include "../MCAL/SOFT_I2C/SOFT_I2C_private.h"
+#include "../MCAL/TIMER/TIMER_config.h"
+
+/* HAL */
+#include "../HAL/LCD_4x20/LCD_interface.h"
+#include "../HAL/LCD_4x20/LCD_config.h"
+#include "../HAL/SEV_SEG/SEV_SEG_interface.h"
+#include "../HAL/SEV_SEG/SEV_SEG_private.h"
+#include "../HAL/BUS_ARB/BUS_ARB_interface.h"
+#include "../HAL/BUS_ARB/BUS_ARB_private.h"
+#include "../HAL/LM35/LM35_interface.h"
+
+/* HOST */
+#include "./HOST_interface.h"
+#include "./HOST_private.h"
+
+/* ADC registers seen from the model side */
+#define APP_ADCSRA_ADDRESS      0x26
+#define APP_ADMUX_ADDRESS       0x27
+#define APP_ADCH_ADDRESS        0x25
+#define APP_ADCL_ADDRESS        0x24
+#define APP_ADCSRA_ADSC         6
+#define APP_ADCSRA_ADIF         4
+
+/* LCD model: 4 lines of 20 characters, DDRAM addresses of each line */
+#define APP_LCD_DDRAM_SIZE      0x80
+static const u8 APP_Au8LcdLineAddress[4] = {0x00, 0x40, 0x14, 0x54};
+
+static u8  APP_Au8LcdDdram[APP_LCD_DDRAM_SIZE];
+static u8  APP_u8LcdAddress;
+static u8  APP_u8LcdFourBit;
+static u8  APP_u8LcdHalf;
+static u8  APP_u8LcdByte;
+static u8  APP_u8LcdReadHalf;
+static u32 APP_u32LcdBusyUntil;     /* Virtual cycle at which the last byte is executed */
+static u8  APP_u8LcdEarly;          /* Bytes written while the controller was busy */
+static u8  APP_u8LcdDone;           /* LCD_voidSetCallBack notifications */
+static u8  APP_u8LcdRsAtRise;       /* RS level at the last rising edge of E */
+static u8  APP_u8LcdRsUnstable;     /* E pulses whose RS level differs at the two edges, or
+                                       edges written together with an RS change */
+static u8  APP_u8LcdEntryModes;     /* Entry mode sets executed (BUS_ARB filler instructions) */
+
+#define APP_LCD_MAX_TICKS       1000    /* Bound of APP_voidLcdDrain */
+
+/* LCD_MODE values (LCD_private.h) */
+#define LCD_4_BIT_MODE          4
+#define LCD_8_BIT_MODE          8
+
+/* ADC model input, one 10-bit result per channel */
+static u16 APP_Au16AdcInput[8];
+
+/* Seven-segment sample: BCD value shown while common pin 3 was active */
+static u8  APP_u8SevSegDigit3;
+
+/* I2C slave model */
+#define APP_I2C_ADDRESS         0x50
+#define APP_I2C_MEMORY_SIZE     16
+#define APP_I2C_STRETCH_READS   3       /* PINx reads with SCL held low after each acknowledge */
+
+#define APP_I2C_IDLE            0
+#define APP_I2C_RECEIVE         1
+#define APP_I2C_TRANSMIT        2
+
+static u8  APP_Au8I2cMemory[APP_I2C_MEMORY_SIZE];
+static u8  APP_u8I2cPointer;
+static u8  APP_u8I2cState;
+static u8  APP_u8I2cBit;            /* SCL rising edges in the current byte, 9 with the acknowledge */
+static u8  APP_u8I2cShift;
+static u8  APP_u8I2cBytes;          /* Bytes received since START, the first one is the address */
+static u8  APP_u8I2cRead;
+static u8  APP_u8I2cMasterAck;
+static u8  APP_u8I2cSlaveSda;       /* Slave pulls SDA low */
+static u8  APP_u8I2cStretch;
+static u8  APP_u8I2cStuck;          /* Slave never ends its clock stretching */
+static u8  APP_u8I2cScl;            /* Wire levels at the last evaluation */
+static u8  APP_u8I2cSda;
+static u8  APP_u8I2cStarts;
+static u8  APP_u8I2cStops;
+
+/* Statistics for the benchmark table */
+static u32 APP_u32Writes;
+
+static u8 APP_u8Failures;
+
+static void APP_voidCheck(const char* Copy_pcName, u8 Copy_u8Passed)
+{
+	printf("%-48s %s\n", Copy_pcName, Copy_u8Passed ? "PASS" : "FAIL");
+	if (!Copy_u8Passed)
+	{
+		APP_u8Failures++;
+	}
+}
+
+/* HD44780 command and data decoding (only what the driver uses) */
+static void APP_voidLcdExecute(u8 Copy_u8Rs, u8 Copy_u8Byte)
+{
+	u32 Local_u32Us = (!Copy_u8Rs && ((Copy_u8Byte & 0xFC) == 0x00)) ? 1520 : 37;
+
+	if (HOST_u32GetCycles() < APP_u32LcdBusyUntil)
+	{
+		APP_u8LcdEarly++;
+	}
+	APP_u32LcdBusyUntil = HOST_u32GetCycles() + Local_u32Us * (F_CPU / 1000000UL);
+
+	if (Copy_u8Rs)
+	{
+		APP_Au8LcdDdram[APP_u8LcdAddress & (APP_LCD_DDRAM_SIZE - 1)] = Copy_u8Byte;
+		APP_u8LcdAddress++;
+	}
+	else if (Copy_u8Byte & 0x80)
+	{
+		APP_u8LcdAddress = Copy_u8Byte & 0x7F;
+	}
+	else if (Copy_u8Byte == 0x01)
+	{
+		memset(APP_Au8LcdDdram, ' ', sizeof(APP_Au8LcdDdram));
+		APP_u8LcdAddress = 0;
+	}
+	else if ((Copy_u8Byte & 0xF0) == 0x20)
+	{
+		APP_u8LcdFourBit = !GET_BIT(Copy_u8Byte, 4);
+	}
+	else if ((Copy_u8Byte & 0xFC) == 0x04)
+	{
+		APP_u8LcdEntryModes++;
+	}
+}
+
+/* R/W high: the controller drives the data lines (only when R/W is an output set high) */
+static u8 APP_u8LcdRead(void)
+{
+	return GET_BIT(HOST_u8GetRegister(HOST_DDR_ADDRESS(LCD_RW_PORT)), LCD_RW_PIN) &&
+	       GET_BIT(HOST_u8GetRegister(HOST_PORT_ADDRESS(LCD_RW_PORT)), LCD_RW_PIN);
+}
+
+/* Busy flag read: D7 is high while the controller executes, during the first nibble */
+static u8 APP_u8LcdPinHook(u16 Copy_u16Address, u8 Copy_u8Value)
+{
+	(void)Copy_u16Address;
+
+	if (APP_u8LcdRead() && GET_BIT(HOST_u8GetRegister(HOST_PORT_ADDRESS(LCD_E_PORT)), LCD_E_PIN) && !APP_u8LcdReadHalf)
+	{
+		Copy_u8Value &= (u8)~(1 << LCD_D7_PIN);
+		Copy_u8Value |= (u8)((HOST_u32GetCycles() < APP_u32LcdBusyUntil) << LCD_D7_PIN);
+	}
+
+	return Copy_u8Value;
+}
+
+/* Level of one LCD data line */
+#define APP_LCD_LINE(Port, Pin)  GET_BIT(HOST_u8GetRegister(HOST_PORT_ADDRESS(Port)), Pin)
+
+/*
+ * Latches the data lines on the falling edge of E; the controller starts in 8-bit mode.
+ * D0..D3 are read from their LCD_config.h pins; with the 4-bit wiring they only reach the
+ * low bits of the first function set, which the model ignores.
+ */
+static void APP_voidLcdFallingEdge(void)
+{
+	u8 Local_u8Rs = GET_BIT(HOST_u8GetRegister(HOST_PORT_ADDRESS(LCD_RS_PORT)), LCD_RS_PIN);
+	u8 Local_u8Nibble = (APP_LCD_LINE(LCD_D4_PORT, LCD_D4_PIN) << 0) | (APP_LCD_LINE(LCD_D5_PORT, LCD_D5_PIN) << 1) |
+	                    (APP_LCD_LINE(LCD_D6_PORT, LCD_D6_PIN) << 2) | (APP_LCD_LINE(LCD_D7_PORT, LCD_D7_PIN) << 3);
+	u8 Local_u8Low = (APP_LCD_LINE(LCD_D0_PORT, LCD_D0_PIN) << 0) | (APP_LCD_LINE(LCD_D1_PORT, LCD_D1_PIN) << 1) |
+	                 (APP_LCD_LINE(LCD_D2_PORT, LCD_D2_PIN) << 2) | (APP_LCD_LINE(LCD_D3_PORT, LCD_D3_PIN) << 3);
+
+	if (APP_u8LcdRead())
+	{
+		/* 4-bit reads take two pulses, the busy flag comes with the first one */
+		if (APP_u8LcdFourBit)
+		{
+			APP_u8LcdReadHalf = !APP_u8LcdReadHalf;
+		}
+	}
+	else if (!APP_u8LcdFourBit)
+	{
+		APP_voidLcdExecute(Local_u8Rs, (Local_u8Nibble << 4) | Local_u8Low);
+	}
+	else if (!APP_u8LcdHalf)
+	{
+		APP_u8LcdByte = Local_u8Nibble << 4;
+		APP_u8LcdHalf = 1;
+	}
+	else
+	{
+		APP_u8LcdHalf = 0;
+		APP_voidLcdExecute(Local_u8Rs, APP_u8LcdByte | Local_u8Nibble);
+	}
+}
+
+static void APP_voidLcdDone(void)
+{
+	APP_u8LcdDone++;
+}
+
+/* Runs the Timer0 tick (virtual time) until the LCD reports its bytes on the display */
+static void APP_voidLcdDrain(void)
+{
+	u16 Local_u16Ticks;
+
+	APP_u8LcdDone = 0;
+	for (Local_u16Ticks = 0; (Local_u16Ticks < APP_LCD_MAX_TICKS) && (APP_u8LcdDone == 0); Local_u16Ticks++)
+	{
+		HOST_voidDelayUs(TIMER0_TICK_PERIOD_US);
+		LCD_voidTick();
+	}
+}
+
+/* Level the master puts on an open-drain line: low only while it drives the pin low */
+static u8 APP_u8I2cMasterLevel(u8 Copy_u8Port, u8 Copy_u8Pin)
+{
+	if (GET_BIT(HOST_u8GetRegister(HOST_DDR_ADDRESS(Copy_u8Port)), Copy_u8Pin))
+	{
+		return GET_BIT(HOST_u8GetRegister(HOST_PORT_ADDRESS(Copy_u8Port)), Copy_u8Pin);
+	}
+
+	return 1;
+}
+
+/* Loads the next memory byte and puts its MSB on SDA */
+static void APP_voidI2cLoadByte(void)
+{
+	APP_u8I2cShift = APP_Au8I2cMemory[APP_u8I2cPointer];
+	APP_u8I2cPointer = (APP_u8I2cPointer + 1) % APP_I2C_MEMORY_SIZE;
+	APP_u8I2cSlaveSda = !GET_BIT(APP_u8I2cShift, 7);
+}
+
+/* SCL falling edge (after APP_u8I2cBit rising edges): the slave changes SDA only while SCL is low */
+static void APP_voidI2cSclFalling(void)
+{
+	if (APP_u8I2cState == APP_I2C_RECEIVE)
+	{
+		if (APP_u8I2cBit == 8)
+		{
+			if (APP_u8I2cBytes == 0)
+			{
+				if ((APP_u8I2cShift >> 1) != APP_I2C_ADDRESS)
+				{
+					APP_u8I2cState = APP_I2C_IDLE;  /* Not addressed: wait for the next START */
+					return;
+				}
+				APP_u8I2cRead = GET_BIT(APP_u8I2cShift, 0);
+			}
+			else if (APP_u8I2cBytes == 1)
+			{
+				APP_u8I2cPointer = APP_u8I2cShift % APP_I2C_MEMORY_SIZE;
+			}
+			else
+			{
+				APP_Au8I2cMemory[APP_u8I2cPointer] = APP_u8I2cShift;
+				APP_u8I2cPointer = (APP_u8I2cPointer + 1) % APP_I2C_MEMORY_SIZE;
+			}
+
+			APP_u8I2cBytes++;
+			APP_u8I2cSlaveSda = 1;                  /* ACK */
+		}
+		else if (APP_u8I2cBit == 9)
+		{
+			APP_u8I2cSlaveSda = 0;
+			APP_u8I2cBit = 0;
+			APP_u8I2cShift = 0;
+			APP_u8I2cStretch = APP_I2C_STRETCH_READS;
+
+			if (APP_u8I2cRead)
+			{
+				APP_u8I2cState = APP_I2C_TRANSMIT;
+				APP_voidI2cLoadByte();
+			}
+		}
+	}
+	else if (APP_u8I2cState == APP_I2C_TRANSMIT)
+	{
+		if ((APP_u8I2cBit > 0) && (APP_u8I2cBit < 8))
+		{
+			APP_u8I2cSlaveSda = !GET_BIT(APP_u8I2cShift, 7 - APP_u8I2cBit);
+		}
+		else if (APP_u8I2cBit == 8)
+		{
+			APP_u8I2cSlaveSda = 0;                  /* Master acknowledges */
+		}
+		else if (APP_u8I2cBit == 9)
+		{
+			APP_u8I2cBit = 0;
+			APP_u8I2cStretch = APP_I2C_STRETCH_READS;
+
+			if (APP_u8I2cMasterAck)
+			{
+				APP_voidI2cLoadByte();
+			}
+			else
+			{
+				APP_u8I2cState = APP_I2C_IDLE;      /* NACK: the master ends the read */
+			}
+		}
+	}
+}
+
+/* Derives the wire levels and runs the slave on their edges */
+static void APP_voidI2cEvaluate(void)
+{
+	u8 Local_u8Scl = APP_u8I2cMasterLevel(SOFT_I2C_SCL_PORT, SOFT_I2C_SCL_PIN) && !APP_u8I2cStretch;
+	u8 Local_u8Sda = APP_u8I2cMasterLevel(SOFT_I2C_SDA_PORT, SOFT_I2C_SDA_PIN) && !APP_u8I2cSlaveSda;
+
+	if (Local_u8Scl && APP_u8I2cScl && (Local_u8Sda != APP_u8I2cSda))
+	{
+		if (!Local_u8Sda)
+		{
+			APP_u8I2cState = APP_I2C_RECEIVE;       /* START or repeated START */
+			APP_u8I2cBit = 0;
+			APP_u8I2cShift = 0;
+			APP_u8I2cBytes = 0;
+			APP_u8I2cRead = 0;
+			APP_u8I2cStarts++;
+		}
+		else
+		{
+			APP_u8I2cState = APP_I2C_IDLE;          /* STOP */
+			APP_u8I2cStops++;
+		}
+		APP_u8I2cSlaveSda = 0;
+	}
+	else if (Local_u8Scl && !APP_u8I2cScl)
+	{
+		if ((APP_u8I2cState == APP_I2C_RECEIVE) && (APP_u8I2cBit < 8))
+		{
+			APP_u8I2cShift = (u8)(APP_u8I2cShift << 1) | Local_u8Sda;
+		}
+		else if ((APP_u8I2cState == APP_I2C_TRANSMIT) && (APP_u8I2cBit == 8))
+		{
+			APP_u8I2cMasterAck = !Local_u8Sda;
+		}
+
+		if (APP_u8I2cState != APP_I2C_IDLE)
+		{
+			APP_u8I2cBit++;
+		}
+	}
+	else if (!Local_u8Scl && APP_u8I2cScl)
+	{
+		APP_voidI2cSclFalling();
+	}
+
+	APP_u8I2cScl = Local_u8Scl;
+	APP_u8I2cSda = APP_u8I2cMasterLevel(SOFT_I2C_SDA_PORT, SOFT_I2C_SDA_PIN) && !APP_u8I2cSlaveSda;
+}
+
+/* Every access to the bus port is a poll: it ends one read of clock stretching */
+static u8 APP_u8I2cPinHook(u16 Copy_u16Address, u8 Copy_u8Value)
+{
+	(void)Copy_u16Address;
+
+	if ((APP_u8I2cStretch > 0) && !APP_u8I2cStuck)
+	{
+		APP_u8I2cStretch--;
+	}
+	APP_voidI2cEvaluate();
+
+	Copy_u8Value &= (u8)~((1 << SOFT_I2C_SCL_PIN) | (1 << SOFT_I2C_SDA_PIN));
+	Copy_u8Value |= (u8)((APP_u8I2cScl << SOFT_I2C_SCL_PIN) | (APP_u8I2cSda << SOFT_I2C_SDA_PIN));
+
+	return Copy_u8Value;
+}
+
+static void APP_voidWriteObserver(u16 Copy_u16Address, u8 Copy_u8OldValue, u8 Copy_u8NewValue)
+{
+	APP_u32Writes++;
+
+	/*
+	 * E edges: RS must have the same level at the rising and the falling edge, and must
+	 * not change in the write that moves E (setup/hold of at least one I/O write)
+	 */
+	if ((Copy_u16Address == HOST_PORT_ADDRESS(LCD_E_PORT)) &&
+	    (GET_BIT(Copy_u8OldValue, LCD_E_PIN) != GET_BIT(Copy_u8NewValue, LCD_E_PIN)))
+	{
+		if ((LCD_RS_PORT == LCD_E_PORT) && (GET_BIT(Copy_u8OldValue, LCD_RS_PIN) != GET_BIT(Copy_u8NewValue, LCD_RS_PIN)))
+		{
+			APP_u8LcdRsUnstable++;
+		}
+
+		if (GET_BIT(Copy_u8NewValue, LCD_E_PIN))
+		{
+			APP_u8LcdRsAtRise = GET_BIT(HOST_u8GetRegister(HOST_PORT_ADDRESS(LCD_RS_PORT)), LCD_RS_PIN);
+		}
+		else
+		{
+			if (GET_BIT(HOST_u8GetRegister(HOST_PORT_ADDRESS(LCD_RS_PORT)), LCD_RS_PIN) != APP_u8LcdRsAtRise)
+			{
+				APP_u8LcdRsUnstable++;
+			}
+			APP_voidLcdFallingEdge();
+		}
+	}
+
+	if ((Copy_u16Address == HOST_PORT_ADDRESS(DIO_PORTB)) &&
+	    GET_BIT(Copy_u8OldValue, SEV_SEG_COM_PIN_3) && !GET_BIT(Copy_u8NewValue, SEV_SEG_COM_PIN_3))
+	{
+		APP_u8SevSegDigit3 = (GET_BIT(Copy_u8NewValue, SEV_SEG_BCD_PIN_A) << 0) | (GET_BIT(Copy_u8NewValue, SEV_SEG_BCD_PIN_B) << 1) |
+		                     (GET_BIT(Copy_u8NewValue, SEV_SEG_BCD_PIN_C) << 2) | (GET_BIT(Copy_u8NewValue, SEV_SEG_BCD_PIN_D) << 3);
+	}
+
+	if ((Copy_u16Address == HOST_DDR_ADDRESS(SOFT_I2C_SCL_PORT)) || (Copy_u16Address == HOST_PORT_ADDRESS(SOFT_I2C_SCL_PORT)) ||
+	    (Copy_u16Address == HOST_DDR_ADDRESS(SOFT_I2C_SDA_PORT)) || (Copy_u16Address == HOST_PORT_ADDRESS(SOFT_I2C_SDA_PORT)))
+	{
+		APP_voidI2cEvaluate();
+	}
+}
+
+/*
+ * ADC model: a started conversion (ADSC) completes on the next access, loading the
+ * channel's input into ADCH:ADCL and raising ADIF. A raised ADIF seen without a
+ * conversion in progress was acknowledged by the driver (written one) and is cleared.
+ */
+static u8 APP_u8AdcsraHook(u16 Copy_u16Address, u8 Copy_u8Value)
+{
+	u16 Local_u16Result;
+
+	(void)Copy_u16Address;
+
+	if (GET_BIT(Copy_u8Value, APP_ADCSRA_ADSC))
+	{
+		Local_u16Result = APP_Au16AdcInput[HOST_u8GetRegister(APP_ADMUX_ADDRESS) & 0x07] & 0x3FF;
+		HOST_voidSetRegister(APP_ADCL_ADDRESS, (u8)Local_u16Result);
+		HOST_voidSetRegister(APP_ADCH_ADDRESS, (u8)(Local_u16Result >> 8));
+		CLR_BIT(Copy_u8Value, APP_ADCSRA_ADSC);
+		SET_BIT(Copy_u8Value, APP_ADCSRA_ADIF);
+	}
+	else
+	{
+		CLR_BIT(Copy_u8Value, APP_ADCSRA_ADIF);
+	}
+
+	return Copy_u8Value;
+}
+
+static void APP_voidStartModels(void)
+{
+#if DIO_SHADOW_MODE != DIO_SHADOW_DISABLED
+	u8 Local_u8PortId;
+#endif
+
+	HOST_voidReset();
+#if DIO_SHADOW_MODE != DIO_SHADOW_DISABLED
+	/* The DIO shadows follow the cleared register file, as after DIO_initPinsConfig */
+	for (Local_u8PortId = 0; Local_u8PortId < HOST_PORTS_NUM; Local_u8PortId++)
+	{
+		DIO_Au8PortShadow[Local_u8PortId] = HOST_u8GetRegister(HOST_PORT_ADDRESS(Local_u8PortId));
+		DIO_Au8DdrShadow[Local_u8PortId] = HOST_u8GetRegister(HOST_DDR_ADDRESS(Local_u8PortId));
+	}
+#endif
+	memset(APP_Au8LcdDdram, ' ', sizeof(APP_Au8LcdDdram));
+	APP_u8LcdAddress = 0;
+	APP_u8LcdFourBit = 0;
+	APP_u8LcdHalf = 0;
+	APP_u8LcdReadHalf = 0;
+	APP_u32LcdBusyUntil = 0;
+	APP_u8LcdEarly = 0;
+	APP_u8LcdDone = 0;
+	APP_u8LcdRsAtRise = 0;
+	APP_u8LcdRsUnstable = 0;
+	APP_u8LcdEntryModes = 0;
+	LCD_voidSetCallBack(APP_voidLcdDone);
+	APP_u8I2cState = APP_I2C_IDLE;
+	APP_u8I2cSlaveSda = 0;
+	APP_u8I2cStretch = 0;
+	APP_u8I2cStuck = 0;
+	APP_u8I2cScl = 1;
+	APP_u8I2cSda = 1;
+	APP_u8I2cStarts = 0;
+	APP_u8I2cStops = 0;
+	HOST_voidSetWriteObserver(APP_voidWriteObserver);
+	HOST_voidSetReadHook(APP_ADCSRA_ADDRESS, APP_u8AdcsraHook);
+	HOST_voidSetReadHook(HOST_PIN_ADDRESS(LCD_D7_PORT), APP_u8LcdPinHook);
+	HOST_voidSetReadHook(HOST_PIN_ADDRESS(SOFT_I2C_SCL_PORT), APP_u8I2cPinHook);
+	HOST_voidSetReadHook(HOST_PIN_ADDRESS(SOFT_I2C_SDA_PORT), APP_u8I2cPinHook);
+}
+
+static u8 APP_u8LcdLineStartsWith(u8 Copy_u8Line, const char* Copy_pcText)
+{
+	return memcmp(&APP_Au8LcdDdram[APP_Au8LcdLineAddress[Copy_u8Line]], Copy_pcText, strlen(Copy_pcText)) == 0;
+}
+
+/* Test Set 1: DIO output observation and input injection */
+static void APP_voidTestDio(void)
+{
+	u8 Local_u8Value;
+	u8 Local_Au8Registers[HOST_REGISTERS_NUM];
+	u16 Local_u16Address;
+
+	APP_voidStartModels();
+
+	DIO_setPinDirection(DIO_PORTC, DIO_PIN3, DIO_PIN_OUTPUT);
+	DIO_setPinValue(DIO_PORTC, DIO_PIN3, DIO_PIN_HIGH);
+	HOST_voidSync();
+	APP_voidCheck("DIO: PC3 high reaches PORTC", HOST_u8GetRegister(HOST_PORT_ADDRESS(DIO_PORTC)) == 0x08);
+
+	DIO_getPinValue(DIO_PORTC, DIO_PIN3, &Local_u8Value);
+	APP_voidCheck("DIO: output pin reads back through PINC", Local_u8Value == DIO_PIN_HIGH);
+
+	HOST_voidSetRegister(HOST_PIN_ADDRESS(DIO_PORTD), 0x04);
+	DIO_getPinValue(DIO_PORTD, DIO_PIN2, &Local_u8Value);
+	APP_voidCheck("DIO: injected PD2 level is read", Local_u8Value == DIO_PIN_HIGH);
+
+	DIO_writePortMasked(DIO_PORTC, 0xF0, 0xA5);
+	HOST_voidSync();
+	APP_voidCheck("DIO: masked write keeps the other bits", HOST_u8GetRegister(HOST_PORT_ADDRESS(DIO_PORTC)) == 0xA8);
+
+	/* Out-of-range constants take the checked runtime path, which writes nothing */
+	for (Local_u16Address = 0; Local_u16Address < HOST_REGISTERS_NUM; Local_u16Address++)
+	{
+		Local_Au8Registers[Local_u16Address] = HOST_u8GetRegister(Local_u16Address);
+	}
+	DIO_SET_PIN_VALUE(4, DIO_PIN0, DIO_PIN_HIGH);
+	DIO_SET_PIN_VALUE(DIO_PORTC, 8, DIO_PIN_HIGH);
+	DIO_SET_PIN_VALUE(DIO_PORTC, DIO_PIN0, 2);
+	DIO_SET_PIN_DIRECTION(DIO_PORTC, DIO_PIN0, 2);
+	DIO_TOGGLE_PIN_VALUE(4, DIO_PIN0);
+	HOST_voidSync();
+	for (Local_u16Address = 0; Local_u16Address < HOST_REGISTERS_NUM; Local_u16Address++)
+	{
+		if (HOST_u8GetRegister(Local_u16Address) != Local_Au8Registers[Local_u16Address])
+		{
+			break;
+		}
+	}
+	APP_voidCheck("DIO: bad constant arguments write nothing", Local_u16Address == HOST_REGISTERS_NUM);
+
+	HW_REG16(0x4C) = 0x1234;
+	HOST_voidSync();
+	APP_voidCheck("HOST: 16-bit write lands low byte first",
+	              (HOST_u8GetRegister(0x4C) == 0x34) && (HOST_u8GetRegister(0x4D) == 0x12));
+	HOST_voidSetRegister(0x4D, 0xAB);
+	APP_voidCheck("HOST: 16-bit read sees both bytes", HW_REG16(0x4C) == 0xAB34);
+
+	APP_voidCheck("HOST: no access outside the register file", HOST_u32GetUnmappedCount() == 0);
+}
+
+/* Test Set 2: LCD through the HD44780 model */
+static void APP_voidTestLcd(void)
+{
+	APP_voidStartModels();
+
+	LCD_voidInit();
+	LCD_voidWriteString((u8*)"HOST BUILD");
+	LCD_voidGoTo(LCD_LINE_THREE, 0);
+	LCD_voidWriteNumber(1234);
+	APP_voidLcdDrain();
+	HOST_voidSync();
+
+	APP_voidCheck("LCD: controller set to the LCD_MODE interface", APP_u8LcdFourBit == (LCD_MODE == LCD_4_BIT_MODE));
+	APP_voidCheck("LCD: line 1 shows the string", APP_u8LcdLineStartsWith(0, "HOST BUILD"));
+	APP_voidCheck("LCD: line 3 shows the number", APP_u8LcdLineStartsWith(2, "1234"));
+	APP_voidCheck("LCD: no byte sent while the controller was busy", APP_u8LcdEarly == 0);
+}
+
+/* Flush result: the byte count is part of the printed name */
+static void APP_voidCheckFlush(const char* Copy_pcUpdate, u8 Copy_u8Sent, u8 Copy_u8Expected, u8 Copy_u8Shown)
+{
+	char Local_acName[48];
+
+	snprintf(Local_acName, sizeof(Local_acName), "LCD flush: %s, %u bytes", Copy_pcUpdate, Copy_u8Sent);
+	APP_voidCheck(Local_acName, (Copy_u8Sent == Copy_u8Expected) && Copy_u8Shown);
+}
+
+/* Test Set 2b: LCD framebuffer, bytes sent per flush for typical updates */
+static void APP_voidTestLcdBuffer(void)
+{
+	u8 Local_u8Sent;
+
+	APP_voidStartModels();
+	LCD_voidInit();
+
+	/* Status screen: label and value on line 1, set point on line 4 */
+	LCD_voidBufferWriteString((u8*)"TEMP");
+	LCD_voidBufferGoTo(LCD_LINE_ONE, 10);
+	LCD_voidBufferWriteNumber(25);
+	LCD_voidBufferGoTo(LCD_LINE_FOUR, 0);
+	LCD_voidBufferWriteString((u8*)"SET 30");
+	Local_u8Sent = LCD_u8Flush();
+	APP_voidLcdDrain();
+	HOST_voidSync();
+	APP_voidCheckFlush("first screen", Local_u8Sent, 14,
+	                   APP_u8LcdLineStartsWith(0, "TEMP      25") && APP_u8LcdLineStartsWith(3, "SET 30"));
+
+	/* One digit changes: address command + character */
+	LCD_voidBufferGoTo(LCD_LINE_ONE, 10);
+	LCD_voidBufferWriteNumber(26);
+	Local_u8Sent = LCD_u8Flush();
+	APP_voidLcdDrain();
+	HOST_voidSync();
+	APP_voidCheckFlush("one digit", Local_u8Sent, 2, APP_u8LcdLineStartsWith(0, "TEMP      26"));
+
+	/* Same values written again: nothing to send */
+	LCD_voidBufferGoTo(LCD_LINE_ONE, 10);
+	LCD_voidBufferWriteNumber(26);
+	Local_u8Sent = LCD_u8Flush();
+	APP_voidLcdDrain();
+	APP_voidCheckFlush("unchanged", Local_u8Sent, 0, 1);
+
+	/* Fields on two lines, the counter continues where the last flush stopped */
+	LCD_voidBufferGoTo(LCD_LINE_ONE, 10);
+	LCD_voidBufferWriteString((u8*)"1 3");
+	LCD_voidBufferGoTo(LCD_LINE_FOUR, 4);
+	LCD_voidBufferWriteNumber(31);
+	Local_u8Sent = LCD_u8Flush();
+	APP_voidLcdDrain();
+	HOST_voidSync();
+	APP_voidCheckFlush("two fields", Local_u8Sent, 6,
+	                   APP_u8LcdLineStartsWith(0, "TEMP      1 3") && APP_u8LcdLineStartsWith(3, "SET 31"));
+
+	/* Whole screen cleared: only non-blank cells are sent, the blank in "SET 31" is rewritten */
+	LCD_voidBufferClear();
+	Local_u8Sent = LCD_u8Flush();
+	APP_voidLcdDrain();
+	HOST_voidSync();
+	APP_voidCheckFlush("clear", Local_u8Sent, 15,
+	                   APP_u8LcdLineStartsWith(0, "                    ") && APP_u8LcdLineStartsWith(3, "                    "));
+	APP_voidCheck("LCD: no byte sent while the controller was busy", APP_u8LcdEarly == 0);
+}
+
+/* Test Set 2c: completion notification, queued transfers with LCD_ASYNC */
+static void APP_voidTestLcdQueue(void)
+{
+	u8 Local_u8Tick;
+
+	APP_voidStartModels();
+	LCD_voidInit();
+	APP_voidLcdDrain();
+
+	LCD_voidGoTo(LCD_LINE_TWO, 0);
+	LCD_voidWriteString((u8*)"QUEUE");
+
+	APP_voidLcdDrain();
+	HOST_voidSync();
+	APP_voidCheck("LCD queue: text shown once notified", APP_u8LcdLineStartsWith(1, "QUEUE"));
+	APP_voidCheck("LCD queue: one notification for the whole string", APP_u8LcdDone == 1);
+
+	for (Local_u8Tick = 0; Local_u8Tick < 5; Local_u8Tick++)
+	{
+		HOST_voidDelayUs(TIMER0_TICK_PERIOD_US);
+		LCD_voidTick();
+	}
+	APP_voidCheck("LCD queue: no notification without new bytes", APP_u8LcdDone == 1);
+
+	/* Clear (1.52 ms) and text queued together: the tick waits out the clear */
+	LCD_voidClear();
+	LCD_voidWriteString((u8*)"AFTER CLEAR");
+	APP_voidLcdDrain();
+	HOST_voidSync();
+	APP_voidCheck("LCD queue: text after clear shown", APP_u8LcdLineStartsWith(0, "AFTER CLEAR"));
+	APP_voidCheck("LCD: no byte sent while the controller was busy", APP_u8LcdEarly == 0);
+}
+
+/* Test Set 3: ADC and LM35 through the ADC model */
+static void APP_voidTestAdc(void)
+{
+	f32 Local_f32Temperature;
+
+	APP_voidStartModels();
+
+	APP_Au16AdcInput[1] = 51;       /* 249 mV: 24.9 C */
+	APP_Au16AdcInput[5] = 0x3A7;
+
+	LM35_voidInit();
+	APP_voidCheck("ADC: channel 5 conversion result", ADC_u16Read(5) == 0x3A7);
+
+	Local_f32Temperature = LM35_f32GetTemperature();
+	APP_voidCheck("LM35: 51 counts read as 24.9 C", (Local_f32Temperature > 24.85f) && (Local_f32Temperature < 24.95f));
+	APP_voidCheck("LM35: PA1 left as input", !GET_BIT(HOST_u8GetRegister(HOST_DDR_ADDRESS(DIO_PORTA)), DIO_PIN1));
+}
+
+/* Test Set 4: seven-segment multiplexing */
+static void APP_voidTestSevSeg(void)
+{
+	APP_voidStartModels();
+
+	SEV_SEG_voidInitialize();
+	SEV_SEG_voidDisableDisplay();
+	APP_u8SevSegDigit3 = 0xFF;
+	SEV_SEG_voidDisplayDigit(3, 7);
+	HOST_voidSync();
+
+	APP_voidCheck("SEV_SEG: digit 3 shows 7 while enabled", APP_u8SevSegDigit3 == 7);
+	APP_voidCheck("SEV_SEG: digits disabled afterwards",
+	              (HOST_u8GetRegister(HOST_PORT_ADDRESS(DIO_PORTB)) & SEV_SEG_COM_PORTB_MASK) == SEV_SEG_COM_PORTB_MASK);
+}
+
+/* Runs whole BUS_ARB frames, one Timer0 tick (virtual time) per slot */
+static void APP_voidBusArbFrames(u8 Copy_u8Frames)
+{
+	u16 Local_u16Ticks;
+
+	for (Local_u16Ticks = 0; Local_u16Ticks < (u16)Copy_u8Frames * BUS_ARB_SLOTS_NUM; Local_u16Ticks++)
+	{
+		HOST_voidDelayUs(TIMER0_TICK_PERIOD_US);
+		BUS_ARB_voidTick();
+	}
+}
+
+/* Queues a string as LCD data */
+static void APP_voidBusArbString(const char* Copy_pcText)
+{
+	while (*Copy_pcText != '\0')
+	{
+		BUS_ARB_voidLcdWrite(BUS_ARB_LCD_DATA, (u8)*Copy_pcText);
+		Copy_pcText++;
+	}
+}
+
+/*
+ * Test Set 4b: LCD and seven-segment display on the shared bus. Every display slot edge
+ * on E reaches the LCD model too, so the text only arrives if the filler instruction
+ * keeps the 4-bit nibble phase across the DIGIT_2 edge and the LCD slot.
+ */
+static void APP_voidTestBusArb(void)
+{
+	APP_voidStartModels();
+
+	BUS_ARB_voidInit();
+	BUS_ARB_voidSetNumber(1234);
+	APP_voidBusArbFrames(2);                /* Display running, controller still in 8-bit mode */
+
+	/* What LCD_voidInit queues with LCD_SHARED_BUS */
+	BUS_ARB_voidLcdWrite(BUS_ARB_LCD_NIBBLE, 0x2);
+	BUS_ARB_voidLcdWrite(BUS_ARB_LCD_COMMAND, 0x28);
+	BUS_ARB_voidLcdWrite(BUS_ARB_LCD_COMMAND, 0x0F);
+	BUS_ARB_voidLcdWrite(BUS_ARB_LCD_COMMAND, 0x01);
+	BUS_ARB_voidLcdWrite(BUS_ARB_LCD_COMMAND, 0x06);
+	BUS_ARB_voidLcdWrite(BUS_ARB_LCD_COMMAND, 0x80 | APP_Au8LcdLineAddress[1]);
+	APP_voidBusArbString("SHARED BUS");
+	APP_u8SevSegDigit3 = 0xFF;
+	APP_voidBusArbFrames(4);
+
+	APP_voidCheck("BUS_ARB: LCD switched to 4-bit mode", APP_u8LcdFourBit);
+	APP_voidCheck("BUS_ARB: line 2 shows the string", APP_u8LcdLineStartsWith(1, "SHARED BUS"));
+	APP_voidCheck("BUS_ARB: digit 3 shows 2 of 1234", APP_u8SevSegDigit3 == 2);
+
+	/* Idle frames: one filler entry mode set each, nibble phase kept */
+	APP_u8LcdEntryModes = 0;
+	APP_voidBusArbFrames(20);
+	APP_voidCheck("BUS_ARB: one filler entry mode set per frame", APP_u8LcdEntryModes == 20);
+	APP_voidCheck("BUS_ARB: frame ends on a whole byte", APP_u8LcdHalf == 0);
+
+	BUS_ARB_voidLcdWrite(BUS_ARB_LCD_COMMAND, 0x80 | APP_Au8LcdLineAddress[2]);
+	APP_voidBusArbString("PHASE KEPT");
+	APP_voidBusArbFrames(3);
+
+	APP_voidCheck("BUS_ARB: line 3 written after idle frames", APP_u8LcdLineStartsWith(2, "PHASE KEPT"));
+	APP_voidCheck("BUS_ARB: line 2 left as it was", APP_u8LcdLineStartsWith(1, "SHARED BUS"));
+	APP_voidCheck("BUS_ARB: RS at the same level on both E edges", APP_u8LcdRsUnstable == 0);
+	APP_voidCheck("BUS_ARB: no byte sent while the LCD was busy", APP_u8LcdEarly == 0);
+}
+
+/* Test Set 5: software I2C master against the slave model */
+static void APP_voidTestSoftI2c(void)
+{
+	static const u8 Local_Au8Write[3] = {0x02, 0xAA, 0xBB};
+	static const u8 Local_u8Register = 0x02;
+	u8 Local_Au8Read[2] = {0, 0};
+
+	APP_voidStartModels();
+	memset(APP_Au8I2cMemory, 0, sizeof(APP_Au8I2cMemory));
+	APP_Au8I2cMemory[4] = 0x5C;
+
+	/* PORT bits left high by earlier code (e.g. a pin map with pull-ups on the bus pins) */
+	HOST_voidSetRegister(HOST_PORT_ADDRESS(SOFT_I2C_SDA_PORT),
+	                     HOST_u8GetRegister(HOST_PORT_ADDRESS(SOFT_I2C_SDA_PORT)) | (1 << SOFT_I2C_SDA_PIN));
+	HOST_voidSetRegister(HOST_PORT_ADDRESS(SOFT_I2C_SCL_PORT),
+	                     HOST_u8GetRegister(HOST_PORT_ADDRESS(SOFT_I2C_SCL_PORT)) | (1 << SOFT_I2C_SCL_PIN));
+
+	SOFT_I2C_voidInit();
+	APP_voidCheck("SOFT_I2C: write to 0x50 acknowledged", SOFT_I2C_u8Write(0x50, Local_Au8Write, 3) == SOFT_I2C_OK);
+	APP_voidCheck("SOFT_I2C: slave memory written at the pointer",
+	              (APP_Au8I2cMemory[2] == 0xAA) && (APP_Au8I2cMemory[3] == 0xBB));
+
+	APP_voidCheck("SOFT_I2C: write-read with repeated START",
+	              SOFT_I2C_u8WriteRead(0x50, &Local_u8Register, 1, Local_Au8Read, 2) == SOFT_I2C_OK);
+	APP_voidCheck("SOFT_I2C: read back the written bytes", (Local_Au8Read[0] == 0xAA) && (Local_Au8Read[1] == 0xBB));
+	APP_voidCheck("SOFT_I2C: 3 STARTs (one repeated), 2 STOPs", (APP_u8I2cStarts == 3) && (APP_u8I2cStops == 2));
+
+	APP_voidCheck("SOFT_I2C: read continues at the pointer",
+	              (SOFT_I2C_u8Read(0x50, Local_Au8Read, 1) == SOFT_I2C_OK) && (Local_Au8Read[0] == 0x5C));
+
+	APP_voidCheck("SOFT_I2C: unknown address is NACKed", SOFT_I2C_u8Write(0x51, Local_Au8Write, 3) == SOFT_I2C_NACK);
+	APP_voidCheck("SOFT_I2C: bus released after the NACK", APP_u8I2cScl && APP_u8I2cSda && (APP_u8I2cStops == 4));
+
+	APP_u8I2cStuck = 1;
+	APP_voidCheck("SOFT_I2C: endless clock stretching times out", SOFT_I2C_u8Write(0x50, Local_Au8Write, 3) == SOFT_I2C_TIMEOUT);
+	APP_voidCheck("SOFT_I2C: START refused while SCL is low", SOFT_I2C_u8Start(0x50, SOFT_I2C_WRITE) == SOFT_I2C_ARBITRATION_LOST);
+	APP_u8I2cStuck = 0;
+	APP_u8I2cStretch = 0;                   /* The slave lets SCL go */
+	APP_voidCheck("SOFT_I2C: transfers work again afterwards", SOFT_I2C_u8Write(0x50, Local_Au8Write, 3) == SOFT_I2C_OK);
+}
+
+/* Test Set 6: cost per driver call (register accesses, observed writes, virtual time) */
+#define APP_BENCH(Name, Call)                                                          \
+	do {                                                                               \
+		HOST_voidSync();                                                               \
+		u32 Local_u32Accesses = HOST_u32GetAccessCount();                              \
+		u32 Local_u32Cycles = HOST_u32GetCycles();                                     \
+		APP_u32Writes = 0;                                                             \
+		Call;                                                                          \
+		HOST_voidSync();                                                               \
+		printf("%-32s %9lu %8lu %12.1f\n", Name,                                       \
+		       (unsigned long)(HOST_u32GetAccessCount() - Local_u32Accesses),          \
+		       (unsigned long)APP_u32Writes,                                           \
+		       (HOST_u32GetCycles() - Local_u32Cycles) * 1000000.0 / F_CPU);           \
+	} while (0)
+
+static void APP_voidBenchmark(void)
+{
+	APP_voidStartModels();
+	LCD_voidInit();
+	APP_voidLcdDrain();
+	SEV_SEG_voidInitialize();
+	APP_Au16AdcInput[1] = 51;
+
+	printf("\n%-32s %9s %8s %12s\n", "Call", "Accesses", "Writes", "Virtual us");
+	APP_BENCH("DIO_setPinValue", DIO_setPinValue(DIO_PORTC, DIO_PIN0, DIO_PIN_HIGH));
+	APP_BENCH("DIO_togglePinValue", DIO_togglePinValue(DIO_PORTC, DIO_PIN0));
+	APP_BENCH("DIO_writePortMasked", DIO_writePortMasked(DIO_PORTC, 0x0F, 0x05));
+	APP_BENCH("LCD_voidSendChar", LCD_voidSendChar('A'));
+	APP_BENCH("LCD_voidWriteString (20 chars)", LCD_voidWriteString((u8*)"01234567890123456789"));
+	APP_voidLcdDrain();
+	LCD_voidBufferWriteNumber(1234);
+	LCD_u8Flush();
+	APP_voidLcdDrain();
+	APP_BENCH("LCD_u8Flush (1 digit changed)", LCD_voidBufferGoTo(LCD_LINE_ONE, 3); LCD_voidBufferWriteChar('5'); LCD_u8Flush());
+	APP_BENCH("ADC_u16Read", ADC_u16Read(1));
+	APP_BENCH("LM35_f32GetTemperature", LM35_f32GetTemperature());
+	APP_BENCH("SEV_SEG_voidDisplayNumber", SEV_SEG_voidDisplayNumber(1234));
+	SOFT_I2C_voidInit();
+	APP_BENCH("SOFT_I2C_u8Write (2 bytes)", SOFT_I2C_u8Write(0x50, (const u8*)"\x00\x11", 2));
+}
+
+int main(void)
+{
+	APP_voidTestDio();
+	APP_voidTestLcd();
+	APP_voidTestLcdBuffer();
+	APP_voidTestLcdQueue();
+	APP_voidTestAdc();
+	APP_voidTestSevSeg();
+	APP_voidTestBusArb();
+	APP_voidTestSoftI2c();
+	APP_voidBenchmark();
+
+	printf("\n%u check(s) failed\n", APP_u8Failures);
+
+	return APP_u8Failures;
+}
@@ -0,0 +1,24 @@
+/*
+ * File: HOST_config.h
+ *
+ * Description:
+ *     Configuration header file for the HOST module.
+ *
+ * Usage:
+ *     - HOST_F_CPU: Simulated CPU clock used to convert delays to cycles. Defaults to
+ *       F_CPU when it is given on the command line.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef HOST_CONFIG_H_
+#define HOST_CONFIG_H_
+
+#ifdef F_CPU
+#define HOST_F_CPU               F_CPU
+#else
+#define HOST_F_CPU               8000000UL
+#endif
+
+#endif /* HOST_CONFIG_H_ */
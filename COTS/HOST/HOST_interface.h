@@ -0,0 +1,126 @@
+/*
+ * File: HOST_interface.h
+ *
+ * Description:
+ *     Header file for the HOST module: a simulated ATmega32 register file that lets the
+ *     drivers build and run with the host compiler (tests and micro-benchmarks on a PC).
+ *
+ *     With HOST_BUILD defined, HW_REG8/HW_REG16 (STD_TYPES.h) call HOST_pu8Register/
+ *     HOST_pu16Register instead of dereferencing the I/O address, and the headers under
+ *     HOST/include replace <util/delay.h>, <util/atomic.h> and <avr/interrupt.h>. The
+ *     driver sources are compiled unmodified, e.g. from the COTS directory:
+ *
+ *         gcc -std=gnu99 -DHOST_BUILD -DF_CPU=8000000UL -funsigned-char -fshort-enums \
+ *             -IHOST/include HOST/HOST_program.c HOST/HOST_APP.c \
+ *             MCAL/DIO/DIO_program.c MCAL/ADC/ADC_program.c HAL/LCD_4x20/LCD_program.c \
+ *             HAL/SEV_SEG/SEV_SEG_program.c HAL/BUS_ARB/BUS_ARB_program.c \
+ *             HAL/LM35/LM35_program.c MCAL/SOFT_I2C/SOFT_I2C_program.c -o host_app
+ *
+ *     -funsigned-char and -fshort-enums match the avr-gcc defaults the drivers rely on.
+ *
+ *     Register model:
+ *       - Writes are detected by value: every register access (and HOST_voidSync) compares
+ *         the register file against the last reported state and passes each changed
+ *         register to the write observer. A write that does not change the value is not
+ *         reported, and the last write of an API call is reported on the next access, so
+ *         call HOST_voidSync before checking results.
+ *       - A read hook registered for an address is called on every access of that
+ *         address and may replace the register value (e.g. a conversion result or a pin
+ *         level). DIO reaches PORTx/DDRx through the PINx address, so a PINx hook also
+ *         runs on PORTx/DDRx accesses of that port.
+ *       - PINx follows PORTx on output pins; input pins keep the level injected with a
+ *         read hook or HOST_voidSetRegister.
+ *       - _delay_us/_delay_ms advance a virtual cycle counter instead of sleeping.
+ *       - ISR(vector) defines a plain function named after the vector; the test calls it
+ *         to simulate the interrupt. sei/cli and ATOMIC_BLOCK act on the SREG I bit.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef HOST_INTERFACE_H_
+#define HOST_INTERFACE_H_
+
+/* Function: HOST_voidReset
+ * Description:
+ *     Clears the register file, the hooks, the observer and the counters (power-on state).
+ */
+void HOST_voidReset(void);
+
+/* Function: HOST_pu8Register
+ * Description:
+ *     Register access used by HW_REG8. Reports pending writes, runs the read hook of
+ *     the address and returns the address of the simulated register.
+ *     Addresses outside the register file return a scratch byte and are counted.
+ */
+volatile u8* HOST_pu8Register(u16 Copy_u16Address);
+
+/* Function: HOST_pu16Register
+ * Description:
+ *     Register pair access used by HW_REG16 (low byte at the even address). Runs the
+ *     read hooks of both bytes and returns a properly typed and aligned u16, so 16-bit
+ *     registers are never accessed through a cast u8 pointer.
+ *     Odd or out-of-range addresses return a scratch word and are counted.
+ */
+volatile u16* HOST_pu16Register(u16 Copy_u16Address);
+
+/* Function: HOST_voidSetWriteObserver
+ * Description:
+ *     Registers the function called for every register changed by the drivers, in
+ *     ascending address order per access. NULL disables it. The observer must not
+ *     access registers through HW_REG8 (use HOST_u8GetRegister).
+ */
+void HOST_voidSetWriteObserver(void (*Copy_pvObserver)(u16 Copy_u16Address, u8 Copy_u8OldValue, u8 Copy_u8NewValue));
+
+/* Function: HOST_voidSetReadHook
+ * Description:
+ *     Registers the function called on every access of Copy_u16Address. It receives the
+ *     current value and returns the value the driver sees; the change is an injection
+ *     and is not reported to the write observer. NULL removes the hook.
+ */
+void HOST_voidSetReadHook(u16 Copy_u16Address, u8 (*Copy_pfReadHook)(u16 Copy_u16Address, u8 Copy_u8Value));
+
+/* Function: HOST_voidSetRegister
+ * Description:
+ *     Injects a register value without reporting it as a write (hardware side).
+ */
+void HOST_voidSetRegister(u16 Copy_u16Address, u8 Copy_u8Value);
+
+/* Function: HOST_u8GetRegister
+ * Description:
+ *     Returns a register value without running hooks or counting an access.
+ */
+u8 HOST_u8GetRegister(u16 Copy_u16Address);
+
+/* Function: HOST_voidSync
+ * Description:
+ *     Reports the writes made since the last register access to the write observer.
+ */
+void HOST_voidSync(void);
+
+/* Function: HOST_voidDelayUs
+ * Description:
+ *     Advances the virtual clock; used by the <util/delay.h> replacement.
+ */
+void HOST_voidDelayUs(f64 Copy_f64Us);
+
+/* Function: HOST_u32GetCycles
+ * Description:
+ *     Returns the virtual CPU cycles spent in delays since HOST_voidReset (wraps at 2^32).
+ */
+u32 HOST_u32GetCycles(void);
+
+/* Function: HOST_u32GetAccessCount
+ * Description:
+ *     Returns the number of register accesses made through HW_REG8/HW_REG16 since
+ *     HOST_voidReset.
+ */
+u32 HOST_u32GetAccessCount(void);
+
+/* Function: HOST_u32GetUnmappedCount
+ * Description:
+ *     Returns the number of accesses to addresses outside the register file.
+ */
+u32 HOST_u32GetUnmappedCount(void);
+
+#endif /* HOST_INTERFACE_H_ */
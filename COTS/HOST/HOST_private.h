@@ -0,0 +1,31 @@
+/*
+ * File: HOST_private.h
+ *
+ * Description:
+ *     Private header file for the HOST module.
+ *     It defines the size of the simulated register file and the ATmega32 addresses the
+ *     model treats specially (SREG and the PINx/DDRx/PORTx blocks).
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef HOST_PRIVATE_H_
+#define HOST_PRIVATE_H_
+
+/* Register file: data memory addresses 0x00..0x5F (R0..R31 and the 64 I/O registers) */
+#define HOST_REGISTERS_NUM       0x60
+
+/* Status Register and its Global Interrupt Enable bit */
+#define HOST_SREG_ADDRESS        0x5F
+#define HOST_SREG_I              7
+
+/* Port register blocks: PINx, DDRx, PORTx at consecutive addresses, PORTA highest */
+#define HOST_PINA_ADDRESS        0x39
+#define HOST_PORT_BLOCK_SIZE     3
+#define HOST_PORTS_NUM           4
+#define HOST_PIN_ADDRESS(PortId)   (HOST_PINA_ADDRESS - (HOST_PORT_BLOCK_SIZE * (PortId)))
+#define HOST_DDR_ADDRESS(PortId)   (HOST_PIN_ADDRESS(PortId) + 1)
+#define HOST_PORT_ADDRESS(PortId)  (HOST_PIN_ADDRESS(PortId) + 2)
+
+#endif /* HOST_PRIVATE_H_ */
@@ -0,0 +1,290 @@
+/*
+ * File: HOST_program.c
+ *
+ * Description:
+ *     Implementation of the HOST module: the simulated register file behind HW_REG8 and
+ *     HW_REG16 in host builds, the write observer and read hooks, and the virtual clock
+ *     and interrupt flag used by the <util/delay.h>, <util/atomic.h> and <avr/interrupt.h>
+ *     replacements under HOST/include.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB (host replacements) */
+#include <util/delay.h>
+#include <util/atomic.h>
+#include <avr/interrupt.h>
+
+/* UTILS_LIB */
+#include "../UTIL_LIB/STD_TYPES.h"
+#include "../UTIL_LIB/BIT_MATH.h"
+
+/* HOST */
+#include "./HOST_interface.h"
+#include "./HOST_private.h"
+#include "./HOST_config.h"
+
+#ifndef HOST_BUILD
+#error "HOST_program.c is part of the host build only (compile with -DHOST_BUILD)"
+#endif
+
+/*
+ * Simulated registers and the state last reported to the write observer. The register
+ * file is a union so HW_REG16 accesses a real u16 object (aligned, no type punning
+ * through a cast pointer); the bytes stay addressable as u8 for HW_REG8. The host is
+ * little-endian like the AVR, so TCNT1L/TCNT1H land at the same addresses.
+ */
+static union
+{
+	u8  Au8[HOST_REGISTERS_NUM];
+	u16 Au16[HOST_REGISTERS_NUM / 2];
+} HOST_URegister;
+#define HOST_Au8Register         HOST_URegister.Au8
+static u8 HOST_Au8Reported[HOST_REGISTERS_NUM];
+
+/* Targets of accesses outside the register file */
+static u8 HOST_u8Unmapped;
+static u16 HOST_u16Unmapped;
+
+/* Read hooks, indexed by address */
+static u8 (*HOST_Apf8ReadHook[HOST_REGISTERS_NUM])(u16 Copy_u16Address, u8 Copy_u8Value);
+
+/* Write observer */
+static void (*HOST_pvWriteObserver)(u16 Copy_u16Address, u8 Copy_u8OldValue, u8 Copy_u8NewValue) = NULL;
+
+/* Counters */
+static u32 HOST_u32Cycles;
+static u32 HOST_u32AccessCount;
+static u32 HOST_u32UnmappedCount;
+
+/*
+ * Function: HOST_voidReset
+ * Description:
+ *     Returns the register file and every hook and counter to the power-on state.
+ */
+void HOST_voidReset(void)
+{
+	u16 Local_u16Address;
+
+	for (Local_u16Address = 0; Local_u16Address < HOST_REGISTERS_NUM; Local_u16Address++)
+	{
+		HOST_Au8Register[Local_u16Address] = 0;
+		HOST_Au8Reported[Local_u16Address] = 0;
+		HOST_Apf8ReadHook[Local_u16Address] = NULL;
+	}
+
+	HOST_pvWriteObserver = NULL;
+	HOST_u8Unmapped = 0;
+	HOST_u16Unmapped = 0;
+	HOST_u32Cycles = 0;
+	HOST_u32AccessCount = 0;
+	HOST_u32UnmappedCount = 0;
+}
+
+/*
+ * Function: HOST_pu8Register
+ * Description:
+ *     Reports the writes made through the previously returned pointer, lets the read hook
+ *     of the address inject its value, then hands out the simulated register.
+ */
+volatile u8* HOST_pu8Register(u16 Copy_u16Address)
+{
+	u8 Local_u8Value;
+
+	HOST_u32AccessCount++;
+	HOST_voidSync();
+
+	if (Copy_u16Address >= HOST_REGISTERS_NUM)
+	{
+		HOST_u32UnmappedCount++;
+		return &HOST_u8Unmapped;
+	}
+
+	if (HOST_Apf8ReadHook[Copy_u16Address] != NULL)
+	{
+		Local_u8Value = HOST_Apf8ReadHook[Copy_u16Address](Copy_u16Address, HOST_Au8Register[Copy_u16Address]);
+		HOST_voidSetRegister(Copy_u16Address, Local_u8Value);
+	}
+
+	return &HOST_Au8Register[Copy_u16Address];
+}
+
+/*
+ * Function: HOST_pu16Register
+ * Description:
+ *     16-bit counterpart of HOST_pu8Register: reports the pending writes, runs the read
+ *     hooks of the low then the high byte, then hands out the register pair as a u16.
+ *     Odd addresses are not a 16-bit register on the ATmega32 and count as unmapped.
+ */
+volatile u16* HOST_pu16Register(u16 Copy_u16Address)
+{
+	u8 Local_u8Value;
+	u16 Local_u16Address;
+
+	HOST_u32AccessCount++;
+	HOST_voidSync();
+
+	if ((Copy_u16Address >= HOST_REGISTERS_NUM) || ((Copy_u16Address & 1) != 0))
+	{
+		HOST_u32UnmappedCount++;
+		return &HOST_u16Unmapped;
+	}
+
+	for (Local_u16Address = Copy_u16Address; Local_u16Address <= Copy_u16Address + 1; Local_u16Address++)
+	{
+		if (HOST_Apf8ReadHook[Local_u16Address] != NULL)
+		{
+			Local_u8Value = HOST_Apf8ReadHook[Local_u16Address](Local_u16Address, HOST_Au8Register[Local_u16Address]);
+			HOST_voidSetRegister(Local_u16Address, Local_u8Value);
+		}
+	}
+
+	return &HOST_URegister.Au16[Copy_u16Address / 2];
+}
+
+void HOST_voidSetWriteObserver(void (*Copy_pvObserver)(u16 Copy_u16Address, u8 Copy_u8OldValue, u8 Copy_u8NewValue))
+{
+	HOST_voidSync();
+	HOST_pvWriteObserver = Copy_pvObserver;
+}
+
+void HOST_voidSetReadHook(u16 Copy_u16Address, u8 (*Copy_pfReadHook)(u16 Copy_u16Address, u8 Copy_u8Value))
+{
+	if (Copy_u16Address < HOST_REGISTERS_NUM)
+	{
+		HOST_Apf8ReadHook[Copy_u16Address] = Copy_pfReadHook;
+	}
+}
+
+/*
+ * Function: HOST_voidSetRegister
+ * Description:
+ *     Writes both the register and its reported copy, so the value reads back in the
+ *     drivers but never reaches the write observer.
+ */
+void HOST_voidSetRegister(u16 Copy_u16Address, u8 Copy_u8Value)
+{
+	if (Copy_u16Address < HOST_REGISTERS_NUM)
+	{
+		HOST_Au8Register[Copy_u16Address] = Copy_u8Value;
+		HOST_Au8Reported[Copy_u16Address] = Copy_u8Value;
+	}
+}
+
+u8 HOST_u8GetRegister(u16 Copy_u16Address)
+{
+	u8 Local_u8Value = 0;
+
+	if (Copy_u16Address < HOST_REGISTERS_NUM)
+	{
+		Local_u8Value = HOST_Au8Register[Copy_u16Address];
+	}
+
+	return Local_u8Value;
+}
+
+/*
+ * Function: HOST_voidSync
+ * Description:
+ *     Passes every register that differs from its reported copy to the write observer,
+ *     then drives the output bits of each PINx from PORTx (input bits keep their
+ *     injected level).
+ */
+void HOST_voidSync(void)
+{
+	u16 Local_u16Address;
+	u8 Local_u8OldValue;
+	u8 Local_u8PortId;
+	u8 Local_u8Ddr;
+
+	for (Local_u16Address = 0; Local_u16Address < HOST_REGISTERS_NUM; Local_u16Address++)
+	{
+		if (HOST_Au8Register[Local_u16Address] != HOST_Au8Reported[Local_u16Address])
+		{
+			Local_u8OldValue = HOST_Au8Reported[Local_u16Address];
+			HOST_Au8Reported[Local_u16Address] = HOST_Au8Register[Local_u16Address];
+
+			if (HOST_pvWriteObserver != NULL)
+			{
+				HOST_pvWriteObserver(Local_u16Address, Local_u8OldValue, HOST_Au8Register[Local_u16Address]);
+			}
+		}
+	}
+
+	for (Local_u8PortId = 0; Local_u8PortId < HOST_PORTS_NUM; Local_u8PortId++)
+	{
+		Local_u8Ddr = HOST_Au8Register[HOST_DDR_ADDRESS(Local_u8PortId)];
+		HOST_voidSetRegister(HOST_PIN_ADDRESS(Local_u8PortId),
+		                     (HOST_Au8Register[HOST_PIN_ADDRESS(Local_u8PortId)] & (u8)~Local_u8Ddr) |
+		                     (HOST_Au8Register[HOST_PORT_ADDRESS(Local_u8PortId)] & Local_u8Ddr));
+	}
+}
+
+/*
+ * Function: HOST_voidDelayUs
+ * Description:
+ *     Reports the writes made before the delay (so an observer sees them at the time
+ *     they happened) and advances the virtual clock by the delay in CPU cycles.
+ */
+void HOST_voidDelayUs(f64 Copy_f64Us)
+{
+	HOST_voidSync();
+
+	if (Copy_f64Us > 0)
+	{
+		HOST_u32Cycles += (u32)((Copy_f64Us * (f64)HOST_F_CPU) / 1000000.0 + 0.5);
+	}
+}
+
+u32 HOST_u32GetCycles(void)
+{
+	return HOST_u32Cycles;
+}
+
+u32 HOST_u32GetAccessCount(void)
+{
+	return HOST_u32AccessCount;
+}
+
+u32 HOST_u32GetUnmappedCount(void)
+{
+	return HOST_u32UnmappedCount;
+}
+
+/*
+ * Interrupt flag: sei/cli and ATOMIC_BLOCK update the SREG I bit directly (not reported
+ * as a driver write), so a test can check the interrupt state with HOST_u8GetRegister.
+ */
+void HOST_voidSei(void)
+{
+	HOST_voidSync();
+	HOST_voidSetRegister(HOST_SREG_ADDRESS, HOST_Au8Register[HOST_SREG_ADDRESS] | (1 << HOST_SREG_I));
+}
+
+void HOST_voidCli(void)
+{
+	HOST_voidSync();
+	HOST_voidSetRegister(HOST_SREG_ADDRESS, HOST_Au8Register[HOST_SREG_ADDRESS] & (u8)~(1 << HOST_SREG_I));
+}
+
+u8 HOST_u8AtomicEnter(void)
+{
+	u8 Local_u8Sreg = HOST_Au8Register[HOST_SREG_ADDRESS];
+
+	HOST_voidCli();
+
+	return Local_u8Sreg;
+}
+
+void HOST_voidAtomicExit(u8 Copy_u8Sreg, u8 Copy_u8ForceOn)
+{
+	HOST_voidSync();
+
+	if (Copy_u8ForceOn)
+	{
+		SET_BIT(Copy_u8Sreg, HOST_SREG_I);
+	}
+
+	HOST_voidSetRegister(HOST_SREG_ADDRESS, Copy_u8Sreg);
+}
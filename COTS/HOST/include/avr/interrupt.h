@@ -0,0 +1,26 @@
+/*
+ * File: avr/interrupt.h (host build)
+ *
+ * Description:
+ *     Replacement for the avr-libc interrupt header in host builds (see HOST_interface.h).
+ *     ISR(vector) defines an ordinary function named after the vector, which a test calls
+ *     to simulate the interrupt; sei/cli set and clear the simulated SREG I bit.
+ */
+
+#ifndef HOST_AVR_INTERRUPT_H_
+#define HOST_AVR_INTERRUPT_H_
+
+void HOST_voidSei(void);
+void HOST_voidCli(void);
+
+#define sei()                   HOST_voidSei()
+#define cli()                   HOST_voidCli()
+#define reti()                  return
+
+#define ISR_BLOCK
+#define ISR_NOBLOCK
+#define ISR_NAKED
+
+#define ISR(Vector, ...)        void Vector(void); void Vector(void)
+
+#endif /* HOST_AVR_INTERRUPT_H_ */
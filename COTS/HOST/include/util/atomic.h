@@ -0,0 +1,24 @@
+/*
+ * File: util/atomic.h (host build)
+ *
+ * Description:
+ *     Replacement for the avr-libc atomic blocks in host builds (see HOST_interface.h).
+ *     The block clears the simulated SREG I bit on entry and restores it (or sets it,
+ *     for ATOMIC_FORCEON) on exit, like the target version.
+ */
+
+#ifndef HOST_UTIL_ATOMIC_H_
+#define HOST_UTIL_ATOMIC_H_
+
+unsigned char HOST_u8AtomicEnter(void);
+void HOST_voidAtomicExit(unsigned char Copy_u8Sreg, unsigned char Copy_u8ForceOn);
+
+#define ATOMIC_RESTORESTATE     0
+#define ATOMIC_FORCEON          1
+
+#define ATOMIC_BLOCK(Type) \
+        for (unsigned char HOST_u8SregSave = HOST_u8AtomicEnter(), HOST_u8BlockOnce = 1; \
+             HOST_u8BlockOnce; \
+             HOST_voidAtomicExit(HOST_u8SregSave, (Type)), HOST_u8BlockOnce = 0)
+
+#endif /* HOST_UTIL_ATOMIC_H_ */
@@ -0,0 +1,17 @@
+/*
+ * File: util/delay.h (host build)
+ *
+ * Description:
+ *     Replacement for the avr-libc busy-wait delays in host builds (see HOST_interface.h).
+ *     The delays advance the HOST virtual clock and return immediately.
+ */
+
+#ifndef HOST_UTIL_DELAY_H_
+#define HOST_UTIL_DELAY_H_
+
+void HOST_voidDelayUs(double Copy_f64Us);
+
+#define _delay_us(Us)    HOST_voidDelayUs((double)(Us))
+#define _delay_ms(Ms)    HOST_voidDelayUs((double)(Ms) * 1000.0)
+
+#endif /* HOST_UTIL_DELAY_H_ */
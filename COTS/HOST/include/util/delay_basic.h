@@ -0,0 +1,18 @@
+/*
+ * File: util/delay_basic.h (host build)
+ *
+ * Description:
+ *     Replacement for the avr-libc counted delay loops in host builds (see HOST_interface.h).
+ *     The loops advance the HOST virtual clock by their cycle count (3 cycles per count of
+ *     _delay_loop_1, 4 per count of _delay_loop_2) and return immediately.
+ */
+
+#ifndef HOST_UTIL_DELAY_BASIC_H_
+#define HOST_UTIL_DELAY_BASIC_H_
+
+void HOST_voidDelayUs(double Copy_f64Us);
+
+#define _delay_loop_1(Count)    HOST_voidDelayUs((double)(Count) * 3.0 * 1000000.0 / F_CPU)
+#define _delay_loop_2(Count)    HOST_voidDelayUs((double)(Count) * 4.0 * 1000000.0 / F_CPU)
+
+#endif /* HOST_UTIL_DELAY_BASIC_H_ */
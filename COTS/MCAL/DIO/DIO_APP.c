@@ -5,7 +5,9 @@
  *     Test file for the Digital Input/Output (DIO) module on an AVR ATmega32
  *     engineering kit. This file demonstrates various test scenarios for LED
  *     control using the DIO driver, including direct port manipulation, individual
- *     pin control, channel mode operation, and configuration array initialization.
+ *     pin control, channel mode operation, configuration mask initialization, the
+ *     specialized pin access macros, in deferred shadow mode batched commits, and with
+ *     DIO_TRACE_ENABLED the output write trace.
  *
  * Author: [Your Name]
  * Date: [Specify Date Here]
@@ -21,6 +23,31 @@
 /* MCAL */
 #include "../DIO/DIO_interface.h"
 #include "../DIO/DIO_private.h"
+#include "../DIO/DIO_config.h"
+
+/*
+ * Timer1 registers used by Test Set 5 as a CPU cycle counter (no prescaling).
+ * Defined locally because this test file has no dependency on a timer driver.
+ */
+#define TCCR1B         HW_REG8(0x4E)
+#define TCNT1          HW_REG16(0x4C)
+
+/* Number of calls averaged per measurement in Test Set 5 */
+#define DIO_BENCH_CALLS        100
+
+/*
+ * Test Set 5 results: cycles per call, indexed as
+ *   [0] DIO_setPinValue        [1] DIO_SET_PIN_VALUE
+ *   [2] DIO_getPinValue        [3] DIO_GET_PIN_VALUE
+ *   [4] DIO_togglePinValue     [5] DIO_TOGGLE_PIN_VALUE
+ * Inspect in the debugger or simulator once the test has run.
+ */
+volatile u16 DIO_Au16BenchCycles[6];
+
+#if DIO_TRACE_MODE == DIO_TRACE_ENABLED
+/* Test Set 7 results: trace entries of eight LED toggles, for the debugger */
+Dio_TRACE_ENTRY DIO_AstrTraceResult[8];
+#endif
 
 int main(void) {
 
@@ -95,12 +122,12 @@ int main(void) {
     DIO_setChannelValue(Dio_PINA_6, DIO_PIN_LOW);  // Turn off Yellow LED
 
     /*
-     * Test Set 4: Initialization Using Configuration Array
+     * Test Set 4: Initialization Using Configuration Masks
      * Description:
-     *     This test uses a configuration array to initialize all DIO pins.
+     *     This test uses the DIO_config.h masks to initialize all DIO pins.
      *     The LEDs are controlled in a sequence similar to previous tests.
      */
-    DIO_initPinsConfig(); // Initialize all pins as per configuration array
+    DIO_initPinsConfig(); // Initialize all pins as per DIO_config.h
 
     DIO_setPinValue(DIO_PORTB, DIO_PIN7, DIO_PIN_HIGH); // Turn on Red LED
     _delay_ms(1000);
@@ -115,5 +142,132 @@ int main(void) {
     _delay_ms(1000);
     DIO_togglePinValue(DIO_PORTA, DIO_PIN6);            // Turn off Yellow LED
 
+    /*
+     * Test Set 5: Runtime Path vs Compile-Time Specialized Path
+     * Description:
+     *     This test times DIO_BENCH_CALLS calls of each runtime API and of its
+     *     constant-argument macro form using Timer1 at F_CPU, subtracts the cost of
+     *     an empty loop, and stores the cycles per call in DIO_Au16BenchCycles.
+     *     The Red LED is used as the target pin; build with optimization enabled.
+     */
+    {
+        u8 Local_u8Counter;
+        u8 Local_u8Value;
+        u16 Local_u16Start;
+        u16 Local_u16Overhead;
+        u16 Local_u16Elapsed[6];
+
+        TCCR1B = 0x01;  // Start Timer1 with no prescaling
+
+        Local_u16Start = TCNT1;
+        for(Local_u8Counter = 0; Local_u8Counter < DIO_BENCH_CALLS; Local_u8Counter++)
+        {
+            __asm__ __volatile__("" ::: "memory");
+        }
+        Local_u16Overhead = TCNT1 - Local_u16Start;
+
+        Local_u16Start = TCNT1;
+        for(Local_u8Counter = 0; Local_u8Counter < DIO_BENCH_CALLS; Local_u8Counter++)
+        {
+            DIO_setPinValue(DIO_PORTB, DIO_PIN7, DIO_PIN_LOW);
+        }
+        Local_u16Elapsed[0] = TCNT1 - Local_u16Start;
+
+        Local_u16Start = TCNT1;
+        for(Local_u8Counter = 0; Local_u8Counter < DIO_BENCH_CALLS; Local_u8Counter++)
+        {
+            DIO_SET_PIN_VALUE(DIO_PORTB, DIO_PIN7, DIO_PIN_LOW);
+        }
+        Local_u16Elapsed[1] = TCNT1 - Local_u16Start;
+
+        Local_u16Start = TCNT1;
+        for(Local_u8Counter = 0; Local_u8Counter < DIO_BENCH_CALLS; Local_u8Counter++)
+        {
+            DIO_getPinValue(DIO_PORTB, DIO_PIN7, &Local_u8Value);
+        }
+        Local_u16Elapsed[2] = TCNT1 - Local_u16Start;
+
+        Local_u16Start = TCNT1;
+        for(Local_u8Counter = 0; Local_u8Counter < DIO_BENCH_CALLS; Local_u8Counter++)
+        {
+            Local_u8Value = DIO_GET_PIN_VALUE(DIO_PORTB, DIO_PIN7);
+            __asm__ __volatile__("" :: "r"(Local_u8Value));
+        }
+        Local_u16Elapsed[3] = TCNT1 - Local_u16Start;
+
+        Local_u16Start = TCNT1;
+        for(Local_u8Counter = 0; Local_u8Counter < DIO_BENCH_CALLS; Local_u8Counter++)
+        {
+            DIO_togglePinValue(DIO_PORTB, DIO_PIN7);
+        }
+        Local_u16Elapsed[4] = TCNT1 - Local_u16Start;
+
+        Local_u16Start = TCNT1;
+        for(Local_u8Counter = 0; Local_u8Counter < DIO_BENCH_CALLS; Local_u8Counter++)
+        {
+            DIO_TOGGLE_PIN_VALUE(DIO_PORTB, DIO_PIN7);
+        }
+        Local_u16Elapsed[5] = TCNT1 - Local_u16Start;
+
+        TCCR1B = 0x00;  // Stop Timer1
+
+        for(Local_u8Counter = 0; Local_u8Counter < 6; Local_u8Counter++)
+        {
+            DIO_Au16BenchCycles[Local_u8Counter] = (Local_u16Elapsed[Local_u8Counter] - Local_u16Overhead) / DIO_BENCH_CALLS;
+        }
+    }
+
+#if DIO_SHADOW_MODE == DIO_SHADOW_DEFERRED
+    /*
+     * Test Set 6: Deferred Shadow Registers
+     * Description:
+     *     The LED updates below only change the shadow registers; nothing changes on
+     *     the kit until DIO_commit writes PORTA and PORTB, lighting all four LEDs at once.
+     */
+    DIO_setPortValue(DIO_PORTA, 0x00);
+    DIO_setPortValue(DIO_PORTB, 0x00);
+    DIO_commit();
+    _delay_ms(1000);
+
+    DIO_setPinValue(DIO_PORTA, DIO_PIN4, DIO_PIN_HIGH);
+    DIO_setPinValue(DIO_PORTA, DIO_PIN5, DIO_PIN_HIGH);
+    DIO_setPinValue(DIO_PORTA, DIO_PIN6, DIO_PIN_HIGH);
+    DIO_setPinValue(DIO_PORTB, DIO_PIN7, DIO_PIN_HIGH);
+    _delay_ms(1000);    // LEDs still off
+    DIO_commit();       // All four LEDs on together
+#endif
+
+#if DIO_TRACE_MODE == DIO_TRACE_ENABLED
+    /*
+     * Test Set 7: Output Write Trace
+     * Description:
+     *     Empties the trace filled by the previous test sets, blinks the red LED with the
+     *     Timer1 timestamp running at 1 us per count (TCCR1B = 2 at 8 MHz), and copies the
+     *     entries to DIO_AstrTraceResult: the Time fields should be 1000 apart (1 ms delays)
+     *     and Value should alternate bit 7.
+     */
+    {
+        u8 Local_u8Counter;
+
+        while(DIO_traceRead(&DIO_AstrTraceResult[0]))
+        {
+        }
+
+        TCNT1 = 0;
+        TCCR1B = 0x02;
+        for(Local_u8Counter = 0; Local_u8Counter < 8; Local_u8Counter++)
+        {
+            DIO_togglePinValue(DIO_PORTB, DIO_PIN7);
+            _delay_ms(1);
+        }
+        TCCR1B = 0x00;
+
+        for(Local_u8Counter = 0; Local_u8Counter < 8; Local_u8Counter++)
+        {
+            DIO_traceRead(&DIO_AstrTraceResult[Local_u8Counter]);
+        }
+    }
+#endif
+
     return 0;
 }
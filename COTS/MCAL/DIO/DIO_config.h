@@ -0,0 +1,240 @@
+/*
+ * File: DIO_config.h
+ *
+ * Description:
+ *     Configuration header file for the Digital Input/Output (DIO) module for AVR ATmega32.
+ *     This file selects build-time options of the DIO driver. The option values are
+ *     defined in DIO_private.h; only the selections are made here.
+ *
+ * Usage:
+ *     - DIO_TOGGLE_MODE: Selects how DIO_togglePinValue, DIO_togglePortValue (and the
+ *       DIO_TOGGLE_PIN_VALUE macro) invert output pins.
+ *         DIO_TOGGLE_READ_MODIFY_WRITE : PORTx ^= mask. Fast, but not atomic; an ISR
+ *                                        writing the same port in between can lose its update.
+ *         DIO_TOGGLE_ATOMIC            : PORTx ^= mask with interrupts disabled for the
+ *                                        read-modify-write. ISR-safe on every AVR.
+ *         DIO_TOGGLE_PIN_REGISTER      : Writes 1s to PINx, which the silicon toggles in
+ *                                        hardware with one write. Only on parts that support
+ *                                        it (e.g. ATmega164/324/644, ATmega48/88/168/328);
+ *                                        the ATmega32 does NOT.
+ *
+ *     - DIO_SHADOW_MODE: Selects whether the driver keeps RAM copies of PORTx and DDRx.
+ *         DIO_SHADOW_DISABLED  : Writes modify the registers directly, as read-modify-write.
+ *         DIO_SHADOW_IMMEDIATE : Writes modify the shadow with interrupts disabled and store it
+ *                                to the register at once. No register is read back, and an ISR
+ *                                using DIO on the same port can no longer lose an update.
+ *         DIO_SHADOW_DEFERRED  : Writes only modify the shadow; DIO_commit() stores all modified
+ *                                registers at once, coalescing the updates of several drivers
+ *                                into one write per register. Writes made from interrupts are
+ *                                deferred too, so tick-driven drivers need a commit per tick.
+ *                                The bit-banged drivers (LCD, BUS_ARB, SOFT_I2C, HC595, KEYPAD)
+ *                                need their edges on the pins at once and reject this mode.
+ *       With shadow registers, all PORTx/DDRx writes must go through DIO (or update the shadow,
+ *       see DIO_private.h), and the DIO_SET/TOGGLE_PIN_VALUE macros always take the runtime path.
+ *
+ *     - DIO_TRACE_MODE: Records the output writes of the runtime DIO APIs for debugging.
+ *         DIO_TRACE_DISABLED : No trace code at all (the default).
+ *         DIO_TRACE_ENABLED  : Every PORTx write made by a set/toggle/port/masked/bus API adds
+ *                              one entry (Timer1 timestamp, port, pins written, new PORTx
+ *                              value) to a ring buffer read with DIO_traceRead/DIO_traceDrain.
+ *                              The DIO_SET/TOGGLE_PIN_VALUE macros take the runtime path so
+ *                              they are traced too. The timestamp is TCNT1: the application
+ *                              starts Timer1 with the resolution it needs, e.g. TCCR1B = 2
+ *                              (1 us per count at 8 MHz, wraps after 65 ms).
+ *     - DIO_TRACE_BUFFER_SIZE: Trace entries kept, power of two up to 128 (5 bytes each).
+ *       When the buffer is full new entries are dropped and counted (DIO_traceGetLost).
+ *
+ *     - DIO_PIN_MAP: Selects where the initial pin configuration comes from.
+ *         DIO_PIN_MAP_CONFIG    : The DIO_PORTx_... tables below.
+ *         DIO_PIN_MAP_GENERATED : PINMAP/PINMAP_generated.h, generated from the board pin map
+ *                                 PINMAP/pinmap.txt by the PINMAP/pinmap.mk build step. The same
+ *                                 header holds the pins and masked-write constants of every
+ *                                 driver, and the step fails on a pin conflict. The drivers
+ *                                 then take their DIO channels from the map, or fail to build
+ *                                 when their configured pins differ from it. A driver
+ *                                 including its config must include DIO_config.h first.
+ *
+ *     - DIO_PORTx_DIRECTION / DIO_PORTx_INITIAL_VALUE / DIO_PORTx_PULL_UP: Initial pin
+ *       configuration applied by DIO_initPinsConfig. Each is one byte per port, listed
+ *       pin by pin from PIN0 to PIN7 and packed into a bit mask at compile time.
+ *         DIRECTION     : DIO_PIN_INPUT or DIO_PIN_OUTPUT
+ *         INITIAL_VALUE : DIO_PIN_LOW or DIO_PIN_HIGH, used by output pins only
+ *         PULL_UP       : DIO_PULL_UP_DISABLED or DIO_PULL_UP_ENABLED, used by input pins only
+ *
+ * Notes:
+ *     - Files that use the DIO_SET_PIN_VALUE or DIO_TOGGLE_PIN_VALUE macros must include this header.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef DIO_CONFIG_H_
+#define DIO_CONFIG_H_
+
+/* Toggle implementation */
+/* Options: DIO_TOGGLE_READ_MODIFY_WRITE, DIO_TOGGLE_ATOMIC, DIO_TOGGLE_PIN_REGISTER */
+#define DIO_TOGGLE_MODE       DIO_TOGGLE_ATOMIC
+
+/* Shadow registers */
+/* Options: DIO_SHADOW_DISABLED, DIO_SHADOW_IMMEDIATE, DIO_SHADOW_DEFERRED */
+#define DIO_SHADOW_MODE       DIO_SHADOW_DISABLED
+
+/* Output write trace */
+/* Options: DIO_TRACE_DISABLED, DIO_TRACE_ENABLED */
+#define DIO_TRACE_MODE        DIO_TRACE_DISABLED
+#define DIO_TRACE_BUFFER_SIZE 64
+
+/* Initial pin configuration source */
+/* Options: DIO_PIN_MAP_CONFIG, DIO_PIN_MAP_GENERATED */
+#define DIO_PIN_MAP           DIO_PIN_MAP_CONFIG
+
+#if DIO_PIN_MAP == DIO_PIN_MAP_GENERATED
+#include "../../PINMAP/PINMAP_generated.h"
+#else
+
+/*
+ * Initial Pins Configuration: the board of PINMAP/pinmap.txt (default variant, no -D
+ * option), so both DIO_PIN_MAP sources start the pins alike. Keep the two in step.
+ * Keypad rows are open drain (inputs without pull-up, PORT bit low: the driver pulls a
+ * row low by making it an output) and the columns are read with their pull-ups. The
+ * seven-segment COM lines (shared with LCD RS/E) idle high so every digit starts off.
+ */
+
+/* PORTA */
+#define DIO_PORTA_DIRECTION         DIO_PORT_BITS(                             \
+        DIO_PIN_OUTPUT,         /* PIN0 --> HC595 DS */                        \
+        DIO_PIN_INPUT,          /* PIN1 --> LM35 output (ADC1) */              \
+        DIO_PIN_OUTPUT,         /* PIN2 --> LCD E / 7-seg COM 2 */             \
+        DIO_PIN_OUTPUT,         /* PIN3 --> LCD RS / 7-seg COM 1 */            \
+        DIO_PIN_OUTPUT,         /* PIN4 --> Green LED */                       \
+        DIO_PIN_OUTPUT,         /* PIN5 --> Blue LED */                        \
+        DIO_PIN_OUTPUT,         /* PIN6 --> Yellow LED */                      \
+        DIO_PIN_OUTPUT          /* PIN7 --> HC595 SH_CP */                     \
+        )
+
+#define DIO_PORTA_INITIAL_VALUE     DIO_PORT_BITS(                             \
+        DIO_PIN_LOW,            /* PIN0 --> HC595 DS */                        \
+        DIO_PIN_LOW,            /* PIN1 --> LM35 output (ADC1) */              \
+        DIO_PIN_HIGH,           /* PIN2 --> LCD E / 7-seg COM 2 */             \
+        DIO_PIN_HIGH,           /* PIN3 --> LCD RS / 7-seg COM 1 */            \
+        DIO_PIN_LOW,            /* PIN4 --> Green LED */                       \
+        DIO_PIN_LOW,            /* PIN5 --> Blue LED */                        \
+        DIO_PIN_LOW,            /* PIN6 --> Yellow LED */                      \
+        DIO_PIN_LOW             /* PIN7 --> HC595 SH_CP */                     \
+        )
+
+#define DIO_PORTA_PULL_UP           DIO_PORT_BITS(                             \
+        DIO_PULL_UP_DISABLED,   /* PIN0 --> HC595 DS */                        \
+        DIO_PULL_UP_DISABLED,   /* PIN1 --> LM35 output (ADC1) */              \
+        DIO_PULL_UP_DISABLED,   /* PIN2 --> LCD E / 7-seg COM 2 */             \
+        DIO_PULL_UP_DISABLED,   /* PIN3 --> LCD RS / 7-seg COM 1 */            \
+        DIO_PULL_UP_DISABLED,   /* PIN4 --> Green LED */                       \
+        DIO_PULL_UP_DISABLED,   /* PIN5 --> Blue LED */                        \
+        DIO_PULL_UP_DISABLED,   /* PIN6 --> Yellow LED */                      \
+        DIO_PULL_UP_DISABLED    /* PIN7 --> HC595 SH_CP */                     \
+        )
+
+/* PORTB */
+#define DIO_PORTB_DIRECTION         DIO_PORT_BITS(                             \
+        DIO_PIN_OUTPUT,         /* PIN0 --> LCD D4 / 7-seg BCD A */            \
+        DIO_PIN_OUTPUT,         /* PIN1 --> LCD D5 / 7-seg BCD B */            \
+        DIO_PIN_OUTPUT,         /* PIN2 --> LCD D6 / 7-seg BCD C */            \
+        DIO_PIN_OUTPUT,         /* PIN3 --> LCD RW */                          \
+        DIO_PIN_OUTPUT,         /* PIN4 --> LCD D7 / 7-seg BCD D */            \
+        DIO_PIN_OUTPUT,         /* PIN5 --> 7-seg COM 3 */                     \
+        DIO_PIN_OUTPUT,         /* PIN6 --> 7-seg COM 4 */                     \
+        DIO_PIN_OUTPUT          /* PIN7 --> Red LED */                         \
+        )
+
+#define DIO_PORTB_INITIAL_VALUE     DIO_PORT_BITS(                             \
+        DIO_PIN_LOW,            /* PIN0 --> LCD D4 / 7-seg BCD A */            \
+        DIO_PIN_LOW,            /* PIN1 --> LCD D5 / 7-seg BCD B */            \
+        DIO_PIN_LOW,            /* PIN2 --> LCD D6 / 7-seg BCD C */            \
+        DIO_PIN_LOW,            /* PIN3 --> LCD RW */                          \
+        DIO_PIN_LOW,            /* PIN4 --> LCD D7 / 7-seg BCD D */            \
+        DIO_PIN_HIGH,           /* PIN5 --> 7-seg COM 3 */                     \
+        DIO_PIN_HIGH,           /* PIN6 --> 7-seg COM 4 */                     \
+        DIO_PIN_LOW             /* PIN7 --> Red LED */                         \
+        )
+
+#define DIO_PORTB_PULL_UP           DIO_PORT_BITS(                             \
+        DIO_PULL_UP_DISABLED,   /* PIN0 --> LCD D4 / 7-seg BCD A */            \
+        DIO_PULL_UP_DISABLED,   /* PIN1 --> LCD D5 / 7-seg BCD B */            \
+        DIO_PULL_UP_DISABLED,   /* PIN2 --> LCD D6 / 7-seg BCD C */            \
+        DIO_PULL_UP_DISABLED,   /* PIN3 --> LCD RW */                          \
+        DIO_PULL_UP_DISABLED,   /* PIN4 --> LCD D7 / 7-seg BCD D */            \
+        DIO_PULL_UP_DISABLED,   /* PIN5 --> 7-seg COM 3 */                     \
+        DIO_PULL_UP_DISABLED,   /* PIN6 --> 7-seg COM 4 */                     \
+        DIO_PULL_UP_DISABLED    /* PIN7 --> Red LED */                         \
+        )
+
+/* PORTC */
+#define DIO_PORTC_DIRECTION         DIO_PORT_BITS(                             \
+        DIO_PIN_INPUT,          /* PIN0 */                                     \
+        DIO_PIN_INPUT,          /* PIN1 */                                     \
+        DIO_PIN_INPUT,          /* PIN2 --> Keypad Row 3 */                    \
+        DIO_PIN_INPUT,          /* PIN3 --> Keypad Row 2 */                    \
+        DIO_PIN_INPUT,          /* PIN4 --> Keypad Row 1 */                    \
+        DIO_PIN_INPUT,          /* PIN5 --> Keypad Row 0 */                    \
+        DIO_PIN_INPUT,          /* PIN6 --> I2C SDA */                         \
+        DIO_PIN_INPUT           /* PIN7 --> I2C SCL */                         \
+        )
+
+#define DIO_PORTC_INITIAL_VALUE     DIO_PORT_BITS(                             \
+        DIO_PIN_LOW,            /* PIN0 */                                     \
+        DIO_PIN_LOW,            /* PIN1 */                                     \
+        DIO_PIN_LOW,            /* PIN2 --> Keypad Row 3 */                    \
+        DIO_PIN_LOW,            /* PIN3 --> Keypad Row 2 */                    \
+        DIO_PIN_LOW,            /* PIN4 --> Keypad Row 1 */                    \
+        DIO_PIN_LOW,            /* PIN5 --> Keypad Row 0 */                    \
+        DIO_PIN_LOW,            /* PIN6 --> I2C SDA */                         \
+        DIO_PIN_LOW             /* PIN7 --> I2C SCL */                         \
+        )
+
+#define DIO_PORTC_PULL_UP           DIO_PORT_BITS(                             \
+        DIO_PULL_UP_DISABLED,   /* PIN0 */                                     \
+        DIO_PULL_UP_DISABLED,   /* PIN1 */                                     \
+        DIO_PULL_UP_DISABLED,   /* PIN2 --> Keypad Row 3 */                    \
+        DIO_PULL_UP_DISABLED,   /* PIN3 --> Keypad Row 2 */                    \
+        DIO_PULL_UP_DISABLED,   /* PIN4 --> Keypad Row 1 */                    \
+        DIO_PULL_UP_DISABLED,   /* PIN5 --> Keypad Row 0 */                    \
+        DIO_PULL_UP_ENABLED,    /* PIN6 --> I2C SDA */                         \
+        DIO_PULL_UP_ENABLED     /* PIN7 --> I2C SCL */                         \
+        )
+
+/* PORTD */
+#define DIO_PORTD_DIRECTION         DIO_PORT_BITS(                             \
+        DIO_PIN_INPUT,          /* PIN0 */                                     \
+        DIO_PIN_OUTPUT,         /* PIN1 --> USART TXD */                       \
+        DIO_PIN_INPUT,          /* PIN2 --> INT0 button */                     \
+        DIO_PIN_INPUT,          /* PIN3 --> Keypad Column 3 */                 \
+        DIO_PIN_OUTPUT,         /* PIN4 --> HC595 ST_CP */                     \
+        DIO_PIN_INPUT,          /* PIN5 --> Keypad Column 2 */                 \
+        DIO_PIN_INPUT,          /* PIN6 --> Keypad Column 1 */                 \
+        DIO_PIN_INPUT           /* PIN7 --> Keypad Column 0 */                 \
+        )
+
+#define DIO_PORTD_INITIAL_VALUE     DIO_PORT_BITS(                             \
+        DIO_PIN_LOW,            /* PIN0 */                                     \
+        DIO_PIN_HIGH,           /* PIN1 --> USART TXD */                       \
+        DIO_PIN_LOW,            /* PIN2 --> INT0 button */                     \
+        DIO_PIN_LOW,            /* PIN3 --> Keypad Column 3 */                 \
+        DIO_PIN_LOW,            /* PIN4 --> HC595 ST_CP */                     \
+        DIO_PIN_LOW,            /* PIN5 --> Keypad Column 2 */                 \
+        DIO_PIN_LOW,            /* PIN6 --> Keypad Column 1 */                 \
+        DIO_PIN_LOW             /* PIN7 --> Keypad Column 0 */                 \
+        )
+
+#define DIO_PORTD_PULL_UP           DIO_PORT_BITS(                             \
+        DIO_PULL_UP_DISABLED,   /* PIN0 */                                     \
+        DIO_PULL_UP_DISABLED,   /* PIN1 --> USART TXD */                       \
+        DIO_PULL_UP_ENABLED,    /* PIN2 --> INT0 button */                     \
+        DIO_PULL_UP_ENABLED,    /* PIN3 --> Keypad Column 3 */                 \
+        DIO_PULL_UP_DISABLED,   /* PIN4 --> HC595 ST_CP */                     \
+        DIO_PULL_UP_ENABLED,    /* PIN5 --> Keypad Column 2 */                 \
+        DIO_PULL_UP_ENABLED,    /* PIN6 --> Keypad Column 1 */                 \
+        DIO_PULL_UP_ENABLED     /* PIN7 --> Keypad Column 0 */                 \
+        )
+
+#endif /* DIO_PIN_MAP */
+#endif /* DIO_CONFIG_H_ */
@@ -34,6 +34,10 @@
 /* Macro for Total Number of DIO Pins */
 #define DIO_TOTAL_PINS     32
 
+/* Virtual channels (outputs of an expansion driver, see DIO_setVirtualDriver) */
+#define DIO_VIRTUAL_PINS   32
+#define DIO_TOTAL_CHANNELS (DIO_TOTAL_PINS + DIO_VIRTUAL_PINS)
+
 /* Macros for Port Identification */
 #define DIO_PORTA          0
 #define DIO_PORTB          1
@@ -58,9 +62,57 @@ typedef enum
     Dio_PINC_0, Dio_PINC_1, Dio_PINC_2, Dio_PINC_3,
     Dio_PINC_4, Dio_PINC_5, Dio_PINC_6, Dio_PINC_7,
     Dio_PIND_0, Dio_PIND_1, Dio_PIND_2, Dio_PIND_3,
-    Dio_PIND_4, Dio_PIND_5, Dio_PIND_6, Dio_PIND_7
+    Dio_PIND_4, Dio_PIND_5, Dio_PIND_6, Dio_PIND_7,
+    Dio_VPIN_0,  Dio_VPIN_1,  Dio_VPIN_2,  Dio_VPIN_3,
+    Dio_VPIN_4,  Dio_VPIN_5,  Dio_VPIN_6,  Dio_VPIN_7,
+    Dio_VPIN_8,  Dio_VPIN_9,  Dio_VPIN_10, Dio_VPIN_11,
+    Dio_VPIN_12, Dio_VPIN_13, Dio_VPIN_14, Dio_VPIN_15,
+    Dio_VPIN_16, Dio_VPIN_17, Dio_VPIN_18, Dio_VPIN_19,
+    Dio_VPIN_20, Dio_VPIN_21, Dio_VPIN_22, Dio_VPIN_23,
+    Dio_VPIN_24, Dio_VPIN_25, Dio_VPIN_26, Dio_VPIN_27,
+    Dio_VPIN_28, Dio_VPIN_29, Dio_VPIN_30, Dio_VPIN_31
 } Dio_CHANNEL_NUM;
 
+/*
+ * Structure: Dio_VIRTUAL_DRIVER
+ * Description:
+ *     Output expansion behind the virtual channels Dio_VPIN_0..31. The channel APIs pass
+ *     channels from DIO_TOTAL_PINS upwards to the registered driver, with the virtual pin
+ *     number (0 = Dio_VPIN_0). Virtual pins are outputs: direction and pull-up requests
+ *     are ignored, and buses accept physical channels only.
+ */
+typedef struct
+{
+	void (*SetValue)(u8 VirtualPin, u8 Value);
+	void (*GetValue)(u8 VirtualPin, u8* Value);
+	void (*ToggleValue)(u8 VirtualPin);
+} Dio_VIRTUAL_DRIVER;
+
+/* Maximum number of channels in a DIO bus (bus values are 8 bits wide) */
+#define DIO_BUS_MAX_WIDTH  8
+
+/*
+ * Structure: Dio_BUS
+ * Description:
+ *     A group of channels, possibly scattered over several ports, written and read as
+ *     one N-bit value (element 0 of the channel list carries bit 0 of the value).
+ *     DIO_initBus compiles the channel list into "runs": bus bits that land in the same
+ *     port with the same bit offset share one mask/shift step. A write therefore costs
+ *     one shift per run plus one masked write per port involved, and a read one PINx
+ *     read per port involved.
+ *     Example: D4..D7 on PB0, PB1, PB2, PB4 compile to two runs (bits 0-2 shifted by 0,
+ *     bit 3 shifted by 1) and one PORTB write.
+ */
+typedef struct
+{
+	u8 Width;                           /* Number of channels in the bus */
+	u8 RunCount;                        /* Number of valid entries in the run tables */
+	u8 RunPort[DIO_BUS_MAX_WIDTH];      /* Port of each run */
+	u8 RunValueMask[DIO_BUS_MAX_WIDTH]; /* Bus value bits carried by each run */
+	s8 RunShift[DIO_BUS_MAX_WIDTH];     /* Pin position minus bus bit position for each run */
+	u8 PortMask[4];                     /* Pins used by the bus in each port (0 = port unused) */
+} Dio_BUS;
+
 /* Function Prototypes for Pin APIs */
 void DIO_setPinDirection(u8 PortId, u8 PinId, u8 PinDirection);
 void DIO_setPinValue(u8 PortId, u8 PinId, u8 PinValue);
@@ -75,14 +127,210 @@ void DIO_getPortValue(u8 PortId, u8* PortValue);
 void DIO_togglePortValue(u8 PortId);
 void DIO_activePortInPullUpResistance(u8 PortId);
 
+/* Function Prototypes for Masked Port APIs (interrupt-safe, single read-modify-write) */
+void DIO_writePortMasked(u8 PortId, u8 Mask, u8 Value);
+void DIO_setPortMask(u8 PortId, u8 Mask);
+void DIO_clearPortMask(u8 PortId, u8 Mask);
+void DIO_writePortDirectionMasked(u8 PortId, u8 Mask, u8 Direction);
+void DIO_activePortMaskInPullUpResistance(u8 PortId, u8 Mask);
+
 /* Function Prototypes for Channel APIs */
 void DIO_setChannelDirection(Dio_CHANNEL_NUM ChannelId, u8 ChannelDirection);
 void DIO_setChannelValue(Dio_CHANNEL_NUM ChannelId, u8 ChannelValue);
 void DIO_getChannelValue(Dio_CHANNEL_NUM ChannelId, u8* ChannelValue);
 void DIO_toggleChannelValue(Dio_CHANNEL_NUM ChannelId);
 void DIO_activeChannelInPullUpResistance(Dio_CHANNEL_NUM ChannelId);
+void DIO_setVirtualDriver(const Dio_VIRTUAL_DRIVER* Driver);
+
+/* Function Prototypes for Bus APIs */
+void DIO_initBus(Dio_BUS* Bus, const Dio_CHANNEL_NUM* Channels, u8 Width);
+void DIO_setBusDirection(const Dio_BUS* Bus, u8 BusDirection);
+void DIO_writeBusDirection(const Dio_BUS* Bus, u8 BusDirection);
+void DIO_writeBus(const Dio_BUS* Bus, u8 BusValue);
+void DIO_readBus(const Dio_BUS* Bus, u8* BusValue);
 
 /* Function Prototype for Pins Configuration API */
 void DIO_initPinsConfig(void);
 
+/* Function Prototype for Shadow Register API */
+void DIO_commit(void);
+
+/*
+ * Structure: Dio_TRACE_ENTRY
+ * Description:
+ *     One traced output write (DIO_TRACE_MODE). Mask holds the pins written by the call
+ *     (in DIO_SHADOW_DEFERRED mode: the pins changed by the DIO_commit), Value the PORTx
+ *     level of the whole port right after the write.
+ */
+typedef struct
+{
+	u16 Time;       /* TCNT1 at the write */
+	u8  Port;       /* DIO_PORTA .. DIO_PORTD */
+	u8  Mask;       /* Pins written */
+	u8  Value;      /* New PORTx value */
+} Dio_TRACE_ENTRY;
+
+/*
+ * Function Prototypes for the Output Write Trace
+ * Cost per traced write (ATmega32, -Os): about 40 cycles added to the API call, i.e. 5 us
+ * at 8 MHz, with interrupts disabled for about 30 of them. Test Set 5 of DIO_APP.c measures
+ * it: compare DIO_Au16BenchCycles with and without DIO_TRACE_ENABLED. Without the trace
+ * these functions report an empty buffer and the write paths are unchanged.
+ */
+u8 DIO_traceRead(Dio_TRACE_ENTRY* Entry);
+void DIO_traceDrain(void (*PutChar)(u8 Character));
+u16 DIO_traceGetLost(void);
+
+/*
+ * Compile-Time Specialized Pin Access
+ * -----------------------------------
+ * When the port, pin and value arguments are compile-time constants these macros
+ * access the port register directly, which the optimizer (-O1 and above) reduces
+ * to a single SBI/CBI instruction for writes and SBIC/SBIS (or IN + ANDI) for reads.
+ * With any non-constant argument, or a constant port, pin or value out of range, they
+ * fall back to the runtime DIO functions above, so they are always safe to use in place
+ * of the function calls.
+ *
+ * The direct path expands against the register macros of DIO_private.h, so the
+ * calling file must include it (as every DIO user in this repository already does).
+ * The write macros also follow DIO_config.h, which the calling file must include:
+ * with shadow registers (DIO_SHADOW_MODE) they always take the runtime path so the
+ * shadow stays coherent, and with the output trace (DIO_TRACE_MODE) so every write is
+ * recorded. DIO_TOGGLE_PIN_VALUE follows DIO_TOGGLE_MODE (in DIO_TOGGLE_ATOMIC mode it
+ * always takes the runtime path, which is ISR-safe).
+ *
+ * DIO_SET_PIN_DIRECTION is the same for DDRx (SBI/CBI), e.g. for open-drain lines
+ * that switch between output-low and input.
+ *
+ * Approximate cost per call on ATmega32 (cycles, -Os):
+ *   Constant path : 2 for set/clear (SBI/CBI), 1-3 for a read (SBIC/SBIS),
+ *                   2 for a toggle with DIO_TOGGLE_PIN_REGISTER (SBI PINx),
+ *                   3 for a toggle with DIO_TOGGLE_READ_MODIFY_WRITE (IN/EOR/OUT)
+ *   Runtime path  : call, range check, PORTx/DDRx taken from the register block of
+ *                   PortId (table-indexed, no switch), read-modify-write, return. Not
+ *                   measured on target yet: BENCH/BENCH_APP.c reports it (the
+ *                   DIO_setPinValue and DIO_SET_PIN_VALUE rows) when run on the atmega32
+ *                   or simavr; the host estimate only counts its register accesses.
+ */
+#define DIO_IS_CONSTANT(X)      __builtin_constant_p(X)
+
+/* Constant arguments the direct path accepts: an out-of-range port or pin, or a value
+ * other than the two levels/directions, takes the checked runtime path instead (which
+ * ignores it) rather than becoming SBI/CBI on an unrelated I/O register */
+#define DIO_IS_CONSTANT_PIN(PortId, PinId)                                              \
+	(DIO_IS_CONSTANT(PortId) && DIO_IS_CONSTANT(PinId) &&                               \
+	 ((unsigned)(PortId) <= DIO_PORTD) && ((unsigned)(PinId) <= DIO_PIN7))
+#define DIO_IS_CONSTANT_LEVEL(PinValue)                                                 \
+	(DIO_IS_CONSTANT(PinValue) && ((DIO_PIN_HIGH == (PinValue)) || (DIO_PIN_LOW == (PinValue))))
+#define DIO_IS_CONSTANT_DIRECTION(PinDirection)                                         \
+	(DIO_IS_CONSTANT(PinDirection) &&                                                   \
+	 ((DIO_PIN_OUTPUT == (PinDirection)) || (DIO_PIN_INPUT == (PinDirection))))
+
+#define DIO_SET_PIN_VALUE(PortId, PinId, PinValue)                                      \
+	do                                                                                  \
+	{                                                                                   \
+		if(DIO_IS_CONSTANT_PIN(PortId, PinId) && DIO_IS_CONSTANT_LEVEL(PinValue) &&    \
+		   (DIO_SHADOW_DISABLED == DIO_SHADOW_MODE) && (DIO_TRACE_DISABLED == DIO_TRACE_MODE)) \
+		{                                                                               \
+			if(DIO_PIN_HIGH == (PinValue))                                              \
+			{                                                                           \
+				SET_BIT(DIO_PORT_REG(PortId), (PinId));                                 \
+			}                                                                           \
+			else                                                                        \
+			{                                                                           \
+				CLR_BIT(DIO_PORT_REG(PortId), (PinId));                                 \
+			}                                                                           \
+		}                                                                               \
+		else                                                                            \
+		{                                                                               \
+			DIO_setPinValue((PortId), (PinId), (PinValue));                             \
+		}                                                                               \
+	} while(0)
+
+#define DIO_SET_PIN_DIRECTION(PortId, PinId, PinDirection)                              \
+	do                                                                                  \
+	{                                                                                   \
+		if(DIO_IS_CONSTANT_PIN(PortId, PinId) && DIO_IS_CONSTANT_DIRECTION(PinDirection) && \
+		   (DIO_SHADOW_DISABLED == DIO_SHADOW_MODE))                                    \
+		{                                                                               \
+			if(DIO_PIN_OUTPUT == (PinDirection))                                        \
+			{                                                                           \
+				SET_BIT(DIO_DDR_REG(PortId), (PinId));                                  \
+			}                                                                           \
+			else                                                                        \
+			{                                                                           \
+				CLR_BIT(DIO_DDR_REG(PortId), (PinId));                                  \
+			}                                                                           \
+		}                                                                               \
+		else                                                                            \
+		{                                                                               \
+			DIO_setPinDirection((PortId), (PinId), (PinDirection));                     \
+		}                                                                               \
+	} while(0)
+
+#define DIO_GET_PIN_VALUE(PortId, PinId)                                                \
+	(DIO_IS_CONSTANT_PIN(PortId, PinId)                                                 \
+		? (u8)GET_BIT(DIO_PIN_REG(PortId), (PinId))                                     \
+		: ({ u8 Local_u8PinValue = DIO_PIN_LOW;                                         \
+		     DIO_getPinValue((PortId), (PinId), &Local_u8PinValue);                     \
+		     Local_u8PinValue; }))
+
+#define DIO_TOGGLE_PIN_VALUE(PortId, PinId)                                             \
+	do                                                                                  \
+	{                                                                                   \
+		if(DIO_IS_CONSTANT_PIN(PortId, PinId) &&                                        \
+		   (DIO_SHADOW_DISABLED == DIO_SHADOW_MODE) &&                                  \
+		   (DIO_TRACE_DISABLED == DIO_TRACE_MODE) &&                                    \
+		   (DIO_TOGGLE_PIN_REGISTER == DIO_TOGGLE_MODE))                                \
+		{                                                                               \
+			SET_BIT(DIO_PIN_REG(PortId), (PinId));                                      \
+		}                                                                               \
+		else if(DIO_IS_CONSTANT_PIN(PortId, PinId) &&                                   \
+		        (DIO_SHADOW_DISABLED == DIO_SHADOW_MODE) &&                             \
+		        (DIO_TRACE_DISABLED == DIO_TRACE_MODE) &&                               \
+		        (DIO_TOGGLE_READ_MODIFY_WRITE == DIO_TOGGLE_MODE))                      \
+		{                                                                               \
+			TOG_BIT(DIO_PORT_REG(PortId), (PinId));                                     \
+		}                                                                               \
+		else                                                                            \
+		{                                                                               \
+			DIO_togglePinValue((PortId), (PinId));                                      \
+		}                                                                               \
+	} while(0)
+
+/* Channel forms: a constant channel splits into a constant port and pin; virtual
+ * channels always take the runtime path */
+#define DIO_SET_CHANNEL_VALUE(ChannelId, ChannelValue)                                  \
+	do                                                                                  \
+	{                                                                                   \
+		if((ChannelId) >= DIO_TOTAL_PINS)                                               \
+		{                                                                               \
+			DIO_setChannelValue((ChannelId), (ChannelValue));                           \
+		}                                                                               \
+		else                                                                            \
+		{                                                                               \
+			DIO_SET_PIN_VALUE(((ChannelId) / 8), ((ChannelId) % 8), (ChannelValue));    \
+		}                                                                               \
+	} while(0)
+
+#define DIO_GET_CHANNEL_VALUE(ChannelId)                                                \
+	(((ChannelId) >= DIO_TOTAL_PINS)                                                    \
+		? ({ u8 Local_u8ChannelValue = DIO_PIN_LOW;                                     \
+		     DIO_getChannelValue((ChannelId), &Local_u8ChannelValue);                   \
+		     Local_u8ChannelValue; })                                                   \
+		: DIO_GET_PIN_VALUE(((ChannelId) / 8), ((ChannelId) % 8)))
+
+#define DIO_TOGGLE_CHANNEL_VALUE(ChannelId)                                             \
+	do                                                                                  \
+	{                                                                                   \
+		if((ChannelId) >= DIO_TOTAL_PINS)                                               \
+		{                                                                               \
+			DIO_toggleChannelValue(ChannelId);                                          \
+		}                                                                               \
+		else                                                                            \
+		{                                                                               \
+			DIO_TOGGLE_PIN_VALUE(((ChannelId) / 8), ((ChannelId) % 8));                 \
+		}                                                                               \
+	} while(0)
+
 #endif /* DIO_INTERFACE_H_ */
@@ -24,16 +24,16 @@
  */
 
 /* Data Direction Register for Port A */
-#define DDRA           (*(volatile u8*)0x3A)
+#define DDRA           HW_REG8(0x3A)
 
 /* Data Direction Register for Port B */
-#define DDRB           (*(volatile u8*)0x37)
+#define DDRB           HW_REG8(0x37)
 
 /* Data Direction Register for Port C */
-#define DDRC           (*(volatile u8*)0x34)
+#define DDRC           HW_REG8(0x34)
 
 /* Data Direction Register for Port D */
-#define DDRD           (*(volatile u8*)0x31)
+#define DDRD           HW_REG8(0x31)
 
 /*
  * Output Data Registers (PORTx):
@@ -42,16 +42,16 @@
  */
 
 /* Output Data Register for Port A */
-#define PORTA          (*(volatile u8*)0x3B)
+#define PORTA          HW_REG8(0x3B)
 
 /* Output Data Register for Port B */
-#define PORTB          (*(volatile u8*)0x38)
+#define PORTB          HW_REG8(0x38)
 
 /* Output Data Register for Port C */
-#define PORTC          (*(volatile u8*)0x35)
+#define PORTC          HW_REG8(0x35)
 
 /* Output Data Register for Port D */
-#define PORTD          (*(volatile u8*)0x32)
+#define PORTD          HW_REG8(0x32)
 
 /*
  * Input Data Registers (PINx):
@@ -60,15 +60,102 @@
  */
 
 /* Input Data Register for Port A */
-#define PINA           (*(volatile u8*)0x39)
+#define PINA           HW_REG8(0x39)
 
 /* Input Data Register for Port B */
-#define PINB           (*(volatile u8*)0x36)
+#define PINB           HW_REG8(0x36)
 
 /* Input Data Register for Port C */
-#define PINC           (*(volatile u8*)0x33)
+#define PINC           HW_REG8(0x33)
 
 /* Input Data Register for Port D */
-#define PIND           (*(volatile u8*)0x30)
+#define PIND           HW_REG8(0x30)
+
+/*
+ * Port Register Block Layout:
+ * Each port's PINx, DDRx and PORTx registers occupy three consecutive addresses,
+ * and the blocks descend by three bytes from PORTA (PINA = 0x39) to PORTD (PIND = 0x30).
+ * Overlaying Dio_PORT_REGISTERS on a block lets every DIO API reach a port register
+ * with index arithmetic instead of a switch on the port identifier, and a constant
+ * port identifier folds to a fixed I/O address (SBI/CBI/SBIC reachable).
+ */
+#define DIO_PINA_ADDRESS        0x39
+#define DIO_PORT_BLOCK_SIZE     3
+
+/* Register block of one port, in ascending address order */
+typedef struct
+{
+	u8 PIN;     /* Input Data Register */
+	u8 DDR;     /* Data Direction Register */
+	u8 PORT;    /* Output Data Register */
+} Dio_PORT_REGISTERS;
+
+/* Register block of the port identified by PortId (DIO_PORTA..DIO_PORTD) */
+#define DIO_PORT_REGISTERS(PortId)  ((volatile Dio_PORT_REGISTERS*)&HW_REG8(DIO_PINA_ADDRESS - (DIO_PORT_BLOCK_SIZE * (PortId))))
+
+/* Input Data Register of the port identified by PortId */
+#define DIO_PIN_REG(PortId)     (DIO_PORT_REGISTERS(PortId)->PIN)
+
+/* Data Direction Register of the port identified by PortId */
+#define DIO_DDR_REG(PortId)     (DIO_PORT_REGISTERS(PortId)->DDR)
+
+/* Output Data Register of the port identified by PortId */
+#define DIO_PORT_REG(PortId)    (DIO_PORT_REGISTERS(PortId)->PORT)
+
+/* Toggle Modes (selected by DIO_TOGGLE_MODE in DIO_config.h) */
+#define DIO_TOGGLE_READ_MODIFY_WRITE    0
+#define DIO_TOGGLE_ATOMIC               1
+#define DIO_TOGGLE_PIN_REGISTER         2
+
+/* Shadow Register Modes (selected by DIO_SHADOW_MODE in DIO_config.h) */
+#define DIO_SHADOW_DISABLED             0
+#define DIO_SHADOW_IMMEDIATE            1
+#define DIO_SHADOW_DEFERRED             2
+
+/* Pin Map Sources (selected by DIO_PIN_MAP in DIO_config.h) */
+#define DIO_PIN_MAP_CONFIG              0
+#define DIO_PIN_MAP_GENERATED           1
+
+/*
+ * Pin identifier for preprocessor checks against the pin map (PINMAP_<DRIVER>_<SIGNAL>_ID):
+ * never 0, so a signal missing from the map never matches a configured pin.
+ */
+#define DIO_PIN_ID(Port, Pin)           ((Port) * 8 + (Pin) + 1)
+
+/* Trace Modes (selected by DIO_TRACE_MODE in DIO_config.h) */
+#define DIO_TRACE_DISABLED              0
+#define DIO_TRACE_ENABLED               1
+
+/* Trace timestamp: Timer1 counter, run by the application at the resolution it needs */
+#define DIO_TRACE_TCNT1                 HW_REG16(0x4C)
+
+/* Shadow register selection */
+#define DIO_SHADOW_PORT                 0
+#define DIO_SHADOW_DDR                  1
+
+/*
+ * Shadow registers (defined by DIO_program.c when DIO_SHADOW_MODE is not
+ * DIO_SHADOW_DISABLED): RAM copies of PORTx and DDRx indexed by port. Drivers that
+ * write PORTx directly from an interrupt must update the shadow as well, or the next
+ * DIO write to that port will undo their change.
+ */
+extern u8 DIO_Au8PortShadow[4];
+extern u8 DIO_Au8DdrShadow[4];
+
+/* Pull-Up Selection (used by DIO_PORTx_PULL_UP in DIO_config.h) */
+#define DIO_PULL_UP_DISABLED            0
+#define DIO_PULL_UP_ENABLED             1
+
+/* Packs eight per-pin settings, listed from PIN0 to PIN7, into one port bit mask */
+#define DIO_PORT_BITS(P0, P1, P2, P3, P4, P5, P6, P7)                               \
+	((u8)(((P0) << 0) | ((P1) << 1) | ((P2) << 2) | ((P3) << 3) |                   \
+	      ((P4) << 4) | ((P5) << 5) | ((P6) << 6) | ((P7) << 7)))
+
+/*
+ * Initial PORTx image of a port: output pins take their initial level and input
+ * pins take their pull-up enable, since both live in the same register.
+ */
+#define DIO_PORT_INIT_VALUE(Direction, InitialValue, PullUp)                        \
+	((u8)(((Direction) & (InitialValue)) | ((u8)~(Direction) & (PullUp))))
 
 #endif /* DIO_PRIVATE_K_ */
@@ -13,6 +13,9 @@
  */
 
 
+/* AVR LIB */
+#include <util/atomic.h>
+
 /* UTILES_LIB */
 #include "../../UTIL_LIB/STD_TYPES.h"
 #include "../../UTIL_LIB/BIT_MATH.h"
@@ -20,57 +23,138 @@
 /* MCAL */
 #include "../DIO/DIO_interface.h"
 #include "../DIO/DIO_private.h"
+#include "../DIO/DIO_config.h"
+
+#if (DIO_TOGGLE_MODE == DIO_TOGGLE_PIN_REGISTER) && defined(__AVR_ATmega32__)
+#error "DIO_TOGGLE_PIN_REGISTER: the ATmega32 cannot toggle outputs through PINx, select DIO_TOGGLE_ATOMIC"
+#endif
+
+#if (DIO_SHADOW_MODE != DIO_SHADOW_DISABLED) && (DIO_SHADOW_MODE != DIO_SHADOW_IMMEDIATE) && (DIO_SHADOW_MODE != DIO_SHADOW_DEFERRED)
+#error "DIO_SHADOW_MODE: select DIO_SHADOW_DISABLED, DIO_SHADOW_IMMEDIATE or DIO_SHADOW_DEFERRED"
+#endif
+
+#if DIO_TRACE_MODE == DIO_TRACE_ENABLED
+#if (DIO_TRACE_BUFFER_SIZE & (DIO_TRACE_BUFFER_SIZE - 1)) || (DIO_TRACE_BUFFER_SIZE > 128)
+#error "DIO_TRACE_BUFFER_SIZE must be a power of two up to 128"
+#endif
+#ifdef HOST_BUILD
+/* The HOST cycle counter stands in for Timer1 */
+#include "../../HOST/HOST_interface.h"
+#endif
+#endif
+
+/* Private Function Prototypes */
+static void DIO_voidTogglePortBits(u8 PortId, u8 Mask);
+static void DIO_voidScatterBus(const Dio_BUS* Bus, u8 BusValue, u8* PortValues);
+#if DIO_SHADOW_MODE != DIO_SHADOW_DISABLED
+static void DIO_voidWriteShadow(u8 Register, u8 PortId, u8 Keep, u8 Set, u8 Toggle);
+#endif
+#if DIO_TRACE_MODE == DIO_TRACE_ENABLED
+static void DIO_voidTraceRecord(u8 PortId, u8 Mask);
+static void DIO_voidTracePutNumber(void (*PutChar)(u8 Character), u16 Number);
+#endif
 
-/* DIO Pins Configuration Array */
 /*
- * Description:
- *     This array defines the initial configuration for all microcontroller pins.
- *     The configuration determines whether each pin is set as an input or output.
- *     The 'const' keyword ensures that the configuration is fixed and cannot be
- *     changed during runtime. The DIO_initPinsConfig function uses this array to
- *     set the initial direction of each pin.
- */
-
-/* Example configuration for LED and Keypad usage */
-const u8 DIO_PinsConfigArray [DIO_TOTAL_PINS] =
-{
-		DIO_PIN_INPUT,     //PIN0	PORTA
-		DIO_PIN_INPUT,     //PIN1	PORTA
-		DIO_PIN_INPUT,     //PIN2	PORTA
-		DIO_PIN_INPUT,     //PIN3	PORTA
-		DIO_PIN_INPUT,    //PIN4	PORTA --> Green LED
-		DIO_PIN_INPUT,    //PIN5	PORTA --> Blue LED
-		DIO_PIN_INPUT,    //PIN6	PORTA --> Yellow LED
-		DIO_PIN_INPUT,     //PIN7	PORTA
-
-		DIO_PIN_INPUT,     //PIN0	PORTB
-		DIO_PIN_INPUT,     //PIN1	PORTB
-		DIO_PIN_INPUT,     //PIN2	PORTB
-		DIO_PIN_INPUT,     //PIN3	PORTB
-		DIO_PIN_INPUT,     //PIN4	PORTB
-		DIO_PIN_INPUT,     //PIN5	PORTB
-		DIO_PIN_INPUT,     //PIN6	PORTB
-		DIO_PIN_INPUT,    //PIN7	PORTB --> Red LED
-
-		DIO_PIN_INPUT,     //PIN0	PORTC
-		DIO_PIN_INPUT,     //PIN1	PORTC
-		DIO_PIN_OUTPUT,     //PIN2	PORTC --> Keypad Row 3
-		DIO_PIN_OUTPUT,     //PIN3	PORTC --> Keypad Row 2
-		DIO_PIN_OUTPUT,     //PIN4	PORTC --> Keypad Row 1
-		DIO_PIN_OUTPUT,     //PIN5	PORTC --> Keypad Row 0
-		DIO_PIN_INPUT,     //PIN6	PORTC
-		DIO_PIN_INPUT,     //PIN7	PORTC
-
-		DIO_PIN_INPUT,     //PIN0	PORTD
-		DIO_PIN_INPUT,     //PIN1	PORTD
-		DIO_PIN_INPUT,     //PIN2	PORTD
-		DIO_PIN_INPUT,     //PIN3	PORTD --> Keypad Column 3
-		DIO_PIN_INPUT,     //PIN4	PORTD
-		DIO_PIN_INPUT,     //PIN5	PORTD --> Keypad Column 2
-		DIO_PIN_INPUT,     //PIN6	PORTD --> Keypad Column 1
-		DIO_PIN_INPUT      //PIN7	PORTD --> Keypad Column 0
-
-};
+ * Trace Layer
+ * -----------
+ * DIO_TRACE_PORT records a PORTx write right after it happened, in the same section with
+ * interrupts disabled as the write, so no other write can land between the two and the
+ * entries follow the order of the writes. DIO_TRACE_WRITE wraps a plain register write in
+ * that section. Both expand to the bare write when DIO_TRACE_MODE is disabled, so the
+ * write paths compile exactly as without the trace.
+ *
+ * The ring buffer has any number of writers (main code and interrupts) and one reader.
+ * A writer reserves and fills its entry with interrupts disabled and only then advances
+ * DIO_u8TraceHead; the reader copies the entries before DIO_u8TraceHead and then advances
+ * DIO_u8TraceTail, which writers only read. When the buffer is full the new entry is
+ * dropped, so the reader never sees an entry overwritten under it.
+ */
+#if DIO_TRACE_MODE == DIO_TRACE_ENABLED
+
+#define DIO_TRACE_PORT(PortId, Mask)               DIO_voidTraceRecord((PortId), (Mask))
+#define DIO_TRACE_WRITE(PortId, Mask, Write)       do { ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { Write; DIO_TRACE_PORT((PortId), (Mask)); } } while(0)
+
+static Dio_TRACE_ENTRY DIO_AstrTrace[DIO_TRACE_BUFFER_SIZE];
+static volatile u8 DIO_u8TraceHead = 0;     // Free-running, entry index = Head % size
+static volatile u8 DIO_u8TraceTail = 0;
+static volatile u16 DIO_u16TraceLost = 0;
+
+#else
+
+#define DIO_TRACE_PORT(PortId, Mask)
+#define DIO_TRACE_WRITE(PortId, Mask, Write)       do { Write; } while(0)
+
+#endif
+
+/*
+ * Register Write Layer
+ * --------------------
+ * Every write of PORTx/DDRx in this file goes through these macros. Without shadow
+ * registers they access the registers as before. With shadow registers they update the
+ * RAM copy with interrupts disabled and write it out (DIO_SHADOW_IMMEDIATE) or mark it
+ * for DIO_commit (DIO_SHADOW_DEFERRED); the registers are never read back.
+ */
+#if DIO_SHADOW_MODE == DIO_SHADOW_DISABLED
+
+#define DIO_PORT_SET_BITS(PortId, Mask)            DIO_TRACE_WRITE((PortId), (Mask), DIO_PORT_REG(PortId) |= (Mask))
+#define DIO_PORT_CLEAR_BITS(PortId, Mask)          DIO_TRACE_WRITE((PortId), (Mask), DIO_PORT_REG(PortId) &= (u8)~(Mask))
+#define DIO_PORT_ASSIGN(PortId, Value)             DIO_TRACE_WRITE((PortId), 0xff, DIO_PORT_REG(PortId) = (Value))
+#define DIO_DDR_SET_BITS(PortId, Mask)             (DIO_DDR_REG(PortId) |= (Mask))
+#define DIO_DDR_CLEAR_BITS(PortId, Mask)           (DIO_DDR_REG(PortId) &= (u8)~(Mask))
+#define DIO_DDR_ASSIGN(PortId, Value)              (DIO_DDR_REG(PortId) = (Value))
+
+/* Interrupt-safe forms, used by the masked APIs */
+#define DIO_PORT_WRITE_MASKED(PortId, Mask, Value)                                           \
+	do                                                                                   \
+	{                                                                                    \
+		volatile Dio_PORT_REGISTERS* Local_pPort = DIO_PORT_REGISTERS(PortId);           \
+		u8 Local_u8Keep = ~(Mask);                                                       \
+		u8 Local_u8Set  = (Value) & (Mask);                                              \
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)                                                \
+		{                                                                                \
+			Local_pPort->PORT = (Local_pPort->PORT & Local_u8Keep) | Local_u8Set;        \
+			DIO_TRACE_PORT((PortId), (Mask));                                            \
+		}                                                                                \
+	} while(0)
+
+#define DIO_DDR_WRITE_MASKED(PortId, Mask, Value)                                            \
+	do                                                                                   \
+	{                                                                                    \
+		volatile Dio_PORT_REGISTERS* Local_pPort = DIO_PORT_REGISTERS(PortId);           \
+		u8 Local_u8Keep = ~(Mask);                                                       \
+		u8 Local_u8Set  = (Value) & (Mask);                                              \
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)                                                \
+		{                                                                                \
+			Local_pPort->DDR = (Local_pPort->DDR & Local_u8Keep) | Local_u8Set;          \
+		}                                                                                \
+	} while(0)
+
+#else
+
+#define DIO_PORT_SET_BITS(PortId, Mask)            DIO_voidWriteShadow(DIO_SHADOW_PORT, (PortId), 0xff, (Mask), 0)
+#define DIO_PORT_CLEAR_BITS(PortId, Mask)          DIO_voidWriteShadow(DIO_SHADOW_PORT, (PortId), (u8)~(Mask), 0, 0)
+#define DIO_PORT_ASSIGN(PortId, Value)             DIO_voidWriteShadow(DIO_SHADOW_PORT, (PortId), 0, (Value), 0)
+#define DIO_DDR_SET_BITS(PortId, Mask)             DIO_voidWriteShadow(DIO_SHADOW_DDR, (PortId), 0xff, (Mask), 0)
+#define DIO_DDR_CLEAR_BITS(PortId, Mask)           DIO_voidWriteShadow(DIO_SHADOW_DDR, (PortId), (u8)~(Mask), 0, 0)
+#define DIO_DDR_ASSIGN(PortId, Value)              DIO_voidWriteShadow(DIO_SHADOW_DDR, (PortId), 0, (Value), 0)
+
+/* The shadow writes are interrupt-safe already */
+#define DIO_PORT_WRITE_MASKED(PortId, Mask, Value) DIO_voidWriteShadow(DIO_SHADOW_PORT, (PortId), (u8)~(Mask), (Value) & (Mask), 0)
+#define DIO_DDR_WRITE_MASKED(PortId, Mask, Value)  DIO_voidWriteShadow(DIO_SHADOW_DDR, (PortId), (u8)~(Mask), (Value) & (Mask), 0)
+
+/* Shadow registers: RAM copies of PORTx and DDRx, indexed by port */
+u8 DIO_Au8PortShadow[4];
+u8 DIO_Au8DdrShadow[4];
+
+#if DIO_SHADOW_MODE == DIO_SHADOW_DEFERRED
+/* Registers waiting for DIO_commit: bits 0-3 PORTA..PORTD, bits 4-7 DDRA..DDRD */
+static u8 DIO_u8ShadowDirty;
+#endif
+
+#endif
+
+/* Driver of the virtual channels (NULL: virtual channels do nothing) */
+static const Dio_VIRTUAL_DRIVER* DIO_pstrVirtualDriver = NULL;
 
 /*
  * Function: DIO_setPinDirection
@@ -86,51 +170,13 @@ void DIO_setPinDirection(u8 PortId, u8 PinId, u8 PinDirection)
 {
 	if((PortId<=3)&&(PinId<=7)&&((DIO_PIN_OUTPUT==PinDirection)||(DIO_PIN_INPUT==PinDirection)))
 	{
-		switch(PortId)
+		if(DIO_PIN_OUTPUT == PinDirection)
 		{
-		case DIO_PORTA:
-			if(DIO_PIN_OUTPUT == PinDirection)
-			{
-				SET_BIT(DDRA,PinId);
-			}
-			else
-			{
-				CLR_BIT(DDRA,PinId);
-			}
-			break;
-
-		case DIO_PORTB:
-			if(DIO_PIN_OUTPUT == PinDirection)
-			{
-				SET_BIT(DDRB,PinId);
-			}
-			else
-			{
-				CLR_BIT(DDRB,PinId);
-			}
-			break;
-
-		case DIO_PORTC:
-			if(DIO_PIN_OUTPUT == PinDirection)
-			{
-				SET_BIT(DDRC,PinId);
-			}
-			else
-			{
-				CLR_BIT(DDRC,PinId);
-			}
-			break;
-
-		case DIO_PORTD:
-			if(DIO_PIN_OUTPUT == PinDirection)
-			{
-				SET_BIT(DDRD,PinId);
-			}
-			else
-			{
-				CLR_BIT(DDRD,PinId);
-			}
-			break;
+			DIO_DDR_SET_BITS(PortId, (1U << PinId));
+		}
+		else
+		{
+			DIO_DDR_CLEAR_BITS(PortId, (1U << PinId));
 		}
 	}
 
@@ -152,51 +198,16 @@ void DIO_setPinDirection(u8 PortId, u8 PinId, u8 PinDirection)
  */
 void DIO_setPinValue(u8 PortId, u8 PinId, u8 PinValue)
 {
-	switch(PortId)
+	if((PortId<=3)&&(PinId<=7)&&((DIO_PIN_HIGH==PinValue)||(DIO_PIN_LOW==PinValue)))
 	{
-	case DIO_PORTA:
-		if(DIO_PIN_HIGH == PinValue)
-		{
-			SET_BIT(PORTA,PinId);
-		}
-		else
-		{
-			CLR_BIT(PORTA,PinId);
-		}
-		break;
-
-	case DIO_PORTB:
-		if(DIO_PIN_HIGH == PinValue)
-		{
-			SET_BIT(PORTB,PinId);
-		}
-		else
-		{
-			CLR_BIT(PORTB,PinId);
-		}
-		break;
-
-	case DIO_PORTC:
-		if(DIO_PIN_HIGH == PinValue)
-		{
-			SET_BIT(PORTC,PinId);
-		}
-		else
-		{
-			CLR_BIT(PORTC,PinId);
-		}
-		break;
-
-	case DIO_PORTD:
 		if(DIO_PIN_HIGH == PinValue)
 		{
-			SET_BIT(PORTD,PinId);
+			DIO_PORT_SET_BITS(PortId, (1U << PinId));
 		}
 		else
 		{
-			CLR_BIT(PORTD,PinId);
+			DIO_PORT_CLEAR_BITS(PortId, (1U << PinId));
 		}
-		break;
 	}
 }
 
@@ -212,23 +223,9 @@ void DIO_setPinValue(u8 PortId, u8 PinId, u8 PinValue)
  */
 void DIO_getPinValue(u8 PortId, u8 PinId, u8* PinValue)
 {
-	switch(PortId)
+	if((PortId<=3)&&(PinId<=7)&&(PinValue != 0))
 	{
-	case DIO_PORTA:
-		*PinValue = GET_BIT(PINA,PinId);
-		break;
-
-	case DIO_PORTB:
-		*PinValue = GET_BIT(PINB,PinId);
-		break;
-
-	case DIO_PORTC:
-		*PinValue = GET_BIT(PINC,PinId);
-		break;
-
-	case DIO_PORTD:
-		*PinValue = GET_BIT(PIND,PinId);
-		break;
+		*PinValue = GET_BIT(DIO_PIN_REG(PortId),PinId);
 	}
 }
 
@@ -236,6 +233,8 @@ void DIO_getPinValue(u8 PortId, u8 PinId, u8* PinValue)
  * Function: DIO_togglePinValue
  * Description:
  *     Toggles the value of a specific pin if configured as output.
+ *     The implementation (read-modify-write, atomic or PINx write) is selected
+ *     by DIO_TOGGLE_MODE in DIO_config.h.
  * Parameters:
  *     - PortId: The identifier of the port group (e.g., DIO_PORTA).
  *     - PinId: The pin number within the group (e.g., DIO_PIN0).
@@ -243,23 +242,9 @@ void DIO_getPinValue(u8 PortId, u8 PinId, u8* PinValue)
  */
 void DIO_togglePinValue(u8 PortId, u8 PinId)
 {
-	switch(PortId)
+	if((PortId<=3)&&(PinId<=7))
 	{
-	case DIO_PORTA:
-		TOG_BIT(PORTA,PinId);
-		break;
-
-	case DIO_PORTB:
-		TOG_BIT(PORTB,PinId);
-		break;
-
-	case DIO_PORTC:
-		TOG_BIT(PORTC,PinId);
-		break;
-
-	case DIO_PORTD:
-		TOG_BIT(PORTD,PinId);
-		break;
+		DIO_voidTogglePortBits(PortId, (1U << PinId));
 	}
 }
 
@@ -274,23 +259,9 @@ void DIO_togglePinValue(u8 PortId, u8 PinId)
  */
 void DIO_activePinInPullUpResistance(u8 PortId, u8 PinId)
 {
-	switch(PortId)
+	if((PortId<=3)&&(PinId<=7))
 	{
-	case DIO_PORTA:
-		SET_BIT(PORTA,PinId);
-		break;
-
-	case DIO_PORTB:
-		SET_BIT(PORTB,PinId);
-		break;
-
-	case DIO_PORTC:
-		SET_BIT(PORTC,PinId);
-		break;
-
-	case DIO_PORTD:
-		SET_BIT(PORTD,PinId);
-		break;
+		DIO_PORT_SET_BITS(PortId, (1U << PinId));
 	}
 }
 
@@ -317,52 +288,7 @@ void DIO_setPortDirection(u8 PortId, u8 PortDirection)
 {
 	if((PortId<=3) && ((DIO_PORT_OUTPUT == PortDirection) || (DIO_PORT_INPUT == PortDirection)))
 	{
-		switch(PortId)
-		{
-		case 0:
-			if(DIO_PORT_OUTPUT == PortDirection)
-			{
-				DDRA = 0xff;
-			}
-			else
-			{
-				DDRA = 0x00;
-			}
-			break;
-
-		case 1:
-			if(DIO_PORT_OUTPUT == PortDirection)
-			{
-				DDRB = 0xff;
-			}
-			else
-			{
-				DDRB = 0x00;
-			}
-			break;
-
-		case 2:
-			if(DIO_PORT_OUTPUT == PortDirection)
-			{
-				DDRC = 0xff;
-			}
-			else
-			{
-				DDRC = 0x00;
-			}
-			break;
-
-		case 3:
-			if(DIO_PORT_OUTPUT == PortDirection)
-			{
-				DDRD = 0xff;
-			}
-			else
-			{
-				DDRD = 0x00;
-			}
-			break;
-		}
+		DIO_DDR_ASSIGN(PortId, PortDirection);
 	}
 }
 
@@ -385,24 +311,7 @@ void DIO_setPortValue(u8 PortId, u8 PortValue)
 {
 	if(PortId<=3)
 	{
-		switch(PortId)
-		{
-		case 0:
-			PORTA = PortValue;
-			break;
-
-		case 1:
-			PORTB = PortValue;
-			break;
-
-		case 2:
-			PORTC = PortValue;
-			break;
-
-		case 3:
-			PORTD = PortValue;
-			break;
-		}
+		DIO_PORT_ASSIGN(PortId, PortValue);
 	}
 }
 
@@ -426,24 +335,7 @@ void DIO_getPortValue(u8 PortId, u8* PortValue)
 {
 	if((PortId<=3) && (PortValue != 0))
 	{
-		switch(PortId)
-		{
-		case 0:
-			*PortValue = PINA;
-			break;
-
-		case 1:
-			*PortValue = PINB;
-			break;
-
-		case 2:
-			*PortValue = PINC;
-			break;
-
-		case 3:
-			*PortValue = PIND;
-			break;
-		}
+		*PortValue = DIO_PIN_REG(PortId);
 	}
 }
 
@@ -455,6 +347,7 @@ void DIO_getPortValue(u8 PortId, u8* PortValue)
  * Description:
  *   This function inverts the current state of all pins in a given port. If a pin is high, it becomes low, and vice versa.
  *   It can be used for blinking LEDs or toggling the state of output devices.
+ *   The implementation is selected by DIO_TOGGLE_MODE in DIO_config.h.
  *
  * Parameters:
  *   PortId - An unsigned 8-bit integer representing the port identifier.
@@ -466,24 +359,7 @@ void DIO_togglePortValue(u8 PortId)
 {
 	if(PortId<=3)
 	{
-		switch(PortId)
-		{
-		case 0:
-			PORTA = ~PORTA;
-			break;
-
-		case 1:
-			PORTB = ~PORTB;
-			break;
-
-		case 2:
-			PORTC = ~PORTC;
-			break;
-
-		case 3:
-			PORTD = ~PORTD;
-			break;
-		}
+		DIO_voidTogglePortBits(PortId, 0xff);
 	}
 }
 
@@ -506,27 +382,132 @@ void DIO_activePortInPullUpResistance(u8 PortId)
 {
 	if(PortId<=3)
 	{
-		switch(PortId)
-		{
-		case 0:
-			PORTA = 0xff;
-			break;
+		DIO_PORT_ASSIGN(PortId, 0xff);
+	}
+}
+
+/* Function: DIO_writePortMasked
+ *
+ * Brief:
+ *   Writes a value to a subset of the output pins of a specified port.
+ *
+ * Description:
+ *   Pins selected by Mask take the corresponding bits of Value, and all other pins of the
+ *   port keep their state. The update is a single read-modify-write of PORTx performed with
+ *   interrupts disabled, so the selected pins change together and an ISR touching other pins
+ *   of the same port cannot lose its update.
+ *
+ * Parameters:
+ *   PortId - An unsigned 8-bit integer representing the port identifier (0 to 3 for PORTA to PORTD).
+ *   Mask   - Bit mask of the pins to update (1 = update, 0 = leave unchanged).
+ *   Value  - New pin values; bits outside Mask are ignored.
+ *
+ * Returns:
+ *   void - This function returns nothing.
+ */
+void DIO_writePortMasked(u8 PortId, u8 Mask, u8 Value)
+{
+	if(PortId<=3)
+	{
+		DIO_PORT_WRITE_MASKED(PortId, Mask, Value);
+	}
+}
 
-		case 1:
-			PORTB = 0xff;
-			break;
+/* Function: DIO_setPortMask
+ *
+ * Brief:
+ *   Drives the pins selected by a mask HIGH in a specified port.
+ *
+ * Description:
+ *   Equivalent to DIO_writePortMasked(PortId, Mask, Mask), performed as one interrupt-safe
+ *   read-modify-write of PORTx.
+ *
+ * Parameters:
+ *   PortId - An unsigned 8-bit integer representing the port identifier.
+ *   Mask   - Bit mask of the pins to drive HIGH.
+ *
+ * Returns:
+ *   void - This function returns nothing.
+ */
+void DIO_setPortMask(u8 PortId, u8 Mask)
+{
+	if(PortId<=3)
+	{
+		DIO_PORT_WRITE_MASKED(PortId, Mask, Mask);
+	}
+}
 
-		case 2:
-			PORTC = 0xff;
-			break;
+/* Function: DIO_clearPortMask
+ *
+ * Brief:
+ *   Drives the pins selected by a mask LOW in a specified port.
+ *
+ * Description:
+ *   Equivalent to DIO_writePortMasked(PortId, Mask, 0), performed as one interrupt-safe
+ *   read-modify-write of PORTx.
+ *
+ * Parameters:
+ *   PortId - An unsigned 8-bit integer representing the port identifier.
+ *   Mask   - Bit mask of the pins to drive LOW.
+ *
+ * Returns:
+ *   void - This function returns nothing.
+ */
+void DIO_clearPortMask(u8 PortId, u8 Mask)
+{
+	if(PortId<=3)
+	{
+		DIO_PORT_WRITE_MASKED(PortId, Mask, 0);
+	}
+}
 
-		case 3:
-			PORTD = 0xff;
-			break;
-		}
+/* Function: DIO_writePortDirectionMasked
+ *
+ * Brief:
+ *   Sets the direction of a subset of the pins of a specified port.
+ *
+ * Description:
+ *   Pins selected by Mask take the direction given by the corresponding bits of Direction
+ *   (1 = output, 0 = input), and all other pins keep their direction. The update is a single
+ *   interrupt-safe read-modify-write of DDRx.
+ *
+ * Parameters:
+ *   PortId    - An unsigned 8-bit integer representing the port identifier.
+ *   Mask      - Bit mask of the pins to update.
+ *   Direction - Direction bits, e.g. DIO_PORT_OUTPUT or DIO_PORT_INPUT for all selected pins.
+ *
+ * Returns:
+ *   void - This function returns nothing.
+ */
+void DIO_writePortDirectionMasked(u8 PortId, u8 Mask, u8 Direction)
+{
+	if(PortId<=3)
+	{
+		DIO_DDR_WRITE_MASKED(PortId, Mask, Direction);
 	}
 }
 
+/* Function: DIO_activePortMaskInPullUpResistance
+ *
+ * Brief:
+ *   Activates the internal pull-up resistors of the pins selected by a mask.
+ *
+ * Description:
+ *   Enables the pull-up of every selected pin in one interrupt-safe read-modify-write of PORTx,
+ *   leaving the other pins of the port untouched. The selected pins should be inputs.
+ *
+ * Parameters:
+ *   PortId - An unsigned 8-bit integer representing the port identifier.
+ *   Mask   - Bit mask of the pins whose pull-up resistors are enabled.
+ *
+ * Returns:
+ *   void - This function returns nothing.
+ */
+void DIO_activePortMaskInPullUpResistance(u8 PortId, u8 Mask)
+{
+	DIO_setPortMask(PortId, Mask);
+}
+
 /* Function: DIO_setChannelDirection
  *
  * Brief:
@@ -537,7 +518,8 @@ void DIO_activePortInPullUpResistance(u8 PortId)
  *   It abstracts the concept of ports and pins, making it easier to work with individual pins.
  *
  * Parameters:
- *   ChannelId - A numeric identifier for the channel (ranging from 0 to 31, covering all pins of PORTA to PORTD).
+ *   ChannelId - A numeric identifier for the channel (ranging from 0 to 31, covering all pins of PORTA to PORTD;
+ *               virtual channels are ignored).
  *   ChannelDirection - An unsigned 8-bit integer representing the desired direction for the channel.
  *
  * Returns:
@@ -545,6 +527,11 @@ void DIO_activePortInPullUpResistance(u8 PortId)
  */
 void DIO_setChannelDirection(Dio_CHANNEL_NUM ChannelId, u8 ChannelDirection)
 {
+	if(ChannelId >= DIO_TOTAL_PINS)
+	{
+		return;     // Virtual channels are outputs
+	}
+
 	//channel 10 --> 10/8 = 1 --> group 1 or PORTB
 	u8 Local_u8PortId = ChannelId/8;
 	//10%8 = 2 --> pin 2 (group 1 or PORTB)
@@ -569,6 +556,15 @@ void DIO_setChannelDirection(Dio_CHANNEL_NUM ChannelId, u8 ChannelDirection)
  */
 void DIO_setChannelValue(Dio_CHANNEL_NUM ChannelId, u8 ChannelValue)
 {
+	if(ChannelId >= DIO_TOTAL_PINS)
+	{
+		if((ChannelId < DIO_TOTAL_CHANNELS) && (DIO_pstrVirtualDriver != NULL))
+		{
+			DIO_pstrVirtualDriver->SetValue(ChannelId - DIO_TOTAL_PINS, ChannelValue);
+		}
+		return;
+	}
+
 	//channel 10 --> 10/8 = 1 --> group 1 or PORTB
 	u8 Local_u8PortId = ChannelId/8;
 	//10%8 = 2 --> pin 2 (group 1 or PORTB)
@@ -594,6 +590,15 @@ void DIO_setChannelValue(Dio_CHANNEL_NUM ChannelId, u8 ChannelValue)
  */
 void DIO_getChannelValue(Dio_CHANNEL_NUM ChannelId, u8* ChannelValue)
 {
+	if(ChannelId >= DIO_TOTAL_PINS)
+	{
+		if((ChannelId < DIO_TOTAL_CHANNELS) && (DIO_pstrVirtualDriver != NULL) && (ChannelValue != NULL))
+		{
+			DIO_pstrVirtualDriver->GetValue(ChannelId - DIO_TOTAL_PINS, ChannelValue);
+		}
+		return;
+	}
+
 	//channel 10 --> 10/8 = 1 --> group 1 or PORTB
 	u8 Local_u8PortId = ChannelId/8;
 	//10%8 = 2 --> pin 2 (group 1 or PORTB)
@@ -618,6 +623,15 @@ void DIO_getChannelValue(Dio_CHANNEL_NUM ChannelId, u8* ChannelValue)
  */
 void DIO_toggleChannelValue(Dio_CHANNEL_NUM ChannelId)
 {
+	if(ChannelId >= DIO_TOTAL_PINS)
+	{
+		if((ChannelId < DIO_TOTAL_CHANNELS) && (DIO_pstrVirtualDriver != NULL))
+		{
+			DIO_pstrVirtualDriver->ToggleValue(ChannelId - DIO_TOTAL_PINS);
+		}
+		return;
+	}
+
 	//channel 10 --> 10/8 = 1 --> group 1 or PORTB
 	u8 Local_u8PortId = ChannelId/8;
 	//10%8 = 2 --> pin 2 (group 1 or PORTB)
@@ -642,6 +656,11 @@ void DIO_toggleChannelValue(Dio_CHANNEL_NUM ChannelId)
  */
 void DIO_activeChannelInPullUpResistance(Dio_CHANNEL_NUM ChannelId)
 {
+	if(ChannelId >= DIO_TOTAL_PINS)
+	{
+		return;     // Virtual channels are outputs
+	}
+
 	//channel 10 --> 10/8 = 1 --> group 1 or PORTB
 	u8 Local_u8PortId = ChannelId/8;
 	//10%8 = 2 --> pin 2 (group 1 or PORTB)
@@ -649,26 +668,680 @@ void DIO_activeChannelInPullUpResistance(Dio_CHANNEL_NUM ChannelId)
 	DIO_activePinInPullUpResistance(Local_u8PortId, Local_u8PinId);
 }
 
-/* Function: DIO_initPinsConfig
+/* Function: DIO_setVirtualDriver
  *
  * Brief:
- *   Initializes all DIO pins according to a predefined configuration.
+ *   Registers the driver of the virtual channels.
  *
  * Description:
- *   Configures the direction of all DIO pins based on a predefined array.
- *   This function should be called at the beginning of the program to set up the pin directions.
+ *   Channels Dio_VPIN_0 to Dio_VPIN_31 have no pin of their own; the channel value APIs pass
+ *   them to this driver (an output expansion such as HC595). The pointer is stored with
+ *   interrupts disabled, so a channel write from an ISR never uses a half-written pointer.
  *
  * Parameters:
- *   void - This function does not take any parameters.
+ *   Driver - Pointer to the driver's function table, or NULL to detach it.
  *
  * Returns:
- *   void - This function does not return a value.
+ *   void - This function returns nothing.
  */
-void DIO_initPinsConfig(void)
+void DIO_setVirtualDriver(const Dio_VIRTUAL_DRIVER* Driver)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		DIO_pstrVirtualDriver = Driver;
+	}
+}
+
+/* Function: DIO_initBus
+ *
+ * Brief:
+ *   Builds a bus descriptor from an ordered list of channels.
+ *
+ * Description:
+ *   Channels[0] carries bit 0 of the bus value, Channels[1] bit 1, and so on. For each bit the
+ *   port and the offset between pin position and bit position are computed; bits sharing both
+ *   are merged into one run, so the per-write work is proportional to the number of distinct
+ *   (port, offset) pairs rather than to the number of channels. This is done once, typically
+ *   in a driver's init function, and the descriptor is then used by the other bus APIs.
+ *
+ * Parameters:
+ *   Bus      - Pointer to the descriptor to build.
+ *   Channels - Pointer to the ordered channel list (physical channels only).
+ *   Width    - Number of channels in the list (1 to DIO_BUS_MAX_WIDTH).
+ *
+ * Returns:
+ *   void - This function returns nothing. On invalid arguments the bus is left empty
+ *          (Width = 0), which makes the other bus APIs do nothing.
+ */
+void DIO_initBus(Dio_BUS* Bus, const Dio_CHANNEL_NUM* Channels, u8 Width)
 {
-	u8 Local_PinCounter;
-	for(Local_PinCounter = 0; Local_PinCounter < DIO_TOTAL_PINS; Local_PinCounter++)
+	u8 Local_u8Bit;
+	u8 Local_u8Run;
+
+	if(Bus == NULL)
+	{
+		return;
+	}
+
+	Bus->Width = 0;
+	Bus->RunCount = 0;
+	for(Local_u8Run = 0; Local_u8Run < 4; Local_u8Run++)
+	{
+		Bus->PortMask[Local_u8Run] = 0;
+	}
+
+	if((Channels == NULL) || (Width == 0) || (Width > DIO_BUS_MAX_WIDTH))
+	{
+		return;
+	}
+
+	for(Local_u8Bit = 0; Local_u8Bit < Width; Local_u8Bit++)
+	{
+		u8 Local_u8PortId;
+		u8 Local_u8PinId;
+		s8 Local_s8Shift;
+
+		if(Channels[Local_u8Bit] >= DIO_TOTAL_PINS)
+		{
+			Bus->RunCount = 0;
+			for(Local_u8Run = 0; Local_u8Run < 4; Local_u8Run++)
+			{
+				Bus->PortMask[Local_u8Run] = 0;
+			}
+			return;
+		}
+
+		Local_u8PortId = Channels[Local_u8Bit]/8;
+		Local_u8PinId = Channels[Local_u8Bit]%8;
+		Local_s8Shift = (s8)Local_u8PinId - (s8)Local_u8Bit;
+
+		// Look for a run with the same port and the same pin/bit offset
+		for(Local_u8Run = 0; Local_u8Run < Bus->RunCount; Local_u8Run++)
+		{
+			if((Bus->RunPort[Local_u8Run] == Local_u8PortId) && (Bus->RunShift[Local_u8Run] == Local_s8Shift))
+			{
+				break;
+			}
+		}
+
+		if(Local_u8Run == Bus->RunCount)
+		{
+			Bus->RunPort[Local_u8Run] = Local_u8PortId;
+			Bus->RunShift[Local_u8Run] = Local_s8Shift;
+			Bus->RunValueMask[Local_u8Run] = 0;
+			Bus->RunCount++;
+		}
+
+		SET_BIT(Bus->RunValueMask[Local_u8Run], Local_u8Bit);
+		SET_BIT(Bus->PortMask[Local_u8PortId], Local_u8PinId);
+	}
+
+	Bus->Width = Width;
+}
+
+/* Function: DIO_setBusDirection
+ *
+ * Brief:
+ *   Sets the direction of every channel of a bus.
+ *
+ * Description:
+ *   Updates the direction of the bus pins with one masked DDRx write per port involved,
+ *   leaving all other pins untouched.
+ *
+ * Parameters:
+ *   Bus          - Pointer to a descriptor built by DIO_initBus.
+ *   BusDirection - DIO_PIN_OUTPUT or DIO_PIN_INPUT.
+ *
+ * Returns:
+ *   void - This function returns nothing.
+ */
+void DIO_setBusDirection(const Dio_BUS* Bus, u8 BusDirection)
+{
+	u8 Local_u8PortId;
+
+	if((Bus != NULL) && ((DIO_PIN_OUTPUT == BusDirection) || (DIO_PIN_INPUT == BusDirection)))
+	{
+		for(Local_u8PortId = 0; Local_u8PortId < 4; Local_u8PortId++)
+		{
+			if(Bus->PortMask[Local_u8PortId] != 0)
+			{
+				DIO_writePortDirectionMasked(Local_u8PortId, Bus->PortMask[Local_u8PortId],
+				                             (DIO_PIN_OUTPUT == BusDirection) ? DIO_PORT_OUTPUT : DIO_PORT_INPUT);
+			}
+		}
+	}
+}
+
+/* Function: DIO_writeBusDirection
+ *
+ * Brief:
+ *   Sets the direction of each channel of a bus individually.
+ *
+ * Description:
+ *   Scatters the direction bits like DIO_writeBus scatters a value, then updates each port
+ *   involved with one masked DDRx write. Used to switch single lines of a bus between
+ *   output and input, e.g. to drive them open-drain.
+ *
+ * Parameters:
+ *   Bus          - Pointer to a descriptor built by DIO_initBus.
+ *   BusDirection - Bit i set makes the i-th channel an output, cleared an input.
+ *
+ * Returns:
+ *   void - This function returns nothing.
+ */
+void DIO_writeBusDirection(const Dio_BUS* Bus, u8 BusDirection)
+{
+	u8 Local_Au8PortDirection[4];
+	u8 Local_u8PortId;
+
+	if(Bus == NULL)
+	{
+		return;
+	}
+
+	DIO_voidScatterBus(Bus, BusDirection, Local_Au8PortDirection);
+
+	for(Local_u8PortId = 0; Local_u8PortId < 4; Local_u8PortId++)
+	{
+		if(Bus->PortMask[Local_u8PortId] != 0)
+		{
+			DIO_writePortDirectionMasked(Local_u8PortId, Bus->PortMask[Local_u8PortId], Local_Au8PortDirection[Local_u8PortId]);
+		}
+	}
+}
+
+/* Function: DIO_writeBus
+ *
+ * Brief:
+ *   Writes an N-bit value to the channels of a bus.
+ *
+ * Description:
+ *   Scatters the value into per-port images using the precomputed runs, then updates each
+ *   port involved with one interrupt-safe masked write, so all bus pins of a port change
+ *   together.
+ *
+ * Parameters:
+ *   Bus      - Pointer to a descriptor built by DIO_initBus.
+ *   BusValue - Value to write; bit i drives the i-th channel of the bus.
+ *
+ * Returns:
+ *   void - This function returns nothing.
+ */
+void DIO_writeBus(const Dio_BUS* Bus, u8 BusValue)
+{
+	u8 Local_Au8PortValue[4];
+	u8 Local_u8PortId;
+
+	if(Bus == NULL)
+	{
+		return;
+	}
+
+	DIO_voidScatterBus(Bus, BusValue, Local_Au8PortValue);
+
+	for(Local_u8PortId = 0; Local_u8PortId < 4; Local_u8PortId++)
+	{
+		if(Bus->PortMask[Local_u8PortId] != 0)
+		{
+			DIO_writePortMasked(Local_u8PortId, Bus->PortMask[Local_u8PortId], Local_Au8PortValue[Local_u8PortId]);
+		}
+	}
+}
+
+/* Function: DIO_readBus
+ *
+ * Brief:
+ *   Reads an N-bit value from the channels of a bus.
+ *
+ * Description:
+ *   Reads PINx once per port involved and gathers the bus bits back into their value positions
+ *   using the precomputed runs.
+ *
+ * Parameters:
+ *   Bus      - Pointer to a descriptor built by DIO_initBus.
+ *   BusValue - Pointer to store the value; bit i holds the level of the i-th channel.
+ *
+ * Returns:
+ *   void - This function returns nothing.
+ */
+void DIO_readBus(const Dio_BUS* Bus, u8* BusValue)
+{
+	u8 Local_Au8PortValue[4] = {0, 0, 0, 0};
+	u8 Local_u8Value = 0;
+	u8 Local_u8Run;
+	u8 Local_u8PortId;
+
+	if((Bus == NULL) || (BusValue == NULL))
+	{
+		return;
+	}
+
+	for(Local_u8PortId = 0; Local_u8PortId < 4; Local_u8PortId++)
+	{
+		if(Bus->PortMask[Local_u8PortId] != 0)
+		{
+			Local_Au8PortValue[Local_u8PortId] = DIO_PIN_REG(Local_u8PortId);
+		}
+	}
+
+	for(Local_u8Run = 0; Local_u8Run < Bus->RunCount; Local_u8Run++)
+	{
+		u8 Local_u8Pins = Local_Au8PortValue[Bus->RunPort[Local_u8Run]];
+		s8 Local_s8Shift = Bus->RunShift[Local_u8Run];
+
+		if(Local_s8Shift >= 0)
+		{
+			Local_u8Value |= (u8)(Local_u8Pins >> Local_s8Shift) & Bus->RunValueMask[Local_u8Run];
+		}
+		else
+		{
+			Local_u8Value |= (u8)(Local_u8Pins << (-Local_s8Shift)) & Bus->RunValueMask[Local_u8Run];
+		}
+	}
+
+	*BusValue = Local_u8Value;
+}
+
+/* Function: DIO_initPinsConfig
+ *
+ * Brief:
+ *   Initializes all DIO pins according to a predefined configuration.
+ *
+ * Description:
+ *   Applies the direction, initial output level and pull-up masks of DIO_config.h, which are
+ *   folded into constants at compile time, so initialization is eight register writes.
+ *   PORTx is written before DDRx: after reset every pin is an input, so outputs that start HIGH
+ *   pass through the pull-up state (never driving LOW), and outputs that start LOW go straight
+ *   from tri-state to LOW. No output glitches at boot.
+ *   This function should be called at the beginning of the program to set up the pins.
+ *
+ * Parameters:
+ *   void - This function does not take any parameters.
+ *
+ * Returns:
+ *   void - This function does not return a value.
+ */
+void DIO_initPinsConfig(void)
+{
+	/* Output levels and pull-ups first, while the pins are still inputs */
+	PORTA = DIO_PORT_INIT_VALUE(DIO_PORTA_DIRECTION, DIO_PORTA_INITIAL_VALUE, DIO_PORTA_PULL_UP);
+	PORTB = DIO_PORT_INIT_VALUE(DIO_PORTB_DIRECTION, DIO_PORTB_INITIAL_VALUE, DIO_PORTB_PULL_UP);
+	PORTC = DIO_PORT_INIT_VALUE(DIO_PORTC_DIRECTION, DIO_PORTC_INITIAL_VALUE, DIO_PORTC_PULL_UP);
+	PORTD = DIO_PORT_INIT_VALUE(DIO_PORTD_DIRECTION, DIO_PORTD_INITIAL_VALUE, DIO_PORTD_PULL_UP);
+
+	/* Then the directions, which enable the outputs at their initial levels */
+	DDRA = DIO_PORTA_DIRECTION;
+	DDRB = DIO_PORTB_DIRECTION;
+	DDRC = DIO_PORTC_DIRECTION;
+	DDRD = DIO_PORTD_DIRECTION;
+
+#if DIO_SHADOW_MODE != DIO_SHADOW_DISABLED
+	/* Shadows start from the configured values */
+	DIO_Au8PortShadow[DIO_PORTA] = DIO_PORT_INIT_VALUE(DIO_PORTA_DIRECTION, DIO_PORTA_INITIAL_VALUE, DIO_PORTA_PULL_UP);
+	DIO_Au8PortShadow[DIO_PORTB] = DIO_PORT_INIT_VALUE(DIO_PORTB_DIRECTION, DIO_PORTB_INITIAL_VALUE, DIO_PORTB_PULL_UP);
+	DIO_Au8PortShadow[DIO_PORTC] = DIO_PORT_INIT_VALUE(DIO_PORTC_DIRECTION, DIO_PORTC_INITIAL_VALUE, DIO_PORTC_PULL_UP);
+	DIO_Au8PortShadow[DIO_PORTD] = DIO_PORT_INIT_VALUE(DIO_PORTD_DIRECTION, DIO_PORTD_INITIAL_VALUE, DIO_PORTD_PULL_UP);
+	DIO_Au8DdrShadow[DIO_PORTA] = DIO_PORTA_DIRECTION;
+	DIO_Au8DdrShadow[DIO_PORTB] = DIO_PORTB_DIRECTION;
+	DIO_Au8DdrShadow[DIO_PORTC] = DIO_PORTC_DIRECTION;
+	DIO_Au8DdrShadow[DIO_PORTD] = DIO_PORTD_DIRECTION;
+#endif
+}
+
+/* Function: DIO_commit
+ *
+ * Brief:
+ *   Writes the pending shadow registers out to PORTx/DDRx.
+ *
+ * Description:
+ *   In DIO_SHADOW_DEFERRED mode, DIO writes only update the shadow registers; this function
+ *   writes every modified register once, PORTx before DDRx so pins turning into outputs
+ *   start at their new level. All updates made since the previous commit, by any driver,
+ *   therefore reach the pins together. In the other modes there is nothing pending and
+ *   the function returns at once.
+ *
+ * Parameters:
+ *   void - This function does not take any parameters.
+ *
+ * Returns:
+ *   void - This function returns nothing.
+ */
+void DIO_commit(void)
+{
+#if DIO_SHADOW_MODE == DIO_SHADOW_DEFERRED
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		u8 Local_u8Dirty = DIO_u8ShadowDirty;
+		u8 Local_u8PortId;
+
+		for(Local_u8PortId = 0; Local_u8PortId < 4; Local_u8PortId++)
+		{
+			if(GET_BIT(Local_u8Dirty, Local_u8PortId))
+			{
+#if DIO_TRACE_MODE == DIO_TRACE_ENABLED
+				/* Only the pins the commit actually changes are traced */
+				u8 Local_u8Changed = DIO_PORT_REG(Local_u8PortId) ^ DIO_Au8PortShadow[Local_u8PortId];
+
+				DIO_PORT_REG(Local_u8PortId) = DIO_Au8PortShadow[Local_u8PortId];
+				if(Local_u8Changed != 0)
+				{
+					DIO_TRACE_PORT(Local_u8PortId, Local_u8Changed);
+				}
+#else
+				DIO_PORT_REG(Local_u8PortId) = DIO_Au8PortShadow[Local_u8PortId];
+#endif
+			}
+		}
+		for(Local_u8PortId = 0; Local_u8PortId < 4; Local_u8PortId++)
+		{
+			if(GET_BIT(Local_u8Dirty, Local_u8PortId + 4))
+			{
+				DIO_DDR_REG(Local_u8PortId) = DIO_Au8DdrShadow[Local_u8PortId];
+			}
+		}
+		DIO_u8ShadowDirty = 0;
+	}
+#endif
+}
+
+/* Function: DIO_traceRead
+ *
+ * Brief:
+ *   Takes the oldest entry out of the output write trace.
+ *
+ * Description:
+ *   Copies the oldest entry and frees its place in the buffer. Runs without disabling
+ *   interrupts; it must only be called from one context (the single reader).
+ *
+ * Parameters:
+ *   Entry - Pointer receiving the entry.
+ *
+ * Returns:
+ *   u8 - 1 when an entry was copied, 0 when the trace is empty (or DIO_TRACE_DISABLED).
+ */
+u8 DIO_traceRead(Dio_TRACE_ENTRY* Entry)
+{
+#if DIO_TRACE_MODE == DIO_TRACE_ENABLED
+	u8 Local_u8Tail = DIO_u8TraceTail;
+
+	if((Entry == NULL) || (Local_u8Tail == DIO_u8TraceHead))
+	{
+		return 0;
+	}
+
+	*Entry = DIO_AstrTrace[Local_u8Tail & (DIO_TRACE_BUFFER_SIZE - 1)];
+	DIO_u8TraceTail = Local_u8Tail + 1;
+
+	return 1;
+#else
+	(void)Entry;
+	return 0;
+#endif
+}
+
+/* Function: DIO_traceDrain
+ *
+ * Brief:
+ *   Writes out and empties the output write trace as text.
+ *
+ * Description:
+ *   Prints one line "time,channel,value" per pin written by each entry (channel as
+ *   Dio_CHANNEL_NUM, value 0 or 1), then "lost,N" if entries were dropped since the last
+ *   drain. PutChar is e.g. BENCH_voidUartPutChar on the target or putchar on the HOST.
+ *   Same single-reader rule as DIO_traceRead.
+ *
+ * Parameters:
+ *   PutChar - Function sending one character.
+ *
+ * Returns:
+ *   void - This function returns nothing.
+ */
+void DIO_traceDrain(void (*PutChar)(u8 Character))
+{
+#if DIO_TRACE_MODE == DIO_TRACE_ENABLED
+	Dio_TRACE_ENTRY Local_strEntry;
+	u8 Local_u8PinId;
+	u16 Local_u16Lost;
+
+	if(PutChar == NULL)
+	{
+		return;
+	}
+
+	while(DIO_traceRead(&Local_strEntry))
+	{
+		for(Local_u8PinId = 0; Local_u8PinId < 8; Local_u8PinId++)
+		{
+			if(GET_BIT(Local_strEntry.Mask, Local_u8PinId))
+			{
+				DIO_voidTracePutNumber(PutChar, Local_strEntry.Time);
+				PutChar(',');
+				DIO_voidTracePutNumber(PutChar, (u16)(Local_strEntry.Port * 8 + Local_u8PinId));
+				PutChar(',');
+				PutChar('0' + GET_BIT(Local_strEntry.Value, Local_u8PinId));
+				PutChar('\n');
+			}
+		}
+	}
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		Local_u16Lost = DIO_u16TraceLost;
+		DIO_u16TraceLost = 0;
+	}
+
+	if(Local_u16Lost != 0)
+	{
+		PutChar('l'); PutChar('o'); PutChar('s'); PutChar('t'); PutChar(',');
+		DIO_voidTracePutNumber(PutChar, Local_u16Lost);
+		PutChar('\n');
+	}
+#else
+	(void)PutChar;
+#endif
+}
+
+/* Function: DIO_traceGetLost
+ *
+ * Brief:
+ *   Returns the number of trace entries dropped because the buffer was full.
+ *
+ * Parameters:
+ *   void - This function does not take any parameters.
+ *
+ * Returns:
+ *   u16 - Entries dropped since the last DIO_traceDrain (saturates at 65535).
+ */
+u16 DIO_traceGetLost(void)
+{
+#if DIO_TRACE_MODE == DIO_TRACE_ENABLED
+	u16 Local_u16Lost;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		Local_u16Lost = DIO_u16TraceLost;
+	}
+
+	return Local_u16Lost;
+#else
+	return 0;
+#endif
+}
+
+/*
+ * Function: DIO_voidTogglePortBits
+ * Description:
+ *     Inverts the output pins selected by Mask in the given port.
+ *       DIO_TOGGLE_PIN_REGISTER      : one write of Mask to PINx, toggled by hardware.
+ *       DIO_TOGGLE_ATOMIC            : PORTx ^= Mask with interrupts disabled.
+ *       DIO_TOGGLE_READ_MODIFY_WRITE : PORTx ^= Mask.
+ *     With shadow registers enabled the shadow copy is toggled instead, whatever DIO_TOGGLE_MODE.
+ * Parameters:
+ *     - PortId: The identifier of the port group, already validated (0 to 3).
+ *     - Mask: Bit mask of the pins to toggle.
+ * Returns: void
+ */
+static void DIO_voidTogglePortBits(u8 PortId, u8 Mask)
+{
+#if DIO_SHADOW_MODE != DIO_SHADOW_DISABLED
+	/* The shadow knows the output levels: toggle it, no register read needed */
+	DIO_voidWriteShadow(DIO_SHADOW_PORT, PortId, 0xff, 0, Mask);
+#else
+	volatile Dio_PORT_REGISTERS* Local_pPort = DIO_PORT_REGISTERS(PortId);
+
+#if DIO_TOGGLE_MODE == DIO_TOGGLE_PIN_REGISTER
+	DIO_TRACE_WRITE(PortId, Mask, Local_pPort->PIN = Mask);
+#elif DIO_TOGGLE_MODE == DIO_TOGGLE_ATOMIC
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		Local_pPort->PORT ^= Mask;
+		DIO_TRACE_PORT(PortId, Mask);
+	}
+#else
+	DIO_TRACE_WRITE(PortId, Mask, Local_pPort->PORT ^= Mask);
+#endif
+#endif
+}
+
+/*
+ * Function: DIO_voidScatterBus
+ * Description:
+ *     Places the bits of a bus value on their pin positions, one shift per run.
+ * Parameters:
+ *     - Bus: Descriptor built by DIO_initBus.
+ *     - BusValue: Bit i belongs to the i-th channel of the bus.
+ *     - PortValues: Array of 4 port images receiving the scattered bits.
+ * Returns: void
+ */
+static void DIO_voidScatterBus(const Dio_BUS* Bus, u8 BusValue, u8* PortValues)
+{
+	u8 Local_u8Run;
+
+	PortValues[DIO_PORTA] = 0;
+	PortValues[DIO_PORTB] = 0;
+	PortValues[DIO_PORTC] = 0;
+	PortValues[DIO_PORTD] = 0;
+
+	for(Local_u8Run = 0; Local_u8Run < Bus->RunCount; Local_u8Run++)
+	{
+		u8 Local_u8Bits = BusValue & Bus->RunValueMask[Local_u8Run];
+		s8 Local_s8Shift = Bus->RunShift[Local_u8Run];
+
+		if(Local_s8Shift >= 0)
+		{
+			PortValues[Bus->RunPort[Local_u8Run]] |= (u8)(Local_u8Bits << Local_s8Shift);
+		}
+		else
+		{
+			PortValues[Bus->RunPort[Local_u8Run]] |= (u8)(Local_u8Bits >> (-Local_s8Shift));
+		}
+	}
+}
+
+#if DIO_SHADOW_MODE != DIO_SHADOW_DISABLED
+/*
+ * Function: DIO_voidWriteShadow
+ * Description:
+ *     Updates one shadow register as ((Shadow & Keep) | Set) ^ Toggle with interrupts
+ *     disabled, then writes it to the hardware register (DIO_SHADOW_IMMEDIATE) or marks it
+ *     for DIO_commit (DIO_SHADOW_DEFERRED).
+ * Parameters:
+ *     - Register: DIO_SHADOW_PORT or DIO_SHADOW_DDR.
+ *     - PortId: The identifier of the port group, already validated (0 to 3).
+ *     - Keep: Bits of the shadow kept.
+ *     - Set: Bits set after masking.
+ *     - Toggle: Bits inverted last.
+ * Returns: void
+ */
+static void DIO_voidWriteShadow(u8 Register, u8 PortId, u8 Keep, u8 Set, u8 Toggle)
+{
+	u8* Local_pu8Shadow = (DIO_SHADOW_PORT == Register) ? &DIO_Au8PortShadow[PortId] : &DIO_Au8DdrShadow[PortId];
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		u8 Local_u8Value = ((*Local_pu8Shadow & Keep) | Set) ^ Toggle;
+
+		*Local_pu8Shadow = Local_u8Value;
+
+#if DIO_SHADOW_MODE == DIO_SHADOW_IMMEDIATE
+		if(DIO_SHADOW_PORT == Register)
+		{
+			DIO_PORT_REG(PortId) = Local_u8Value;
+			DIO_TRACE_PORT(PortId, (u8)(~Keep | Set | Toggle));
+		}
+		else
+		{
+			DIO_DDR_REG(PortId) = Local_u8Value;
+		}
+#else
+		DIO_u8ShadowDirty |= (DIO_SHADOW_PORT == Register) ? (1U << PortId) : (0x10U << PortId);
+#endif
+	}
+}
+#endif
+
+#if DIO_TRACE_MODE == DIO_TRACE_ENABLED
+/*
+ * Function: DIO_voidTraceRecord
+ * Description:
+ *     Appends one entry for a PORTx write that just happened: timestamp, port, pins
+ *     written and the resulting PORTx value. Constant cost, no loop. Called with
+ *     interrupts disabled, in the same section as the write it records (DIO_TRACE_PORT).
+ * Parameters:
+ *     - PortId: The identifier of the port group, already validated (0 to 3).
+ *     - Mask: Pins written by the call.
+ * Returns: void
+ */
+static void DIO_voidTraceRecord(u8 PortId, u8 Mask)
+{
+	u8 Local_u8Head = DIO_u8TraceHead;
+
+	if((u8)(Local_u8Head - DIO_u8TraceTail) >= DIO_TRACE_BUFFER_SIZE)
+	{
+		if(DIO_u16TraceLost != 0xffff)
+		{
+			DIO_u16TraceLost++;
+		}
+	}
+	else
+	{
+		Dio_TRACE_ENTRY* Local_pstrEntry = &DIO_AstrTrace[Local_u8Head & (DIO_TRACE_BUFFER_SIZE - 1)];
+
+#ifdef HOST_BUILD
+		Local_pstrEntry->Time = (u16)HOST_u32GetCycles();
+#else
+		Local_pstrEntry->Time = DIO_TRACE_TCNT1;
+#endif
+		Local_pstrEntry->Port = PortId;
+		Local_pstrEntry->Mask = Mask;
+		Local_pstrEntry->Value = DIO_PORT_REG(PortId);
+		DIO_u8TraceHead = Local_u8Head + 1;
+	}
+}
+
+/*
+ * Function: DIO_voidTracePutNumber
+ * Description:
+ *     Prints an unsigned number in decimal without leading zeros.
+ * Parameters:
+ *     - PutChar: Function sending one character.
+ *     - Number: Value to print.
+ * Returns: void
+ */
+static void DIO_voidTracePutNumber(void (*PutChar)(u8 Character), u16 Number)
+{
+	u8 Local_Au8Digits[5];
+	u8 Local_u8Count = 0;
+
+	do
+	{
+		Local_Au8Digits[Local_u8Count++] = '0' + (Number % 10);
+		Number /= 10;
+	} while(Number != 0);
+
+	while(Local_u8Count != 0)
 	{
-		DIO_setChannelDirection(Local_PinCounter, DIO_PinsConfigArray[Local_PinCounter]);
+		PutChar(Local_Au8Digits[--Local_u8Count]);
 	}
 }
+#endif
@@ -0,0 +1,64 @@
+/*
+ * File: DIO_CAPTURE_APP.c
+ *
+ * Description:
+ *     Test file for the DIO capture module on an AVR ATmega32 engineering kit.
+ *     Checks the keypad wiring without a scope: the rows (PC5..PC2) are driven low and
+ *     the columns (PD7, PD6, PD5, PD3) are set as inputs with their pull-ups enabled here,
+ *     whatever DIO_config.h selects, and captured on PORTD.
+ *       1. A paced capture triggers on the first column falling (key press) and keeps the
+ *          history before it, so the press bounce and the release are both recorded.
+ *       2. A burst capture then records the next edge at full speed.
+ *     Each capture is dumped on the USART (BENCH transmitter, 38400 8N1); save the
+ *     terminal output between the $comment lines as a .vcd file and open it in GTKWave.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../DIO/DIO_interface.h"
+#include "./DIO_CAPTURE_interface.h"
+
+/* BENCH (USART transmitter) */
+#include "../../BENCH/BENCH_interface.h"
+
+/* Keypad column pins on PORTD and row pins on PORTC */
+#define APP_COLUMNS_MASK      ((1 << DIO_PIN7) | (1 << DIO_PIN6) | (1 << DIO_PIN5) | (1 << DIO_PIN3))
+#define APP_ROWS_MASK         ((1 << DIO_PIN5) | (1 << DIO_PIN4) | (1 << DIO_PIN3) | (1 << DIO_PIN2))
+
+int main(void)
+{
+	DIO_initPinsConfig();
+
+	/* Rows outputs low, columns inputs with pull-up */
+	DIO_writePortMasked(DIO_PORTC, APP_ROWS_MASK, 0x00);
+	DIO_writePortDirectionMasked(DIO_PORTC, APP_ROWS_MASK, APP_ROWS_MASK);
+	DIO_writePortDirectionMasked(DIO_PORTD, APP_COLUMNS_MASK, 0x00);
+	DIO_writePortMasked(DIO_PORTD, APP_COLUMNS_MASK, APP_COLUMNS_MASK);
+	BENCH_voidUartInit();
+
+	/* 1. Paced: 20 us per sample, wait at most 30 s for a key */
+	DIO_captureSetTrigger(DIO_CAPTURE_TRIGGER_FALLING, APP_COLUMNS_MASK, 0);
+	if (DIO_captureRun(DIO_CAPTURE_MODE_PACED, 1500000UL) == DIO_CAPTURE_TRIGGERED)
+	{
+		DIO_captureDump(BENCH_voidUartPutChar);
+	}
+
+	/* 2. Burst: next change on any column */
+	DIO_captureSetTrigger(DIO_CAPTURE_TRIGGER_EDGE, APP_COLUMNS_MASK, 0);
+	if (DIO_captureRun(DIO_CAPTURE_MODE_BURST, 0) == DIO_CAPTURE_TRIGGERED)
+	{
+		DIO_captureDump(BENCH_voidUartPutChar);
+	}
+
+	while (1)
+	{
+	}
+
+	return 0;
+}
@@ -0,0 +1,44 @@
+/*
+ * File: DIO_CAPTURE_config.h
+ *
+ * Description:
+ *     Configuration header file for the DIO capture module.
+ *
+ * Usage:
+ *     - DIO_CAPTURE_PORT_1..4: Ports sampled, DIO_PORTA..DIO_PORTD or DIO_CAPTURE_PORT_NONE.
+ *       The used ports come first; every extra port costs one byte per sample (burst) or
+ *       per record (paced). The trigger looks at DIO_CAPTURE_PORT_1.
+ *     - DIO_CAPTURE_BUFFER_SIZE: RAM reserved for the capture, in bytes (the ATmega32 has
+ *       2 KB of SRAM in total).
+ *     - DIO_CAPTURE_PERIOD_US: Sample period of paced captures. Timer1 runs at F_CPU, /8 or
+ *       /64, whichever first fits the period; the build fails if none does. Periods below
+ *       about 10 us at 8 MHz are faster than one loop pass and are counted as overruns in
+ *       the dump.
+ *     - DIO_CAPTURE_PRE_TRIGGER_RECORDS: Records of history kept before the trigger in paced
+ *       mode (the rest of the buffer holds the trigger and what follows).
+ *     - DIO_CAPTURE_BURST_CYCLES_PER_SAMPLE: CPU cycles between burst samples, used only to
+ *       time-stamp the dump. 3 (IN + ST X+) holds for an optimized build and one port;
+ *       check other builds on the simulator.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef DIO_CAPTURE_CONFIG_H_
+#define DIO_CAPTURE_CONFIG_H_
+
+/* Sample the keypad columns and the free PORTD pins */
+#define DIO_CAPTURE_PORT_1                   DIO_PORTD
+#define DIO_CAPTURE_PORT_2                   DIO_CAPTURE_PORT_NONE
+#define DIO_CAPTURE_PORT_3                   DIO_CAPTURE_PORT_NONE
+#define DIO_CAPTURE_PORT_4                   DIO_CAPTURE_PORT_NONE
+
+#define DIO_CAPTURE_BUFFER_SIZE              1024
+
+#define DIO_CAPTURE_PERIOD_US                20UL
+
+#define DIO_CAPTURE_PRE_TRIGGER_RECORDS      64
+
+#define DIO_CAPTURE_BURST_CYCLES_PER_SAMPLE  3UL
+
+#endif /* DIO_CAPTURE_CONFIG_H_ */
@@ -0,0 +1,71 @@
+/*
+ * File: DIO_CAPTURE_interface.h
+ *
+ * Description:
+ *     Header file for the DIO capture module: a logic-analyzer style recorder that samples
+ *     the PINx registers selected in DIO_CAPTURE_config.h into a RAM buffer and dumps the
+ *     capture as a VCD (Value Change Dump) file, viewable in GTKWave or PulseView.
+ *
+ *     Modes:
+ *       DIO_CAPTURE_MODE_BURST : Waits for the trigger, then fills the whole buffer with raw
+ *                                samples from an unrolled loop (a few CPU cycles per sample,
+ *                                see DIO_CAPTURE_BURST_CYCLES_PER_SAMPLE). No pre-trigger
+ *                                history.
+ *       DIO_CAPTURE_MODE_PACED : Samples once per DIO_CAPTURE_PERIOD_US, paced by Timer1 in
+ *                                CTC mode. Samples are run-length compressed (value + repeat
+ *                                count) into a ring buffer, so a slow or idle signal costs one
+ *                                record per change, and DIO_CAPTURE_PRE_TRIGGER_RECORDS of
+ *                                history before the trigger are kept.
+ *
+ *     Interrupts are disabled for the whole capture (timing fidelity) and Timer1 is taken
+ *     during a paced capture and restored afterwards.
+ *
+ *     DIO_captureDump formats its text with the BENCH helpers: link BENCH_program.c.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef DIO_CAPTURE_INTERFACE_H_
+#define DIO_CAPTURE_INTERFACE_H_
+
+/* Capture Modes */
+#define DIO_CAPTURE_MODE_BURST          0
+#define DIO_CAPTURE_MODE_PACED          1
+
+/* Trigger Types (evaluated on the first captured port, DIO_CAPTURE_PORT_1) */
+#define DIO_CAPTURE_TRIGGER_NONE        0   /* Start at once */
+#define DIO_CAPTURE_TRIGGER_PATTERN     1   /* (PINx & Mask) == (Pattern & Mask) */
+#define DIO_CAPTURE_TRIGGER_RISING      2   /* Any Mask bit goes low to high */
+#define DIO_CAPTURE_TRIGGER_FALLING     3   /* Any Mask bit goes high to low */
+#define DIO_CAPTURE_TRIGGER_EDGE        4   /* Any Mask bit changes */
+
+/* Capture Results */
+#define DIO_CAPTURE_TRIGGERED           0   /* Triggered and the buffer was filled */
+#define DIO_CAPTURE_TIMEOUT             1   /* Sample budget used up (buffer may hold history) */
+#define DIO_CAPTURE_INVALID             2   /* Invalid mode or trigger */
+
+/* Function: DIO_captureSetTrigger
+ * Description:
+ *     Selects the trigger condition of the next captures. Invalid types are ignored.
+ */
+void DIO_captureSetTrigger(u8 TriggerType, u8 Mask, u8 Pattern);
+
+/* Function: DIO_captureRun
+ * Description:
+ *     Runs one blocking capture in the given mode. MaxSamples bounds the samples taken
+ *     (waiting for the trigger included) so a trigger that never comes cannot hang the
+ *     program; 0 means no bound. Returns DIO_CAPTURE_TRIGGERED, DIO_CAPTURE_TIMEOUT or
+ *     DIO_CAPTURE_INVALID.
+ */
+u8 DIO_captureRun(u8 Mode, u32 MaxSamples);
+
+/* Function: DIO_captureDump
+ * Description:
+ *     Streams the last capture as VCD text through PutChar: one wire per captured pin
+ *     (PA0..PD7) plus a TRIG wire that rises at the trigger sample. Time is in
+ *     microseconds for paced captures and nanoseconds for burst captures.
+ */
+void DIO_captureDump(void (*PutChar)(u8 Char));
+
+#endif /* DIO_CAPTURE_INTERFACE_H_ */
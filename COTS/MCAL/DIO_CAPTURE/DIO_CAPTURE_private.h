@@ -0,0 +1,49 @@
+/*
+ * File: DIO_CAPTURE_private.h
+ *
+ * Description:
+ *     Private header file for the DIO capture module.
+ *     It defines the Timer1 registers used to pace the sampling and the record layout.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef DIO_CAPTURE_PRIVATE_H_
+#define DIO_CAPTURE_PRIVATE_H_
+
+/* Timer1 Registers */
+#define TCCR1A         HW_REG8(0x4F)
+#define TCCR1B         HW_REG8(0x4E)
+#define TCNT1          HW_REG16(0x4C)
+#define OCR1A          HW_REG16(0x4A)
+
+/* Timer Interrupt Flag Register (shared by all timers) */
+#define TIFR           HW_REG8(0x58)
+
+/* TCCR1B / TIFR Bits */
+#define TCCR1B_WGM12   3
+#define TIFR_OCF1A     4
+
+/* Timer1 Clock Select values (CS12:0) */
+#define DIO_CAPTURE_TIMER1_CLOCK_1      1
+#define DIO_CAPTURE_TIMER1_CLOCK_8      2
+#define DIO_CAPTURE_TIMER1_CLOCK_64     3
+
+/* Port selection value for an unused DIO_CAPTURE_PORT_n */
+#define DIO_CAPTURE_PORT_NONE           0xFF
+
+/*
+ * Record Layout:
+ *   Burst : one byte per captured port (one sample).
+ *   Paced : one byte per captured port followed by the little-endian 16-bit count of
+ *           consecutive samples with that value (1..65535).
+ */
+#define DIO_CAPTURE_RUN_BYTES           2
+#define DIO_CAPTURE_RUN_MAX             0xFFFF
+
+/* VCD identifier of pin Index (0..31) and of the trigger marker */
+#define DIO_CAPTURE_VCD_ID(Index)       ((u8)('!' + (Index)))
+#define DIO_CAPTURE_VCD_TRIGGER_ID      DIO_CAPTURE_VCD_ID(32)
+
+#endif /* DIO_CAPTURE_PRIVATE_H_ */
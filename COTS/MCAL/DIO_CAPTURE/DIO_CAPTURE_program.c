@@ -0,0 +1,537 @@
+/*
+ * File: DIO_CAPTURE_program.c
+ *
+ * Description:
+ *     Implementation of the DIO capture module (see DIO_CAPTURE_interface.h).
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <util/atomic.h>
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../DIO/DIO_interface.h"
+#include "../DIO/DIO_private.h"
+#include "./DIO_CAPTURE_interface.h"
+#include "./DIO_CAPTURE_private.h"
+#include "./DIO_CAPTURE_config.h"
+
+/* BENCH (report formatting) */
+#include "../../BENCH/BENCH_interface.h"
+
+/* Number of captured ports: bytes per sample */
+#if DIO_CAPTURE_PORT_1 == DIO_CAPTURE_PORT_NONE
+#error "DIO_CAPTURE_PORT_1 must select a port"
+#elif DIO_CAPTURE_PORT_2 == DIO_CAPTURE_PORT_NONE
+#define DIO_CAPTURE_PORTS_NUM       1
+#elif DIO_CAPTURE_PORT_3 == DIO_CAPTURE_PORT_NONE
+#define DIO_CAPTURE_PORTS_NUM       2
+#elif DIO_CAPTURE_PORT_4 == DIO_CAPTURE_PORT_NONE
+#define DIO_CAPTURE_PORTS_NUM       3
+#else
+#define DIO_CAPTURE_PORTS_NUM       4
+#endif
+
+/* Reads one sample of every captured port into Sample[0..DIO_CAPTURE_PORTS_NUM-1] */
+#if DIO_CAPTURE_PORTS_NUM == 1
+#define DIO_CAPTURE_READ_SAMPLE(Sample)  do { (Sample)[0] = DIO_PIN_REG(DIO_CAPTURE_PORT_1); } while (0)
+#elif DIO_CAPTURE_PORTS_NUM == 2
+#define DIO_CAPTURE_READ_SAMPLE(Sample)  do { (Sample)[0] = DIO_PIN_REG(DIO_CAPTURE_PORT_1); \
+                                              (Sample)[1] = DIO_PIN_REG(DIO_CAPTURE_PORT_2); } while (0)
+#elif DIO_CAPTURE_PORTS_NUM == 3
+#define DIO_CAPTURE_READ_SAMPLE(Sample)  do { (Sample)[0] = DIO_PIN_REG(DIO_CAPTURE_PORT_1); \
+                                              (Sample)[1] = DIO_PIN_REG(DIO_CAPTURE_PORT_2); \
+                                              (Sample)[2] = DIO_PIN_REG(DIO_CAPTURE_PORT_3); } while (0)
+#else
+#define DIO_CAPTURE_READ_SAMPLE(Sample)  do { (Sample)[0] = DIO_PIN_REG(DIO_CAPTURE_PORT_1); \
+                                              (Sample)[1] = DIO_PIN_REG(DIO_CAPTURE_PORT_2); \
+                                              (Sample)[2] = DIO_PIN_REG(DIO_CAPTURE_PORT_3); \
+                                              (Sample)[3] = DIO_PIN_REG(DIO_CAPTURE_PORT_4); } while (0)
+#endif
+
+/* Buffer capacity of each mode, in records */
+#define DIO_CAPTURE_BURST_RECORD_SIZE   DIO_CAPTURE_PORTS_NUM
+#define DIO_CAPTURE_PACED_RECORD_SIZE   (DIO_CAPTURE_PORTS_NUM + DIO_CAPTURE_RUN_BYTES)
+#define DIO_CAPTURE_BURST_RECORDS       (DIO_CAPTURE_BUFFER_SIZE / DIO_CAPTURE_BURST_RECORD_SIZE)
+#define DIO_CAPTURE_PACED_RECORDS       (DIO_CAPTURE_BUFFER_SIZE / DIO_CAPTURE_PACED_RECORD_SIZE)
+
+#if DIO_CAPTURE_PRE_TRIGGER_RECORDS >= DIO_CAPTURE_PACED_RECORDS
+#error "DIO_CAPTURE_PRE_TRIGGER_RECORDS leaves no room for the trigger in DIO_CAPTURE_BUFFER_SIZE"
+#endif
+
+#if DIO_CAPTURE_PACED_RECORDS > 0xFFFF
+#error "DIO_CAPTURE_BUFFER_SIZE is larger than the record index"
+#endif
+
+/* Timer1 compare value and clock selection for one sample period */
+#define DIO_CAPTURE_PERIOD_COUNTS       ((F_CPU / 1000000UL) * DIO_CAPTURE_PERIOD_US)
+
+#if DIO_CAPTURE_PERIOD_COUNTS <= 65536UL
+#define DIO_CAPTURE_TIMER1_CLOCK        DIO_CAPTURE_TIMER1_CLOCK_1
+#define DIO_CAPTURE_TIMER1_TOP          (DIO_CAPTURE_PERIOD_COUNTS - 1)
+#elif (DIO_CAPTURE_PERIOD_COUNTS / 8) <= 65536UL
+#define DIO_CAPTURE_TIMER1_CLOCK        DIO_CAPTURE_TIMER1_CLOCK_8
+#define DIO_CAPTURE_TIMER1_TOP          ((DIO_CAPTURE_PERIOD_COUNTS / 8) - 1)
+#elif (DIO_CAPTURE_PERIOD_COUNTS / 64) <= 65536UL
+#define DIO_CAPTURE_TIMER1_CLOCK        DIO_CAPTURE_TIMER1_CLOCK_64
+#define DIO_CAPTURE_TIMER1_TOP          ((DIO_CAPTURE_PERIOD_COUNTS / 64) - 1)
+#else
+#error "DIO_CAPTURE_PERIOD_US does not fit Timer1"
+#endif
+
+#if DIO_CAPTURE_PERIOD_COUNTS < 1
+#error "DIO_CAPTURE_PERIOD_US is shorter than one CPU cycle"
+#endif
+
+/* Time-stamp unit of a burst sample, in nanoseconds */
+#define DIO_CAPTURE_BURST_NS_PER_SAMPLE ((DIO_CAPTURE_BURST_CYCLES_PER_SAMPLE * 1000000000UL) / F_CPU)
+
+/* Captured ports in sample order, for the dump */
+static const u8 DIO_Au8CapturePorts[DIO_CAPTURE_PORTS_NUM] =
+{
+	DIO_CAPTURE_PORT_1
+#if DIO_CAPTURE_PORTS_NUM > 1
+	, DIO_CAPTURE_PORT_2
+#endif
+#if DIO_CAPTURE_PORTS_NUM > 2
+	, DIO_CAPTURE_PORT_3
+#endif
+#if DIO_CAPTURE_PORTS_NUM > 3
+	, DIO_CAPTURE_PORT_4
+#endif
+};
+
+/* Capture buffer and the description of its content */
+static u8  DIO_Au8CaptureBuffer[DIO_CAPTURE_BUFFER_SIZE];
+static u8  DIO_u8CaptureMode;
+static u16 DIO_u16CaptureRecords;      /* Valid records */
+static u16 DIO_u16CaptureOldest;       /* Index of the oldest record */
+static u16 DIO_u16CaptureTrigger;      /* Index of the record starting at the trigger */
+static u8  DIO_u8CaptureTriggered;
+static u16 DIO_u16CaptureOverruns;     /* Paced samples taken later than their period */
+
+/* Trigger condition */
+static u8 DIO_u8CaptureTriggerType = DIO_CAPTURE_TRIGGER_NONE;
+static u8 DIO_u8CaptureTriggerMask;
+static u8 DIO_u8CaptureTriggerPattern;
+
+/* Private Functions */
+static u8 DIO_u8CaptureMatch(u8 Current, u8 Previous);
+static u8 DIO_u8CaptureBurst(u32 MaxSamples);
+static u8 DIO_u8CapturePaced(u32 MaxSamples);
+static void DIO_voidCapturePutBit(void (*PutChar)(u8), u8 Value, u8 Id);
+
+/*
+ * Function: DIO_captureSetTrigger
+ * Description:
+ *     Stores the trigger used by DIO_captureRun. Mask selects the DIO_CAPTURE_PORT_1 bits
+ *     the condition looks at; Pattern is used by DIO_CAPTURE_TRIGGER_PATTERN only.
+ */
+void DIO_captureSetTrigger(u8 TriggerType, u8 Mask, u8 Pattern)
+{
+	if (TriggerType <= DIO_CAPTURE_TRIGGER_EDGE)
+	{
+		DIO_u8CaptureTriggerType = TriggerType;
+		DIO_u8CaptureTriggerMask = Mask;
+		DIO_u8CaptureTriggerPattern = Pattern & Mask;
+	}
+	else
+	{
+		/* Invalid trigger type, do nothing */
+	}
+}
+
+/*
+ * Function: DIO_captureRun
+ * Description:
+ *     Runs the capture with interrupts disabled and returns its result. The previous
+ *     capture is discarded.
+ */
+u8 DIO_captureRun(u8 Mode, u32 MaxSamples)
+{
+	u8 Local_u8Result = DIO_CAPTURE_INVALID;
+
+	if ((Mode == DIO_CAPTURE_MODE_BURST) || (Mode == DIO_CAPTURE_MODE_PACED))
+	{
+		DIO_u8CaptureMode = Mode;
+		DIO_u16CaptureRecords = 0;
+		DIO_u16CaptureOldest = 0;
+		DIO_u16CaptureTrigger = 0;
+		DIO_u8CaptureTriggered = 0;
+		DIO_u16CaptureOverruns = 0;
+
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			if (Mode == DIO_CAPTURE_MODE_BURST)
+			{
+				Local_u8Result = DIO_u8CaptureBurst(MaxSamples);
+			}
+			else
+			{
+				Local_u8Result = DIO_u8CapturePaced(MaxSamples);
+			}
+		}
+	}
+
+	return Local_u8Result;
+}
+
+/*
+ * Function: DIO_u8CaptureMatch
+ * Description:
+ *     Evaluates the trigger condition on two consecutive DIO_CAPTURE_PORT_1 samples.
+ */
+static u8 DIO_u8CaptureMatch(u8 Current, u8 Previous)
+{
+	u8 Local_u8Match;
+
+	Current &= DIO_u8CaptureTriggerMask;
+	Previous &= DIO_u8CaptureTriggerMask;
+
+	switch (DIO_u8CaptureTriggerType)
+	{
+		case DIO_CAPTURE_TRIGGER_PATTERN: Local_u8Match = (Current == DIO_u8CaptureTriggerPattern); break;
+		case DIO_CAPTURE_TRIGGER_RISING:  Local_u8Match = ((Current & (u8)~Previous) != 0);         break;
+		case DIO_CAPTURE_TRIGGER_FALLING: Local_u8Match = (((u8)~Current & Previous) != 0);         break;
+		case DIO_CAPTURE_TRIGGER_EDGE:    Local_u8Match = (Current != Previous);                     break;
+		default:                          Local_u8Match = 1;                                          break;
+	}
+
+	return Local_u8Match;
+}
+
+/*
+ * Function: DIO_u8CaptureBurst
+ * Description:
+ *     Polls DIO_CAPTURE_PORT_1 until the trigger matches (or MaxSamples polls), then fills
+ *     the buffer with back-to-back samples, eight per loop pass.
+ */
+static u8 DIO_u8CaptureBurst(u32 MaxSamples)
+{
+	u8 Local_Au8Sample[DIO_CAPTURE_PORTS_NUM];
+	u8 Local_u8Previous;
+	u32 Local_u32Polls = 0;
+	u8* Local_pu8Write = DIO_Au8CaptureBuffer;
+	u16 Local_u16Blocks = DIO_CAPTURE_BURST_RECORDS / 8;
+	u8 Local_u8Remainder = DIO_CAPTURE_BURST_RECORDS % 8;
+
+	/* No edge on the first sample; a pattern may already be present */
+	DIO_CAPTURE_READ_SAMPLE(Local_Au8Sample);
+	Local_u8Previous = Local_Au8Sample[0];
+
+	while (!DIO_u8CaptureMatch(Local_Au8Sample[0], Local_u8Previous))
+	{
+		if ((MaxSamples != 0) && (++Local_u32Polls >= MaxSamples))
+		{
+			return DIO_CAPTURE_TIMEOUT;
+		}
+
+		Local_u8Previous = Local_Au8Sample[0];
+		DIO_CAPTURE_READ_SAMPLE(Local_Au8Sample);
+	}
+
+	while (Local_u16Blocks != 0)
+	{
+		DIO_CAPTURE_READ_SAMPLE(Local_pu8Write); Local_pu8Write += DIO_CAPTURE_PORTS_NUM;
+		DIO_CAPTURE_READ_SAMPLE(Local_pu8Write); Local_pu8Write += DIO_CAPTURE_PORTS_NUM;
+		DIO_CAPTURE_READ_SAMPLE(Local_pu8Write); Local_pu8Write += DIO_CAPTURE_PORTS_NUM;
+		DIO_CAPTURE_READ_SAMPLE(Local_pu8Write); Local_pu8Write += DIO_CAPTURE_PORTS_NUM;
+		DIO_CAPTURE_READ_SAMPLE(Local_pu8Write); Local_pu8Write += DIO_CAPTURE_PORTS_NUM;
+		DIO_CAPTURE_READ_SAMPLE(Local_pu8Write); Local_pu8Write += DIO_CAPTURE_PORTS_NUM;
+		DIO_CAPTURE_READ_SAMPLE(Local_pu8Write); Local_pu8Write += DIO_CAPTURE_PORTS_NUM;
+		DIO_CAPTURE_READ_SAMPLE(Local_pu8Write); Local_pu8Write += DIO_CAPTURE_PORTS_NUM;
+		Local_u16Blocks--;
+	}
+
+	while (Local_u8Remainder != 0)
+	{
+		DIO_CAPTURE_READ_SAMPLE(Local_pu8Write); Local_pu8Write += DIO_CAPTURE_PORTS_NUM;
+		Local_u8Remainder--;
+	}
+
+	DIO_u16CaptureRecords = DIO_CAPTURE_BURST_RECORDS;
+	DIO_u8CaptureTriggered = 1;
+
+	return DIO_CAPTURE_TRIGGERED;
+}
+
+/*
+ * Function: DIO_u8CapturePaced
+ * Description:
+ *     Takes one sample per Timer1 compare match. A sample equal to the previous one only
+ *     extends the run of the current record; a change, a full run or the trigger opens a
+ *     new record in the ring, overwriting the oldest. After the trigger the ring may
+ *     overwrite only the records beyond DIO_CAPTURE_PRE_TRIGGER_RECORDS of history, and
+ *     the capture ends when a new record would need more room.
+ *     TCCR1A, TCCR1B, OCR1A and TCNT1 are restored afterwards, so a Timer1 time base
+ *     (BENCH, DIO trace, SW_PWM) keeps its mode, prescaler and compare value; its count
+ *     resumes from where the capture found it.
+ */
+static u8 DIO_u8CapturePaced(u32 MaxSamples)
+{
+	u8 Local_Au8Sample[DIO_CAPTURE_PORTS_NUM];
+	u8 Local_Au8Previous[DIO_CAPTURE_PORTS_NUM];
+	u8* Local_pu8Record = DIO_Au8CaptureBuffer;
+	u8 Local_u8Result = DIO_CAPTURE_TIMEOUT;
+	u8 Local_u8NewRecord;
+	u8 Local_u8Port;
+	u16 Local_u16Index = 0;
+	u16 Local_u16Run = 1;
+	u16 Local_u16PostRecords = DIO_CAPTURE_PACED_RECORDS - DIO_CAPTURE_PRE_TRIGGER_RECORDS;
+	u32 Local_u32Samples = 1;
+	u8  Local_u8Tccr1aSaved = TCCR1A;
+	u8  Local_u8Tccr1bSaved = TCCR1B;
+	u16 Local_u16Ocr1aSaved = OCR1A;
+	u16 Local_u16Tcnt1Saved = TCNT1;
+
+	/* Timer1: CTC on OCR1A, one compare match per sample period */
+	TCCR1B = 0;
+	TCCR1A = 0;
+	TCNT1 = 0;
+	OCR1A = DIO_CAPTURE_TIMER1_TOP;
+	TIFR = (1 << TIFR_OCF1A);              // Flag is cleared by writing one
+	TCCR1B = (1 << TCCR1B_WGM12) | DIO_CAPTURE_TIMER1_CLOCK;
+
+	/* First record */
+	DIO_CAPTURE_READ_SAMPLE(Local_Au8Sample);
+	for (Local_u8Port = 0; Local_u8Port < DIO_CAPTURE_PORTS_NUM; Local_u8Port++)
+	{
+		Local_pu8Record[Local_u8Port] = Local_Au8Sample[Local_u8Port];
+		Local_Au8Previous[Local_u8Port] = Local_Au8Sample[Local_u8Port];
+	}
+	Local_pu8Record[DIO_CAPTURE_PORTS_NUM] = 1;
+	Local_pu8Record[DIO_CAPTURE_PORTS_NUM + 1] = 0;
+	DIO_u16CaptureRecords = 1;
+
+	if ((DIO_u8CaptureTriggerType == DIO_CAPTURE_TRIGGER_NONE) ||
+	    ((DIO_u8CaptureTriggerType == DIO_CAPTURE_TRIGGER_PATTERN) && DIO_u8CaptureMatch(Local_Au8Sample[0], Local_Au8Sample[0])))
+	{
+		DIO_u8CaptureTriggered = 1;
+		Local_u16PostRecords = (DIO_u8CaptureTriggerType == DIO_CAPTURE_TRIGGER_NONE) ?
+		                       DIO_CAPTURE_PACED_RECORDS - 1 : Local_u16PostRecords - 1;
+	}
+
+	while ((MaxSamples == 0) || (Local_u32Samples < MaxSamples))
+	{
+		/* A flag already raised means the previous pass took longer than one period */
+		if (GET_BIT(TIFR, TIFR_OCF1A))
+		{
+			DIO_u16CaptureOverruns++;
+		}
+		while (GET_BIT(TIFR, TIFR_OCF1A) == 0);
+		TIFR = (1 << TIFR_OCF1A);
+
+		DIO_CAPTURE_READ_SAMPLE(Local_Au8Sample);
+		Local_u32Samples++;
+
+		Local_u8NewRecord = (Local_u16Run == DIO_CAPTURE_RUN_MAX);
+		for (Local_u8Port = 0; Local_u8Port < DIO_CAPTURE_PORTS_NUM; Local_u8Port++)
+		{
+			if (Local_Au8Sample[Local_u8Port] != Local_Au8Previous[Local_u8Port])
+			{
+				Local_u8NewRecord = 1;
+			}
+		}
+
+		if (!DIO_u8CaptureTriggered && DIO_u8CaptureMatch(Local_Au8Sample[0], Local_Au8Previous[0]))
+		{
+			DIO_u8CaptureTriggered = 2;    // Triggered on this sample, record not opened yet
+			Local_u8NewRecord = 1;
+		}
+
+		if (Local_u8NewRecord)
+		{
+			if (DIO_u8CaptureTriggered)
+			{
+				if (Local_u16PostRecords == 0)
+				{
+					Local_u8Result = DIO_CAPTURE_TRIGGERED;
+					break;
+				}
+				Local_u16PostRecords--;
+			}
+
+			Local_u16Index = (Local_u16Index == (DIO_CAPTURE_PACED_RECORDS - 1)) ? 0 : (Local_u16Index + 1);
+			Local_pu8Record = &DIO_Au8CaptureBuffer[Local_u16Index * DIO_CAPTURE_PACED_RECORD_SIZE];
+
+			if (DIO_u16CaptureRecords < DIO_CAPTURE_PACED_RECORDS)
+			{
+				DIO_u16CaptureRecords++;
+			}
+			else
+			{
+				DIO_u16CaptureOldest = (Local_u16Index == (DIO_CAPTURE_PACED_RECORDS - 1)) ? 0 : (Local_u16Index + 1);
+			}
+
+			if (DIO_u8CaptureTriggered == 2)
+			{
+				DIO_u8CaptureTriggered = 1;
+				DIO_u16CaptureTrigger = Local_u16Index;
+			}
+
+			for (Local_u8Port = 0; Local_u8Port < DIO_CAPTURE_PORTS_NUM; Local_u8Port++)
+			{
+				Local_pu8Record[Local_u8Port] = Local_Au8Sample[Local_u8Port];
+				Local_Au8Previous[Local_u8Port] = Local_Au8Sample[Local_u8Port];
+			}
+			Local_u16Run = 1;
+		}
+		else
+		{
+			Local_u16Run++;
+		}
+
+		Local_pu8Record[DIO_CAPTURE_PORTS_NUM] = (u8)Local_u16Run;
+		Local_pu8Record[DIO_CAPTURE_PORTS_NUM + 1] = (u8)(Local_u16Run >> 8);
+	}
+
+	if ((Local_u8Result == DIO_CAPTURE_TIMEOUT) && DIO_u8CaptureTriggered)
+	{
+		Local_u8Result = DIO_CAPTURE_TRIGGERED;
+	}
+
+	/* Restore: Timer1 stopped, then count, compare and mode as found (TCCR1B restarts the clock) */
+	TCCR1B = 0;
+	TCNT1 = Local_u16Tcnt1Saved;
+	OCR1A = Local_u16Ocr1aSaved;
+	TCCR1A = Local_u8Tccr1aSaved;
+	TCCR1B = Local_u8Tccr1bSaved;
+
+	return Local_u8Result;
+}
+
+/*
+ * Function: DIO_captureDump
+ * Description:
+ *     Writes the VCD header, the initial value of every wire at time 0, then for each
+ *     following record that changes a wire (or holds the trigger) its start time and the
+ *     wires that changed.
+ */
+void DIO_captureDump(void (*PutChar)(u8 Char))
+{
+	u8 Local_u8Port;
+	u8 Local_u8Pin;
+	u8 Local_u8Changed;
+	u8 Local_u8TriggerRecord;
+	u16 Local_u16Record;
+	u16 Local_u16Index;
+	u32 Local_u32Time = 0;
+	u32 Local_u32Unit;
+	u8 Local_u8RecordSize;
+	const u8* Local_pu8Record;
+	const u8* Local_pu8Previous = NULL;
+
+	if ((PutChar == NULL) || (DIO_u16CaptureRecords == 0))
+	{
+		return;
+	}
+
+	if (DIO_u8CaptureMode == DIO_CAPTURE_MODE_PACED)
+	{
+		Local_u32Unit = DIO_CAPTURE_PERIOD_US;
+		Local_u8RecordSize = DIO_CAPTURE_PACED_RECORD_SIZE;
+	}
+	else
+	{
+		Local_u32Unit = DIO_CAPTURE_BURST_NS_PER_SAMPLE;
+		Local_u8RecordSize = DIO_CAPTURE_BURST_RECORD_SIZE;
+	}
+
+	/* Header */
+	BENCH_voidPutString(PutChar, "$comment DIO capture: ");
+	BENCH_voidPutNumber(PutChar, DIO_u16CaptureRecords);
+	BENCH_voidPutString(PutChar, " records, ");
+	BENCH_voidPutNumber(PutChar, DIO_u16CaptureOverruns);
+	BENCH_voidPutString(PutChar, " overruns $end\n$timescale ");
+	BENCH_voidPutString(PutChar, (DIO_u8CaptureMode == DIO_CAPTURE_MODE_PACED) ? "1us" : "1ns");
+	BENCH_voidPutString(PutChar, " $end\n$scope module dio $end\n");
+
+	for (Local_u8Port = 0; Local_u8Port < DIO_CAPTURE_PORTS_NUM; Local_u8Port++)
+	{
+		for (Local_u8Pin = 0; Local_u8Pin < 8; Local_u8Pin++)
+		{
+			BENCH_voidPutString(PutChar, "$var wire 1 ");
+			PutChar(DIO_CAPTURE_VCD_ID(Local_u8Port * 8 + Local_u8Pin));
+			BENCH_voidPutString(PutChar, " P");
+			PutChar((u8)('A' + DIO_Au8CapturePorts[Local_u8Port]));
+			PutChar((u8)('0' + Local_u8Pin));
+			BENCH_voidPutString(PutChar, " $end\n");
+		}
+	}
+
+	BENCH_voidPutString(PutChar, "$var wire 1 ");
+	PutChar(DIO_CAPTURE_VCD_TRIGGER_ID);
+	BENCH_voidPutString(PutChar, " TRIG $end\n$upscope $end\n$enddefinitions $end\n");
+
+	/* Value changes, oldest record first; records that change nothing are skipped */
+	Local_u16Index = DIO_u16CaptureOldest;
+	for (Local_u16Record = 0; Local_u16Record < DIO_u16CaptureRecords; Local_u16Record++)
+	{
+		Local_pu8Record = &DIO_Au8CaptureBuffer[Local_u16Index * Local_u8RecordSize];
+		Local_u8TriggerRecord = DIO_u8CaptureTriggered && (Local_u16Index == DIO_u16CaptureTrigger);
+
+		Local_u8Changed = (Local_pu8Previous == NULL) || Local_u8TriggerRecord;
+		for (Local_u8Port = 0; (Local_u8Port < DIO_CAPTURE_PORTS_NUM) && !Local_u8Changed; Local_u8Port++)
+		{
+			Local_u8Changed = (Local_pu8Record[Local_u8Port] != Local_pu8Previous[Local_u8Port]);
+		}
+
+		if (Local_u8Changed)
+		{
+			PutChar('#');
+			BENCH_voidPutNumber(PutChar, Local_u32Time * Local_u32Unit);
+			PutChar('\n');
+
+			for (Local_u8Port = 0; Local_u8Port < DIO_CAPTURE_PORTS_NUM; Local_u8Port++)
+			{
+				Local_u8Changed = (Local_pu8Previous == NULL) ? 0xFF : (Local_pu8Record[Local_u8Port] ^ Local_pu8Previous[Local_u8Port]);
+
+				for (Local_u8Pin = 0; Local_u8Pin < 8; Local_u8Pin++)
+				{
+					if (GET_BIT(Local_u8Changed, Local_u8Pin))
+					{
+						DIO_voidCapturePutBit(PutChar, GET_BIT(Local_pu8Record[Local_u8Port], Local_u8Pin),
+						                      DIO_CAPTURE_VCD_ID(Local_u8Port * 8 + Local_u8Pin));
+					}
+				}
+			}
+
+			if ((Local_pu8Previous == NULL) || Local_u8TriggerRecord)
+			{
+				DIO_voidCapturePutBit(PutChar, Local_u8TriggerRecord, DIO_CAPTURE_VCD_TRIGGER_ID);
+			}
+		}
+
+		if (DIO_u8CaptureMode == DIO_CAPTURE_MODE_PACED)
+		{
+			Local_u32Time += (u16)(Local_pu8Record[DIO_CAPTURE_PORTS_NUM] | (Local_pu8Record[DIO_CAPTURE_PORTS_NUM + 1] << 8));
+			Local_u16Index = (Local_u16Index == (DIO_CAPTURE_PACED_RECORDS - 1)) ? 0 : (Local_u16Index + 1);
+		}
+		else
+		{
+			Local_u32Time++;
+			Local_u16Index++;
+		}
+
+		Local_pu8Previous = Local_pu8Record;
+	}
+
+	/* End time, so the last value shows its duration */
+	PutChar('#');
+	BENCH_voidPutNumber(PutChar, Local_u32Time * Local_u32Unit);
+	PutChar('\n');
+}
+
+/* Dump formatting helper */
+static void DIO_voidCapturePutBit(void (*PutChar)(u8), u8 Value, u8 Id)
+{
+	PutChar(Value ? '1' : '0');
+	PutChar(Id);
+	PutChar('\n');
+}
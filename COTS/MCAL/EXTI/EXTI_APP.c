@@ -0,0 +1,64 @@
+/*
+ * File: EXTI_APP.c
+ *
+ * Description:
+ *     Test file for the EXTI module on an AVR ATmega32 engineering kit.
+ *     At start-up the INT0 edge-to-callback latency is measured and shown on the LCD
+ *     (the PD2 button must not be pressed during the measurement). Then every press on
+ *     the PD2 button toggles the green LED (PA4) from the INT0 callback, while the main
+ *     loop does nothing else.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <avr/interrupt.h>
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../../MCAL/DIO/DIO_interface.h"
+#include "./EXTI_interface.h"
+
+/* HAL */
+#include "../../HAL/LCD_4x20/LCD_interface.h"
+
+static void EXTI_APP_voidButtonPressed(void)
+{
+	DIO_togglePinValue(DIO_PORTA, DIO_PIN4);
+}
+
+int main(void)
+{
+	u16 Local_u16Latency;
+
+	/* Green LED */
+	DIO_setPinDirection(DIO_PORTA, DIO_PIN4, DIO_PIN_OUTPUT);
+
+	/* Button to ground on INT0, internal pull-up */
+	DIO_setPinDirection(DIO_PORTD, DIO_PIN2, DIO_PIN_INPUT);
+	DIO_activePinInPullUpResistance(DIO_PORTD, DIO_PIN2);
+
+	LCD_voidInit();
+
+	EXTI_voidInit();
+	sei();
+
+	/* Cycles from the edge to the callback (set afterwards, so the LED is not toggled) */
+	Local_u16Latency = EXTI_u16MeasureLatency(EXTI_INT0);
+	EXTI_voidSetCallBack(EXTI_INT0, EXTI_APP_voidButtonPressed);
+
+	LCD_voidWriteString((u8*)"INT0 latency:");
+	LCD_voidGoTo(LCD_LINE_TWO, 0);
+	LCD_voidWriteNumber(Local_u16Latency);
+	LCD_voidWriteString((u8*)" cycles");
+
+	while(1)
+	{
+	}
+
+	return 0;
+}
@@ -0,0 +1,52 @@
+/*
+ * File: EXTI_config.h
+ *
+ * Description:
+ *     Configuration header file for the External Interrupt (EXTI) module for AVR ATmega32.
+ *
+ * Usage:
+ *     - EXTI_INTx_SENSE: Sense control applied by EXTI_voidInit (EXTI_LOW_LEVEL,
+ *       EXTI_ANY_CHANGE, EXTI_FALLING_EDGE or EXTI_RISING_EDGE; INT2 edges only).
+ *     - EXTI_INTx_INIT_STATE: EXTI_ENABLED or EXTI_DISABLED after EXTI_voidInit.
+ *       With DIO_PIN_MAP_GENERATED (DIO_config.h) an enabled line must have its pin in the
+ *       board pin map (EXTI INTx in PINMAP/pinmap.txt), or the build fails.
+ *     - EXTI_INTx_DISPATCH: How the vector runs.
+ *         EXTI_DISPATCH_CALLBACK: the vector saves the call-clobbered registers and
+ *           calls the function set with EXTI_voidSetCallBack (about 40 cycles to the
+ *           callback and 40 back at -Os).
+ *         EXTI_DISPATCH_NAKED: the vector has no prologue or epilogue; it runs
+ *           EXTI_INTx_NAKED_BODY() and returns. The body must not change any register
+ *           or SREG, so it is limited to the EXTI_NAKED_* helpers of EXTI_private.h
+ *           (SBI/CBI on constant pins, a few cycles each).
+ *     - EXTI_LATENCY_MEASUREMENT: EXTI_ENABLED stamps Timer1 at the start of every
+ *       callback vector (4 cycles) and provides EXTI_u16MeasureLatency.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef EXTI_CONFIG_H_
+#define EXTI_CONFIG_H_
+
+/* INT0 (PD2): push button to ground, callback */
+#define EXTI_INT0_SENSE              EXTI_FALLING_EDGE
+#define EXTI_INT0_INIT_STATE         EXTI_ENABLED
+#define EXTI_INT0_DISPATCH           EXTI_DISPATCH_CALLBACK
+#define EXTI_INT0_NAKED_BODY()
+
+/* INT1 (PD3): callback */
+#define EXTI_INT1_SENSE              EXTI_FALLING_EDGE
+#define EXTI_INT1_INIT_STATE         EXTI_DISABLED
+#define EXTI_INT1_DISPATCH           EXTI_DISPATCH_CALLBACK
+#define EXTI_INT1_NAKED_BODY()
+
+/* INT2 (PB2): naked, mirrors every rising edge on the red LED (PB7) */
+#define EXTI_INT2_SENSE              EXTI_RISING_EDGE
+#define EXTI_INT2_INIT_STATE         EXTI_DISABLED
+#define EXTI_INT2_DISPATCH           EXTI_DISPATCH_NAKED
+#define EXTI_INT2_NAKED_BODY()       EXTI_NAKED_TOGGLE_PIN(DIO_PORTB, DIO_PIN7)
+
+/* Interrupt latency measurement */
+#define EXTI_LATENCY_MEASUREMENT     EXTI_ENABLED
+
+#endif /* EXTI_CONFIG_H_ */
@@ -0,0 +1,71 @@
+/*
+ * File: EXTI_interface.h
+ *
+ * Description:
+ *     Header file for the External Interrupt (EXTI) module for AVR ATmega32.
+ *     INT0 (PD2), INT1 (PD3) and INT2 (PB2) call a per-line callback from their vector,
+ *     so the application reacts to an input without polling it. A line configured as
+ *     naked in EXTI_config.h runs a register-free body instead (see EXTI_config.h).
+ *     Global interrupts must be enabled by the application (sei()).
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef EXTI_INTERFACE_H_
+#define EXTI_INTERFACE_H_
+
+/* External Interrupt Lines */
+#define EXTI_INT0              0   /* PD2 */
+#define EXTI_INT1              1   /* PD3 */
+#define EXTI_INT2              2   /* PB2, edges only */
+
+/* Sense Control */
+#define EXTI_LOW_LEVEL         0   /* INT0/INT1 only: fires while the pin is low */
+#define EXTI_ANY_CHANGE        1   /* INT0/INT1 only */
+#define EXTI_FALLING_EDGE      2
+#define EXTI_RISING_EDGE       3
+
+/* Function: EXTI_voidInit
+ * Description:
+ *     Applies the sense control and enable state of every line from EXTI_config.h.
+ *     The pins keep their DIO configuration (inputs, with pull-up where needed).
+ */
+void EXTI_voidInit(void);
+
+/* Function: EXTI_voidSetSenseControl
+ * Description:
+ *     Selects what triggers the line. A pending flag raised by the change is cleared.
+ *     Invalid lines, senses, or level/any-change on INT2 are ignored.
+ */
+void EXTI_voidSetSenseControl(u8 Copy_u8Line, u8 Copy_u8Sense);
+
+/* Function: EXTI_voidEnable / EXTI_voidDisable
+ * Description:
+ *     Enables or disables the interrupt of the line. Enabling clears a stale pending flag
+ *     first, so only events after the call are reported.
+ */
+void EXTI_voidEnable(u8 Copy_u8Line);
+void EXTI_voidDisable(u8 Copy_u8Line);
+
+/* Function: EXTI_voidSetCallBack
+ * Description:
+ *     Registers the function called from the vector of the line, in interrupt context.
+ *     NULL disables it. Ignored for naked lines.
+ */
+void EXTI_voidSetCallBack(u8 Copy_u8Line, void (*Copy_pvCallBack)(void));
+
+/* Function: EXTI_u16MeasureLatency
+ * Description:
+ *     Available with EXTI_LATENCY_MEASUREMENT enabled. Triggers the line in software by
+ *     driving its pin as an output (rising edge), and returns the CPU cycles from the
+ *     edge to the callback call in the vector. The result includes about two cycles of
+ *     instrumentation. Returns 0 if the line is naked or the interrupt did not arrive.
+ *     Nothing may drive the pin externally during the call. Global interrupts must be
+ *     enabled. Timer1 runs at F_CPU during the call. The line's sense, enable state
+ *     and pin configuration, and the Timer1 mode and prescaler (TCCR1A/TCCR1B), are
+ *     restored.
+ */
+u16 EXTI_u16MeasureLatency(u8 Copy_u8Line);
+
+#endif /* EXTI_INTERFACE_H_ */
@@ -0,0 +1,79 @@
+/*
+ * File: EXTI_private.h
+ *
+ * Description:
+ *     Private header file for the External Interrupt (EXTI) module for AVR ATmega32.
+ *     It defines the interrupt control registers, their bits, the dispatch options and
+ *     the register-free helpers available to naked vector bodies.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef EXTI_PRIVATE_H_
+#define EXTI_PRIVATE_H_
+
+/* External Interrupt Registers */
+#define MCUCR          HW_REG8(0x55)
+#define MCUCSR         HW_REG8(0x54)
+#define GICR           HW_REG8(0x5B)
+#define GIFR           HW_REG8(0x5A)
+
+/* MCUCR Bits: ISC01:0 for INT0, ISC11:10 for INT1 */
+#define MCUCR_ISC00    0
+#define MCUCR_ISC10    2
+#define EXTI_ISC_MASK  0x03
+
+/* MCUCSR Bits */
+#define MCUCSR_ISC2    6
+
+/* GICR / GIFR Bits */
+#define GICR_INT1      7
+#define GICR_INT0      6
+#define GICR_INT2      5
+#define GIFR_INTF1     7
+#define GIFR_INTF0     6
+#define GIFR_INTF2     5
+
+/* Timer1 Registers (latency measurement) */
+#define TCCR1A         HW_REG8(0x4F)
+#define TCCR1B         HW_REG8(0x4E)
+#define TCNT1          HW_REG16(0x4C)
+
+/* Options */
+#define EXTI_DISABLED            0
+#define EXTI_ENABLED             1
+
+#define EXTI_DISPATCH_CALLBACK   0
+#define EXTI_DISPATCH_NAKED      1
+
+#define EXTI_LINES_NUM           3
+
+/* Timeout of the latency measurement, in polls of the entry flag */
+#define EXTI_LATENCY_TIMEOUT     1000
+
+/*
+ * Naked Body Helpers:
+ * A naked vector has no prologue: it may not change any register or SREG. These helpers
+ * compile to SBI/CBI/SBIS and RJMP only, on constant DIO_PORTx/DIO_PINx arguments.
+ * (Host builds, see HOST/HOST_interface.h, use plain C instead.)
+ */
+#define EXTI_PORT_IO_ADDRESS(PortId)   (DIO_PINA_ADDRESS - (DIO_PORT_BLOCK_SIZE * (PortId)) + 2 - 0x20)
+
+#ifndef HOST_BUILD
+#define EXTI_NAKED_SET_PIN(PortId, PinId) \
+        __asm__ __volatile__ ("sbi %0, %1" :: "I" (EXTI_PORT_IO_ADDRESS(PortId)), "I" (PinId))
+#define EXTI_NAKED_CLEAR_PIN(PortId, PinId) \
+        __asm__ __volatile__ ("cbi %0, %1" :: "I" (EXTI_PORT_IO_ADDRESS(PortId)), "I" (PinId))
+#define EXTI_NAKED_TOGGLE_PIN(PortId, PinId) \
+        __asm__ __volatile__ ("sbis %0, %1" "\n\t" "rjmp 1f"       "\n\t" \
+                              "cbi %0, %1"  "\n\t" "rjmp 2f"       "\n"   \
+                              "1: sbi %0, %1" "\n" "2:"                   \
+                              :: "I" (EXTI_PORT_IO_ADDRESS(PortId)), "I" (PinId))
+#else
+#define EXTI_NAKED_SET_PIN(PortId, PinId)     SET_BIT(DIO_PORT_REG(PortId), (PinId))
+#define EXTI_NAKED_CLEAR_PIN(PortId, PinId)   CLR_BIT(DIO_PORT_REG(PortId), (PinId))
+#define EXTI_NAKED_TOGGLE_PIN(PortId, PinId)  TOG_BIT(DIO_PORT_REG(PortId), (PinId))
+#endif
+
+#endif /* EXTI_PRIVATE_H_ */
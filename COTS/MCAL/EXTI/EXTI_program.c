@@ -0,0 +1,389 @@
+/*
+ * File: EXTI_program.c
+ *
+ * Description:
+ *     Implementation of the External Interrupt (EXTI) module for AVR ATmega32.
+ *     Each vector is compiled as a callback dispatcher or as a naked body, as selected
+ *     in EXTI_config.h; the callback vectors optionally stamp Timer1 on entry so the
+ *     edge-to-callback latency can be measured.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../DIO/DIO_interface.h"
+#include "../DIO/DIO_private.h"
+#include "../DIO/DIO_config.h"
+#include "../EXTI/EXTI_interface.h"
+#include "../EXTI/EXTI_private.h"
+#include "../EXTI/EXTI_config.h"
+
+#if (EXTI_INT2_SENSE != EXTI_FALLING_EDGE) && (EXTI_INT2_SENSE != EXTI_RISING_EDGE)
+#error "EXTI_INT2_SENSE must be EXTI_FALLING_EDGE or EXTI_RISING_EDGE"
+#endif
+
+/* With the generated pin map, the lines enabled at init must own their pin in PINMAP/pinmap.txt */
+#if DIO_PIN_MAP == DIO_PIN_MAP_GENERATED
+#if (EXTI_INT0_INIT_STATE == EXTI_ENABLED) && (PINMAP_EXTI_INT0_ID != DIO_PIN_ID(DIO_PORTD, DIO_PIN2))
+#error "EXTI: INT0 is enabled but the pin map has no EXTI INT0 on PD2"
+#endif
+
+#if (EXTI_INT1_INIT_STATE == EXTI_ENABLED) && (PINMAP_EXTI_INT1_ID != DIO_PIN_ID(DIO_PORTD, DIO_PIN3))
+#error "EXTI: INT1 is enabled but the pin map has no EXTI INT1 on PD3"
+#endif
+
+#if (EXTI_INT2_INIT_STATE == EXTI_ENABLED) && (PINMAP_EXTI_INT2_ID != DIO_PIN_ID(DIO_PORTB, DIO_PIN2))
+#error "EXTI: INT2 is enabled but the pin map has no EXTI INT2 on PB2"
+#endif
+#endif /* DIO_PIN_MAP */
+
+/* Enable / flag bit of each line in GICR and GIFR (same positions) */
+static const u8 EXTI_Au8EnableBit[EXTI_LINES_NUM] = {GICR_INT0, GICR_INT1, GICR_INT2};
+
+/* Pin of each line */
+static const u8 EXTI_Au8Port[EXTI_LINES_NUM] = {DIO_PORTD, DIO_PORTD, DIO_PORTB};
+static const u8 EXTI_Au8Pin[EXTI_LINES_NUM]  = {DIO_PIN2, DIO_PIN3, DIO_PIN2};
+
+/* Dispatch type of each line */
+static const u8 EXTI_Au8Dispatch[EXTI_LINES_NUM] = {EXTI_INT0_DISPATCH, EXTI_INT1_DISPATCH, EXTI_INT2_DISPATCH};
+
+/* Callbacks, called from the vectors */
+static void (*EXTI_ApvCallBack[EXTI_LINES_NUM])(void) = {NULL, NULL, NULL};
+
+#if EXTI_LATENCY_MEASUREMENT == EXTI_ENABLED
+/* Timer1 count at the last callback vector entry, and which line it belongs to */
+static volatile u16 EXTI_u16EntryStamp;
+static volatile u8  EXTI_u8StampedLine = EXTI_LINES_NUM;
+
+#define EXTI_STAMP_ENTRY(Line)   do { EXTI_u16EntryStamp = TCNT1; EXTI_u8StampedLine = (Line); } while (0)
+#else
+#define EXTI_STAMP_ENTRY(Line)
+#endif
+
+/*
+ * Function: EXTI_u8GetSenseControl
+ * Description:
+ *     Returns the current sense control of a valid line.
+ */
+static u8 EXTI_u8GetSenseControl(u8 Copy_u8Line)
+{
+	u8 Local_u8Sense;
+
+	switch (Copy_u8Line)
+	{
+	case EXTI_INT0:
+		Local_u8Sense = (MCUCR >> MCUCR_ISC00) & EXTI_ISC_MASK;
+		break;
+	case EXTI_INT1:
+		Local_u8Sense = (MCUCR >> MCUCR_ISC10) & EXTI_ISC_MASK;
+		break;
+	default:
+		Local_u8Sense = GET_BIT(MCUCSR, MCUCSR_ISC2) ? EXTI_RISING_EDGE : EXTI_FALLING_EDGE;
+		break;
+	}
+
+	return Local_u8Sense;
+}
+
+/*
+ * Function: EXTI_voidInit
+ * Description:
+ *     Applies the configured sense control of each line, then its enable state.
+ */
+void EXTI_voidInit(void)
+{
+	EXTI_voidSetSenseControl(EXTI_INT0, EXTI_INT0_SENSE);
+	EXTI_voidSetSenseControl(EXTI_INT1, EXTI_INT1_SENSE);
+	EXTI_voidSetSenseControl(EXTI_INT2, EXTI_INT2_SENSE);
+
+#if EXTI_INT0_INIT_STATE == EXTI_ENABLED
+	EXTI_voidEnable(EXTI_INT0);
+#else
+	EXTI_voidDisable(EXTI_INT0);
+#endif
+
+#if EXTI_INT1_INIT_STATE == EXTI_ENABLED
+	EXTI_voidEnable(EXTI_INT1);
+#else
+	EXTI_voidDisable(EXTI_INT1);
+#endif
+
+#if EXTI_INT2_INIT_STATE == EXTI_ENABLED
+	EXTI_voidEnable(EXTI_INT2);
+#else
+	EXTI_voidDisable(EXTI_INT2);
+#endif
+}
+
+/*
+ * Function: EXTI_voidSetSenseControl
+ * Description:
+ *     INT0/INT1 take the two ISC bits of MCUCR (shared with the sleep bits, so the
+ *     update is done with interrupts disabled). Changing ISC2 can raise INTF2, so INT2
+ *     is disabled around the change as the data sheet requires.
+ *     Any flag raised by the change is cleared.
+ */
+void EXTI_voidSetSenseControl(u8 Copy_u8Line, u8 Copy_u8Sense)
+{
+	u8 Local_u8Enabled;
+
+	if (Copy_u8Sense > EXTI_RISING_EDGE)
+	{
+		return;
+	}
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		switch (Copy_u8Line)
+		{
+		case EXTI_INT0:
+			MCUCR = (MCUCR & ~(EXTI_ISC_MASK << MCUCR_ISC00)) | (Copy_u8Sense << MCUCR_ISC00);
+			GIFR = (1 << GIFR_INTF0);       // Flag is cleared by writing one
+			break;
+
+		case EXTI_INT1:
+			MCUCR = (MCUCR & ~(EXTI_ISC_MASK << MCUCR_ISC10)) | (Copy_u8Sense << MCUCR_ISC10);
+			GIFR = (1 << GIFR_INTF1);
+			break;
+
+		case EXTI_INT2:
+			if (Copy_u8Sense < EXTI_FALLING_EDGE)
+			{
+				break;
+			}
+
+			Local_u8Enabled = GET_BIT(GICR, GICR_INT2);
+			CLR_BIT(GICR, GICR_INT2);
+
+			if (Copy_u8Sense == EXTI_RISING_EDGE)
+			{
+				SET_BIT(MCUCSR, MCUCSR_ISC2);
+			}
+			else
+			{
+				CLR_BIT(MCUCSR, MCUCSR_ISC2);
+			}
+
+			GIFR = (1 << GIFR_INTF2);
+
+			if (Local_u8Enabled)
+			{
+				SET_BIT(GICR, GICR_INT2);
+			}
+			break;
+
+		default:
+			break;
+		}
+	}
+}
+
+/*
+ * Function: EXTI_voidEnable
+ * Description:
+ *     Clears the pending flag of the line, then sets its enable bit.
+ */
+void EXTI_voidEnable(u8 Copy_u8Line)
+{
+	if (Copy_u8Line >= EXTI_LINES_NUM)
+	{
+		return;
+	}
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		GIFR = (1 << EXTI_Au8EnableBit[Copy_u8Line]);
+		SET_BIT(GICR, EXTI_Au8EnableBit[Copy_u8Line]);
+	}
+}
+
+/*
+ * Function: EXTI_voidDisable
+ * Description:
+ *     Clears the enable bit of the line.
+ */
+void EXTI_voidDisable(u8 Copy_u8Line)
+{
+	if (Copy_u8Line >= EXTI_LINES_NUM)
+	{
+		return;
+	}
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		CLR_BIT(GICR, EXTI_Au8EnableBit[Copy_u8Line]);
+	}
+}
+
+/*
+ * Function: EXTI_voidSetCallBack
+ * Description:
+ *     Stores the callback of the line with interrupts disabled, so a vector never calls
+ *     a half-written pointer.
+ */
+void EXTI_voidSetCallBack(u8 Copy_u8Line, void (*Copy_pvCallBack)(void))
+{
+	if (Copy_u8Line >= EXTI_LINES_NUM)
+	{
+		return;
+	}
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		EXTI_ApvCallBack[Copy_u8Line] = Copy_pvCallBack;
+	}
+}
+
+#if EXTI_LATENCY_MEASUREMENT == EXTI_ENABLED
+/*
+ * Function: EXTI_u16MeasureLatency
+ * Description:
+ *     The line is set to rising edge and its pin driven low as an output (an INTx pin
+ *     configured as output still triggers its interrupt). Timer1 runs at F_CPU; the
+ *     new PORTx value is computed beforehand so only one store separates the start
+ *     stamp from the edge. The vector stamps Timer1 before calling the callback.
+ *     Registers are written directly and restored to their previous values afterwards,
+ *     so DIO shadow copies stay valid. TCCR1A/TCCR1B are restored too, so a Timer1 time
+ *     base (BENCH, DIO trace, SW_PWM, DIO_CAPTURE) keeps its mode and prescaler; while the
+ *     measurement runs (at most EXTI_LATENCY_TIMEOUT polls) Timer1 counts at F_CPU in
+ *     normal mode. TCNT1 is only read.
+ */
+u16 EXTI_u16MeasureLatency(u8 Copy_u8Line)
+{
+	volatile u8* Local_pu8Port;
+	volatile u8* Local_pu8Ddr;
+	u8  Local_u8PinMask;
+	u8  Local_u8PortSaved;
+	u8  Local_u8DdrSaved;
+	u8  Local_u8PortEdge;
+	u8  Local_u8SenseSaved;
+	u8  Local_u8EnabledSaved;
+	u8  Local_u8Tccr1aSaved;
+	u8  Local_u8Tccr1bSaved;
+	u16 Local_u16Start;
+	u16 Local_u16Latency = 0;
+	u16 Local_u16Timeout;
+
+	if ((Copy_u8Line >= EXTI_LINES_NUM) || (EXTI_Au8Dispatch[Copy_u8Line] != EXTI_DISPATCH_CALLBACK))
+	{
+		return 0;
+	}
+
+	Local_pu8Port = &DIO_PORT_REG(EXTI_Au8Port[Copy_u8Line]);
+	Local_pu8Ddr = &DIO_DDR_REG(EXTI_Au8Port[Copy_u8Line]);
+	Local_u8PinMask = (u8)(1 << EXTI_Au8Pin[Copy_u8Line]);
+
+	Local_u8SenseSaved = EXTI_u8GetSenseControl(Copy_u8Line);
+	Local_u8EnabledSaved = GET_BIT(GICR, EXTI_Au8EnableBit[Copy_u8Line]);
+	Local_u8PortSaved = *Local_pu8Port;
+	Local_u8DdrSaved = *Local_pu8Ddr;
+	Local_u8Tccr1aSaved = TCCR1A;
+	Local_u8Tccr1bSaved = TCCR1B;
+
+	/* Pin low as output, rising edge, Timer1 free running at F_CPU */
+	EXTI_voidDisable(Copy_u8Line);
+	*Local_pu8Port &= (u8)~Local_u8PinMask;
+	*Local_pu8Ddr |= Local_u8PinMask;
+	EXTI_voidSetSenseControl(Copy_u8Line, EXTI_RISING_EDGE);
+	EXTI_voidEnable(Copy_u8Line);
+
+	TCCR1A = 0;
+	TCCR1B = 1;                     // CS12:0 = 001, no prescaling
+
+	EXTI_u8StampedLine = EXTI_LINES_NUM;
+	Local_u8PortEdge = *Local_pu8Port | Local_u8PinMask;
+
+	Local_u16Start = TCNT1;
+	*Local_pu8Port = Local_u8PortEdge;
+
+	for (Local_u16Timeout = 0; Local_u16Timeout < EXTI_LATENCY_TIMEOUT; Local_u16Timeout++)
+	{
+		if (EXTI_u8StampedLine == Copy_u8Line)
+		{
+			Local_u16Latency = EXTI_u16EntryStamp - Local_u16Start;
+			break;
+		}
+	}
+
+	/* Restore: Timer1 mode and clock as found (TCCR1A first, TCCR1B restarts the clock) */
+	TCCR1A = Local_u8Tccr1aSaved;
+	TCCR1B = Local_u8Tccr1bSaved;
+	EXTI_voidDisable(Copy_u8Line);
+	*Local_pu8Port = Local_u8PortSaved;
+	*Local_pu8Ddr = Local_u8DdrSaved;
+	EXTI_voidSetSenseControl(Copy_u8Line, Local_u8SenseSaved);
+
+	if (Local_u8EnabledSaved)
+	{
+		EXTI_voidEnable(Copy_u8Line);
+	}
+
+	return Local_u16Latency;
+}
+#endif
+
+/* INT0 Vector */
+#if EXTI_INT0_DISPATCH == EXTI_DISPATCH_NAKED
+ISR(INT0_vect, ISR_NAKED)
+{
+	EXTI_INT0_NAKED_BODY();
+	reti();
+}
+#else
+ISR(INT0_vect)
+{
+	EXTI_STAMP_ENTRY(EXTI_INT0);
+
+	if (EXTI_ApvCallBack[EXTI_INT0] != NULL)
+	{
+		EXTI_ApvCallBack[EXTI_INT0]();
+	}
+}
+#endif
+
+/* INT1 Vector */
+#if EXTI_INT1_DISPATCH == EXTI_DISPATCH_NAKED
+ISR(INT1_vect, ISR_NAKED)
+{
+	EXTI_INT1_NAKED_BODY();
+	reti();
+}
+#else
+ISR(INT1_vect)
+{
+	EXTI_STAMP_ENTRY(EXTI_INT1);
+
+	if (EXTI_ApvCallBack[EXTI_INT1] != NULL)
+	{
+		EXTI_ApvCallBack[EXTI_INT1]();
+	}
+}
+#endif
+
+/* INT2 Vector */
+#if EXTI_INT2_DISPATCH == EXTI_DISPATCH_NAKED
+ISR(INT2_vect, ISR_NAKED)
+{
+	EXTI_INT2_NAKED_BODY();
+	reti();
+}
+#else
+ISR(INT2_vect)
+{
+	EXTI_STAMP_ENTRY(EXTI_INT2);
+
+	if (EXTI_ApvCallBack[EXTI_INT2] != NULL)
+	{
+		EXTI_ApvCallBack[EXTI_INT2]();
+	}
+}
+#endif
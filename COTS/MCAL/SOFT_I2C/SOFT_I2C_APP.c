@@ -0,0 +1,65 @@
+/*
+ * File: SOFT_I2C_APP.c
+ *
+ * Description:
+ *     Test file for the SOFT_I2C module on an AVR ATmega32 engineering kit with a 24C02
+ *     EEPROM (address 0x50) on the SOFT_I2C pins (SOFT_I2C_config.h).
+ *     Four bytes are written at EEPROM address 0x10 and read back with a write-read
+ *     (repeated START); the status and the bytes read are shown on the LCD.
+ *     HOST/HOST_APP.c runs the driver against a simulated slave on the host.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <util/delay.h>
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../../MCAL/DIO/DIO_interface.h"
+#include "./SOFT_I2C_interface.h"
+
+/* HAL */
+#include "../../HAL/LCD_4x20/LCD_interface.h"
+
+#define SOFT_I2C_APP_EEPROM      0x50
+
+int main(void)
+{
+	static const u8 Local_Au8Write[5] = {0x10, 'A', 'V', 'R', '!'};   /* Word address, data */
+	static const u8 Local_u8WordAddress = 0x10;
+	u8 Local_Au8Read[4];
+	u8 Local_u8Status;
+	u8 Local_u8Index;
+
+	LCD_voidInit();
+	SOFT_I2C_voidInit();
+
+	Local_u8Status = SOFT_I2C_u8Write(SOFT_I2C_APP_EEPROM, Local_Au8Write, sizeof(Local_Au8Write));
+	LCD_voidWriteString((u8*)"Write status: ");
+	LCD_voidWriteNumber(Local_u8Status);
+
+	/* EEPROM write cycle */
+	_delay_ms(5);
+
+	Local_u8Status = SOFT_I2C_u8WriteRead(SOFT_I2C_APP_EEPROM, &Local_u8WordAddress, 1, Local_Au8Read, sizeof(Local_Au8Read));
+	LCD_voidGoTo(LCD_LINE_TWO, 0);
+	LCD_voidWriteString((u8*)"Read status: ");
+	LCD_voidWriteNumber(Local_u8Status);
+
+	LCD_voidGoTo(LCD_LINE_THREE, 0);
+	for(Local_u8Index = 0; Local_u8Index < sizeof(Local_Au8Read); Local_u8Index++)
+	{
+		LCD_voidSendChar(Local_Au8Read[Local_u8Index]);
+	}
+
+	while(1)
+	{
+	}
+
+	return 0;
+}
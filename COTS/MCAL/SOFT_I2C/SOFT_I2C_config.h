@@ -0,0 +1,41 @@
+/*
+ * File: SOFT_I2C_config.h
+ *
+ * Description:
+ *     Configuration header file for the software I2C master module for AVR ATmega32.
+ *
+ * Usage:
+ *     - SOFT_I2C_SDA_PORT / _PIN, SOFT_I2C_SCL_PORT / _PIN: Bus pins (DIO_PORTx, DIO_PINx).
+ *       With DIO_PIN_MAP_GENERATED (DIO_config.h) the build fails unless they match the
+ *       SOFT_I2C lines of the board pin map (PINMAP/pinmap.txt).
+ *     - SOFT_I2C_BUS_SPEED_HZ: SCL frequency. The half-period delay is derived from F_CPU
+ *       at compile time after subtracting the cycles of the bit code; the build fails if
+ *       the speed is too high for F_CPU (about F_CPU / 20 at most).
+ *     - SOFT_I2C_STRETCH_TIMEOUT_US: Longest clock stretching accepted from a slave.
+ *     - SOFT_I2C_INTERNAL_PULL_UP: SOFT_I2C_ENABLED also turns the AVR pull-ups on while a
+ *       line is released. They are weak (20-50 kOhm): fine for a short bus at 100 kHz,
+ *       external 4.7 kOhm resistors are still needed for longer buses or 400 kHz.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef SOFT_I2C_CONFIG_H_
+#define SOFT_I2C_CONFIG_H_
+
+/* Bus pins */
+#define SOFT_I2C_SDA_PORT             DIO_PORTC
+#define SOFT_I2C_SDA_PIN              DIO_PIN6
+#define SOFT_I2C_SCL_PORT             DIO_PORTC
+#define SOFT_I2C_SCL_PIN              DIO_PIN7
+
+/* SCL frequency */
+#define SOFT_I2C_BUS_SPEED_HZ         100000UL
+
+/* Clock stretching limit */
+#define SOFT_I2C_STRETCH_TIMEOUT_US   1000UL
+
+/* Internal pull-ups on released lines */
+#define SOFT_I2C_INTERNAL_PULL_UP     SOFT_I2C_ENABLED
+
+#endif /* SOFT_I2C_CONFIG_H_ */
@@ -0,0 +1,89 @@
+/*
+ * File: SOFT_I2C_interface.h
+ *
+ * Description:
+ *     Header file for the software I2C master module for AVR ATmega32.
+ *     SDA and SCL are any two DIO pins (SOFT_I2C_config.h) driven open-drain: a line is
+ *     pulled low by making it an output at 0 and released by making it an input, so the
+ *     bus pull-ups (or the internal ones) bring it high. The master waits for a slave
+ *     that stretches SCL, detects a lost arbitration, and supports repeated START.
+ *
+ *     The bulk functions (SOFT_I2C_u8Write, _u8Read, _u8WriteRead) run a whole transfer
+ *     with the byte and bit loops inlined into them; the single-step functions build any
+ *     other sequence. All of them busy-wait and may be interrupted (interrupts only
+ *     lengthen the clock phases, which I2C allows).
+ *
+ *     The slave address is the 7-bit address (e.g. 0x50), without the R/W bit.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef SOFT_I2C_INTERFACE_H_
+#define SOFT_I2C_INTERFACE_H_
+
+/* Status */
+#define SOFT_I2C_OK                  0
+#define SOFT_I2C_NACK                1   /* Address or data byte not acknowledged */
+#define SOFT_I2C_TIMEOUT             2   /* SCL held low longer than SOFT_I2C_STRETCH_TIMEOUT_US */
+#define SOFT_I2C_ARBITRATION_LOST    3   /* Another master drove SDA low */
+#define SOFT_I2C_INVALID             4   /* Invalid argument */
+
+/* Transfer Direction */
+#define SOFT_I2C_WRITE               0
+#define SOFT_I2C_READ                1
+
+/* Function: SOFT_I2C_voidInit
+ * Description:
+ *     Releases SDA and SCL (idle bus).
+ */
+void SOFT_I2C_voidInit(void);
+
+/* Function: SOFT_I2C_u8Start
+ * Description:
+ *     Sends a START (a repeated START if the bus is already held since the last START)
+ *     followed by the address byte. Returns SOFT_I2C_OK when the slave acknowledged.
+ *     On any other status call SOFT_I2C_voidStop (it does nothing if the bus was lost).
+ */
+u8 SOFT_I2C_u8Start(u8 Copy_u8Address, u8 Copy_u8Direction);
+
+/* Function: SOFT_I2C_u8WriteByte
+ * Description:
+ *     Sends one byte and returns SOFT_I2C_OK when it was acknowledged.
+ */
+u8 SOFT_I2C_u8WriteByte(u8 Copy_u8Data);
+
+/* Function: SOFT_I2C_u8ReadByte
+ * Description:
+ *     Receives one byte; Copy_u8Last != 0 answers NACK, which ends a read.
+ */
+u8 SOFT_I2C_u8ReadByte(u8* Copy_pu8Data, u8 Copy_u8Last);
+
+/* Function: SOFT_I2C_voidStop
+ * Description:
+ *     Sends a STOP and releases the bus.
+ */
+void SOFT_I2C_voidStop(void);
+
+/* Function: SOFT_I2C_u8Write
+ * Description:
+ *     START, address (write), Copy_u16Length bytes, STOP.
+ */
+u8 SOFT_I2C_u8Write(u8 Copy_u8Address, const u8* Copy_pu8Data, u16 Copy_u16Length);
+
+/* Function: SOFT_I2C_u8Read
+ * Description:
+ *     START, address (read), Copy_u16Length bytes (the last one NACKed), STOP.
+ */
+u8 SOFT_I2C_u8Read(u8 Copy_u8Address, u8* Copy_pu8Data, u16 Copy_u16Length);
+
+/* Function: SOFT_I2C_u8WriteRead
+ * Description:
+ *     START, address (write), Copy_u16TxLength bytes, repeated START, address (read),
+ *     Copy_u16RxLength bytes, STOP. Typical register read: one register address out,
+ *     the register contents back.
+ */
+u8 SOFT_I2C_u8WriteRead(u8 Copy_u8Address, const u8* Copy_pu8TxData, u16 Copy_u16TxLength,
+                        u8* Copy_pu8RxData, u16 Copy_u16RxLength);
+
+#endif /* SOFT_I2C_INTERFACE_H_ */
@@ -0,0 +1,72 @@
+/*
+ * File: SOFT_I2C_private.h
+ *
+ * Description:
+ *     Private header file for the software I2C master module for AVR ATmega32.
+ *     It defines the line operations and the timing derived from the configuration.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef SOFT_I2C_PRIVATE_H_
+#define SOFT_I2C_PRIVATE_H_
+
+/* Options */
+#define SOFT_I2C_DISABLED                0
+#define SOFT_I2C_ENABLED                 1
+
+/* Cycles of bit code per half SCL period, besides the delay (-Os) */
+#define SOFT_I2C_HALF_PERIOD_OVERHEAD    10
+
+/* Cycles of one clock stretching poll */
+#define SOFT_I2C_STRETCH_POLL_CYCLES     6
+
+/* Half SCL period delay in microseconds */
+#define SOFT_I2C_HALF_PERIOD_US          ((500000.0 / SOFT_I2C_BUS_SPEED_HZ) - \
+                                          (SOFT_I2C_HALF_PERIOD_OVERHEAD * 1000000.0 / F_CPU))
+
+/* Clock stretching polls before SOFT_I2C_TIMEOUT */
+#define SOFT_I2C_STRETCH_POLLS           ((F_CPU / 1000000UL) * SOFT_I2C_STRETCH_TIMEOUT_US / SOFT_I2C_STRETCH_POLL_CYCLES)
+
+/*
+ * Line operations (constant pins: SBI/CBI/SBIS). A line is released by making it an input
+ * before turning its pull-up on, and pulled low by turning the pull-up off before making it
+ * an output, so it is never driven high.
+ */
+#if SOFT_I2C_INTERNAL_PULL_UP == SOFT_I2C_ENABLED
+#define SOFT_I2C_RELEASE(Port, Pin)                                \
+	do                                                             \
+	{                                                              \
+		DIO_SET_PIN_DIRECTION((Port), (Pin), DIO_PIN_INPUT);       \
+		DIO_SET_PIN_VALUE((Port), (Pin), DIO_PIN_HIGH);            \
+	} while(0)
+#define SOFT_I2C_PULL_LOW(Port, Pin)                               \
+	do                                                             \
+	{                                                              \
+		DIO_SET_PIN_VALUE((Port), (Pin), DIO_PIN_LOW);             \
+		DIO_SET_PIN_DIRECTION((Port), (Pin), DIO_PIN_OUTPUT);      \
+	} while(0)
+#else
+#define SOFT_I2C_RELEASE(Port, Pin)    DIO_SET_PIN_DIRECTION((Port), (Pin), DIO_PIN_INPUT)
+#define SOFT_I2C_PULL_LOW(Port, Pin)   DIO_SET_PIN_DIRECTION((Port), (Pin), DIO_PIN_OUTPUT)
+#endif
+
+#define SOFT_I2C_SDA_RELEASE()   SOFT_I2C_RELEASE(SOFT_I2C_SDA_PORT, SOFT_I2C_SDA_PIN)
+#define SOFT_I2C_SDA_LOW()       SOFT_I2C_PULL_LOW(SOFT_I2C_SDA_PORT, SOFT_I2C_SDA_PIN)
+#define SOFT_I2C_SCL_RELEASE()   SOFT_I2C_RELEASE(SOFT_I2C_SCL_PORT, SOFT_I2C_SCL_PIN)
+#define SOFT_I2C_SCL_LOW()       SOFT_I2C_PULL_LOW(SOFT_I2C_SCL_PORT, SOFT_I2C_SCL_PIN)
+#define SOFT_I2C_SDA_READ()      DIO_GET_PIN_VALUE(SOFT_I2C_SDA_PORT, SOFT_I2C_SDA_PIN)
+#define SOFT_I2C_SCL_READ()      DIO_GET_PIN_VALUE(SOFT_I2C_SCL_PORT, SOFT_I2C_SCL_PIN)
+
+/* Half SCL period (no delay when the bit code alone is long enough) */
+#define SOFT_I2C_DELAY_HALF()                                      \
+	do                                                             \
+	{                                                              \
+		if(SOFT_I2C_HALF_PERIOD_US > 0)                            \
+		{                                                          \
+			_delay_us(SOFT_I2C_HALF_PERIOD_US);                    \
+		}                                                          \
+	} while(0)
+
+#endif /* SOFT_I2C_PRIVATE_H_ */
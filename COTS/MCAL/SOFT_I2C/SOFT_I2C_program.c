@@ -0,0 +1,399 @@
+/*
+ * File: SOFT_I2C_program.c
+ *
+ * Description:
+ *     Implementation of the software I2C master module for AVR ATmega32.
+ *     Each bit is: set SDA while SCL is low, half period, release SCL and wait until
+ *     it is really high (clock stretching), half period, pull SCL low. The bit and byte
+ *     code are always-inline functions, so the bulk transfers contain the whole loop
+ *     and pay no call per bit.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <util/delay.h>
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../DIO/DIO_interface.h"
+#include "../DIO/DIO_private.h"
+#include "../DIO/DIO_config.h"
+#include "../SOFT_I2C/SOFT_I2C_interface.h"
+#include "../SOFT_I2C/SOFT_I2C_config.h"
+#include "../SOFT_I2C/SOFT_I2C_private.h"
+
+#if (F_CPU / (2 * SOFT_I2C_BUS_SPEED_HZ)) < SOFT_I2C_HALF_PERIOD_OVERHEAD
+#error "SOFT_I2C_BUS_SPEED_HZ is too high for F_CPU"
+#endif
+
+#if DIO_SHADOW_MODE == DIO_SHADOW_DEFERRED
+#error "SOFT_I2C needs its SDA/SCL edges on the pins at once: DIO_SHADOW_DEFERRED is not supported"
+#endif
+
+/* With the generated pin map, the lines of SOFT_I2C_config.h must be the ones of PINMAP/pinmap.txt */
+#if (DIO_PIN_MAP == DIO_PIN_MAP_GENERATED) && \
+    ((DIO_PIN_ID(SOFT_I2C_SDA_PORT, SOFT_I2C_SDA_PIN) != PINMAP_SOFT_I2C_SDA_ID) || \
+     (DIO_PIN_ID(SOFT_I2C_SCL_PORT, SOFT_I2C_SCL_PIN) != PINMAP_SOFT_I2C_SCL_ID))
+#error "SOFT_I2C: SDA/SCL do not match the pin map"
+#endif
+
+#define SOFT_I2C_INLINE   static inline __attribute__((always_inline))
+
+/* The bus is held (a START was sent without a STOP): the next start is a repeated START */
+static u8 SOFT_I2C_u8BusHeld = 0;
+
+/*
+ * Function: SOFT_I2C_u8SclHigh
+ * Description:
+ *     Releases SCL and waits while a slave holds it low.
+ */
+SOFT_I2C_INLINE u8 SOFT_I2C_u8SclHigh(void)
+{
+	u32 Local_u32Polls = 0;
+
+	SOFT_I2C_SCL_RELEASE();
+
+	while(SOFT_I2C_SCL_READ() == DIO_PIN_LOW)
+	{
+		if(++Local_u32Polls > SOFT_I2C_STRETCH_POLLS)
+		{
+			return SOFT_I2C_TIMEOUT;
+		}
+	}
+
+	return SOFT_I2C_OK;
+}
+
+/*
+ * Function: SOFT_I2C_u8ClockOutByte
+ * Description:
+ *     Sends 8 bits MSB first, then clocks in the acknowledge. A 1 read back as 0 while
+ *     SCL is high means another master is driving SDA: arbitration is lost, and the
+ *     master withdraws with both lines released.
+ */
+SOFT_I2C_INLINE u8 SOFT_I2C_u8ClockOutByte(u8 Copy_u8Data)
+{
+	u8 Local_u8Bit;
+	u8 Local_u8Status;
+
+	for(Local_u8Bit = 0; Local_u8Bit < 8; Local_u8Bit++)
+	{
+		if(GET_BIT(Copy_u8Data, 7))
+		{
+			SOFT_I2C_SDA_RELEASE();
+		}
+		else
+		{
+			SOFT_I2C_SDA_LOW();
+		}
+		SOFT_I2C_DELAY_HALF();
+
+		Local_u8Status = SOFT_I2C_u8SclHigh();
+		if(Local_u8Status != SOFT_I2C_OK)
+		{
+			return Local_u8Status;
+		}
+
+		if(GET_BIT(Copy_u8Data, 7) && (SOFT_I2C_SDA_READ() == DIO_PIN_LOW))
+		{
+			SOFT_I2C_u8BusHeld = 0;     // Both lines are released: the bus is left to the winner
+			return SOFT_I2C_ARBITRATION_LOST;
+		}
+
+		SOFT_I2C_DELAY_HALF();
+		SOFT_I2C_SCL_LOW();
+		Copy_u8Data <<= 1;
+	}
+
+	/* Acknowledge: slave pulls SDA low */
+	SOFT_I2C_SDA_RELEASE();
+	SOFT_I2C_DELAY_HALF();
+
+	Local_u8Status = SOFT_I2C_u8SclHigh();
+	if(Local_u8Status != SOFT_I2C_OK)
+	{
+		return Local_u8Status;
+	}
+
+	if(SOFT_I2C_SDA_READ() != DIO_PIN_LOW)
+	{
+		Local_u8Status = SOFT_I2C_NACK;
+	}
+
+	SOFT_I2C_DELAY_HALF();
+	SOFT_I2C_SCL_LOW();
+
+	return Local_u8Status;
+}
+
+/*
+ * Function: SOFT_I2C_u8ClockInByte
+ * Description:
+ *     Receives 8 bits MSB first with SDA released, then drives the acknowledge
+ *     (low = ACK, released = NACK for the last byte).
+ */
+SOFT_I2C_INLINE u8 SOFT_I2C_u8ClockInByte(u8* Copy_pu8Data, u8 Copy_u8Last)
+{
+	u8 Local_u8Bit;
+	u8 Local_u8Data = 0;
+	u8 Local_u8Status;
+
+	SOFT_I2C_SDA_RELEASE();
+
+	for(Local_u8Bit = 0; Local_u8Bit < 8; Local_u8Bit++)
+	{
+		SOFT_I2C_DELAY_HALF();
+
+		Local_u8Status = SOFT_I2C_u8SclHigh();
+		if(Local_u8Status != SOFT_I2C_OK)
+		{
+			return Local_u8Status;
+		}
+
+		Local_u8Data = (u8)(Local_u8Data << 1) | SOFT_I2C_SDA_READ();
+
+		SOFT_I2C_DELAY_HALF();
+		SOFT_I2C_SCL_LOW();
+	}
+
+	*Copy_pu8Data = Local_u8Data;
+
+	if(Copy_u8Last)
+	{
+		SOFT_I2C_SDA_RELEASE();
+	}
+	else
+	{
+		SOFT_I2C_SDA_LOW();
+	}
+	SOFT_I2C_DELAY_HALF();
+
+	Local_u8Status = SOFT_I2C_u8SclHigh();
+	if(Local_u8Status != SOFT_I2C_OK)
+	{
+		return Local_u8Status;
+	}
+
+	SOFT_I2C_DELAY_HALF();
+	SOFT_I2C_SCL_LOW();
+	SOFT_I2C_SDA_RELEASE();
+
+	return SOFT_I2C_OK;
+}
+
+/*
+ * Function: SOFT_I2C_u8SendStart
+ * Description:
+ *     A repeated START first returns SDA and then SCL high (SCL is low while the bus is
+ *     held). START is SDA falling while SCL is high; SCL is then pulled low and the
+ *     address byte follows.
+ */
+SOFT_I2C_INLINE u8 SOFT_I2C_u8SendStart(u8 Copy_u8Address, u8 Copy_u8Direction)
+{
+	u8 Local_u8Status;
+
+	if(SOFT_I2C_u8BusHeld)
+	{
+		SOFT_I2C_SDA_RELEASE();
+		SOFT_I2C_DELAY_HALF();
+
+		Local_u8Status = SOFT_I2C_u8SclHigh();
+		if(Local_u8Status != SOFT_I2C_OK)
+		{
+			return Local_u8Status;
+		}
+		SOFT_I2C_DELAY_HALF();
+	}
+	else if((SOFT_I2C_SDA_READ() == DIO_PIN_LOW) || (SOFT_I2C_SCL_READ() == DIO_PIN_LOW))
+	{
+		return SOFT_I2C_ARBITRATION_LOST;   // Bus busy
+	}
+
+	SOFT_I2C_SDA_LOW();
+	SOFT_I2C_u8BusHeld = 1;
+	SOFT_I2C_DELAY_HALF();
+	SOFT_I2C_SCL_LOW();
+
+	return SOFT_I2C_u8ClockOutByte((u8)(Copy_u8Address << 1) | (Copy_u8Direction & 1));
+}
+
+/*
+ * Function: SOFT_I2C_voidInit
+ * Description:
+ *     Releases both lines; with the internal pull-ups enabled they are turned on.
+ *     Without them, pulling a line low only sets its DDR bit, so both PORT bits are
+ *     cleared here (after the lines are inputs): a PORT bit left at 1 by earlier code
+ *     would otherwise drive the line high.
+ */
+void SOFT_I2C_voidInit(void)
+{
+	SOFT_I2C_SCL_RELEASE();
+	SOFT_I2C_SDA_RELEASE();
+#if SOFT_I2C_INTERNAL_PULL_UP != SOFT_I2C_ENABLED
+	DIO_SET_PIN_VALUE(SOFT_I2C_SCL_PORT, SOFT_I2C_SCL_PIN, DIO_PIN_LOW);
+	DIO_SET_PIN_VALUE(SOFT_I2C_SDA_PORT, SOFT_I2C_SDA_PIN, DIO_PIN_LOW);
+#endif
+	SOFT_I2C_u8BusHeld = 0;
+}
+
+/*
+ * Function: SOFT_I2C_u8Start
+ * Description:
+ *     START or repeated START, then the address byte.
+ */
+u8 SOFT_I2C_u8Start(u8 Copy_u8Address, u8 Copy_u8Direction)
+{
+	if((Copy_u8Address > 0x7F) || (Copy_u8Direction > SOFT_I2C_READ))
+	{
+		return SOFT_I2C_INVALID;
+	}
+
+	return SOFT_I2C_u8SendStart(Copy_u8Address, Copy_u8Direction);
+}
+
+/*
+ * Function: SOFT_I2C_u8WriteByte
+ * Description:
+ *     One data byte and its acknowledge.
+ */
+u8 SOFT_I2C_u8WriteByte(u8 Copy_u8Data)
+{
+	return SOFT_I2C_u8ClockOutByte(Copy_u8Data);
+}
+
+/*
+ * Function: SOFT_I2C_u8ReadByte
+ * Description:
+ *     One data byte, answered with ACK or (last byte) NACK.
+ */
+u8 SOFT_I2C_u8ReadByte(u8* Copy_pu8Data, u8 Copy_u8Last)
+{
+	if(Copy_pu8Data == NULL)
+	{
+		return SOFT_I2C_INVALID;
+	}
+
+	return SOFT_I2C_u8ClockInByte(Copy_pu8Data, Copy_u8Last);
+}
+
+/*
+ * Function: SOFT_I2C_voidStop
+ * Description:
+ *     SDA low, SCL high (waiting for a stretching slave, up to the timeout), then SDA
+ *     rising while SCL is high. Both lines end released. Nothing is sent when the bus
+ *     is not held (no START, or arbitration lost).
+ */
+void SOFT_I2C_voidStop(void)
+{
+	if(!SOFT_I2C_u8BusHeld)
+	{
+		return;
+	}
+
+	SOFT_I2C_SDA_LOW();
+	SOFT_I2C_DELAY_HALF();
+	(void)SOFT_I2C_u8SclHigh();
+	SOFT_I2C_DELAY_HALF();
+	SOFT_I2C_SDA_RELEASE();
+	SOFT_I2C_DELAY_HALF();
+
+	SOFT_I2C_u8BusHeld = 0;
+}
+
+/*
+ * Function: SOFT_I2C_u8Write
+ * Description:
+ *     Whole write transfer; stops at the first byte that is not acknowledged.
+ */
+u8 SOFT_I2C_u8Write(u8 Copy_u8Address, const u8* Copy_pu8Data, u16 Copy_u16Length)
+{
+	u8 Local_u8Status;
+	u16 Local_u16Index;
+
+	if((Copy_u8Address > 0x7F) || ((Copy_pu8Data == NULL) && (Copy_u16Length != 0)))
+	{
+		return SOFT_I2C_INVALID;
+	}
+
+	Local_u8Status = SOFT_I2C_u8SendStart(Copy_u8Address, SOFT_I2C_WRITE);
+
+	for(Local_u16Index = 0; (Local_u16Index < Copy_u16Length) && (Local_u8Status == SOFT_I2C_OK); Local_u16Index++)
+	{
+		Local_u8Status = SOFT_I2C_u8ClockOutByte(Copy_pu8Data[Local_u16Index]);
+	}
+
+	SOFT_I2C_voidStop();
+
+	return Local_u8Status;
+}
+
+/*
+ * Function: SOFT_I2C_u8Read
+ * Description:
+ *     Whole read transfer; the last byte is answered with NACK.
+ */
+u8 SOFT_I2C_u8Read(u8 Copy_u8Address, u8* Copy_pu8Data, u16 Copy_u16Length)
+{
+	u8 Local_u8Status;
+	u16 Local_u16Index;
+
+	if((Copy_u8Address > 0x7F) || (Copy_pu8Data == NULL) || (Copy_u16Length == 0))
+	{
+		return SOFT_I2C_INVALID;
+	}
+
+	Local_u8Status = SOFT_I2C_u8SendStart(Copy_u8Address, SOFT_I2C_READ);
+
+	for(Local_u16Index = 0; (Local_u16Index < Copy_u16Length) && (Local_u8Status == SOFT_I2C_OK); Local_u16Index++)
+	{
+		Local_u8Status = SOFT_I2C_u8ClockInByte(&Copy_pu8Data[Local_u16Index], Local_u16Index == (Copy_u16Length - 1));
+	}
+
+	SOFT_I2C_voidStop();
+
+	return Local_u8Status;
+}
+
+/*
+ * Function: SOFT_I2C_u8WriteRead
+ * Description:
+ *     Write phase, repeated START, read phase, one STOP at the end.
+ */
+u8 SOFT_I2C_u8WriteRead(u8 Copy_u8Address, const u8* Copy_pu8TxData, u16 Copy_u16TxLength,
+                        u8* Copy_pu8RxData, u16 Copy_u16RxLength)
+{
+	u8 Local_u8Status;
+	u16 Local_u16Index;
+
+	if((Copy_u8Address > 0x7F) || ((Copy_pu8TxData == NULL) && (Copy_u16TxLength != 0)) ||
+	   (Copy_pu8RxData == NULL) || (Copy_u16RxLength == 0))
+	{
+		return SOFT_I2C_INVALID;
+	}
+
+	Local_u8Status = SOFT_I2C_u8SendStart(Copy_u8Address, SOFT_I2C_WRITE);
+
+	for(Local_u16Index = 0; (Local_u16Index < Copy_u16TxLength) && (Local_u8Status == SOFT_I2C_OK); Local_u16Index++)
+	{
+		Local_u8Status = SOFT_I2C_u8ClockOutByte(Copy_pu8TxData[Local_u16Index]);
+	}
+
+	if(Local_u8Status == SOFT_I2C_OK)
+	{
+		Local_u8Status = SOFT_I2C_u8SendStart(Copy_u8Address, SOFT_I2C_READ);
+	}
+
+	for(Local_u16Index = 0; (Local_u16Index < Copy_u16RxLength) && (Local_u8Status == SOFT_I2C_OK); Local_u16Index++)
+	{
+		Local_u8Status = SOFT_I2C_u8ClockInByte(&Copy_pu8RxData[Local_u16Index], Local_u16Index == (Copy_u16RxLength - 1));
+	}
+
+	SOFT_I2C_voidStop();
+
+	return Local_u8Status;
+}
@@ -0,0 +1,58 @@
+/*
+ * File: TIMER_APP.c
+ *
+ * Description:
+ *     Test file for the TIMER module on an AVR ATmega32 engineering kit.
+ *     The 1 ms Timer0 tick counts milliseconds in the callback; the main loop
+ *     toggles the green LED (PA4) every 500 ms.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../DIO/DIO_interface.h"
+#include "../TIMER/TIMER_interface.h"
+
+static volatile u16 APP_u16Milliseconds = 0;
+
+static void APP_voidTick(void)
+{
+	APP_u16Milliseconds++;
+}
+
+int main(void)
+{
+	u16 Local_u16Now;
+	u16 Local_u16LastToggle = 0;
+
+	DIO_setPinDirection(DIO_PORTA, DIO_PIN4, DIO_PIN_OUTPUT);
+
+	TIMER0_voidSetCallBack(APP_voidTick);
+	TIMER0_voidInitTick();
+	sei();
+
+	while(1)
+	{
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			Local_u16Now = APP_u16Milliseconds;
+		}
+
+		if((u16)(Local_u16Now - Local_u16LastToggle) >= 500)
+		{
+			Local_u16LastToggle += 500;
+			DIO_togglePinValue(DIO_PORTA, DIO_PIN4);
+		}
+	}
+
+	return 0;
+}
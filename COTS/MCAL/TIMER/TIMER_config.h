@@ -0,0 +1,29 @@
+/*
+ * File: TIMER_config.h
+ *
+ * Description:
+ *     Configuration header file for the TIMER module for AVR ATmega32.
+ *     Timer0 runs in CTC mode as the periodic system tick that drives the
+ *     timer-based services (debouncing, keypad scanning, display refresh, ...).
+ *
+ * Usage:
+ *     - TIMER0_PRESCALER: Timer0 clock source, one of TIMER_PRESCALER_1, _8, _64,
+ *       _256 or _1024 (defined in TIMER_private.h).
+ *     - TIMER0_TICK_PERIOD_US: Tick period in microseconds. The compare value is
+ *       derived from F_CPU and the prescaler at compile time; the build fails if the
+ *       period does not fit in the 8-bit counter with the selected prescaler.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef TIMER_CONFIG_H_
+#define TIMER_CONFIG_H_
+
+/* Timer0 clock: F_CPU / 64 (8 us per count at 8 MHz) */
+#define TIMER0_PRESCALER          TIMER_PRESCALER_64
+
+/* Timer0 tick period: 1 ms */
+#define TIMER0_TICK_PERIOD_US     1000UL
+
+#endif /* TIMER_CONFIG_H_ */
@@ -0,0 +1,37 @@
+/*
+ * File: TIMER_interface.h
+ *
+ * Description:
+ *     Header file for the TIMER module for AVR ATmega32.
+ *     Timer0 provides the periodic tick (CTC mode, compare match interrupt) that the
+ *     application forwards to the timer-driven modules through a callback.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef TIMER_INTERFACE_H_
+#define TIMER_INTERFACE_H_
+
+/* Function: TIMER0_voidInitTick
+ * Description:
+ *     Configures Timer0 in CTC mode with the period selected in TIMER_config.h,
+ *     enables the compare match interrupt and starts the timer.
+ *     Global interrupts must be enabled by the application (sei()).
+ */
+void TIMER0_voidInitTick(void);
+
+/* Function: TIMER0_voidSetCallBack
+ * Description:
+ *     Registers the function called from the Timer0 compare match interrupt on every tick.
+ *     The callback runs in interrupt context and must be short. NULL disables it.
+ */
+void TIMER0_voidSetCallBack(void (*Copy_pvCallBack)(void));
+
+/* Function: TIMER0_voidStop
+ * Description:
+ *     Stops Timer0 by removing its clock source. TIMER0_voidInitTick restarts it.
+ */
+void TIMER0_voidStop(void);
+
+#endif /* TIMER_INTERFACE_H_ */
@@ -0,0 +1,50 @@
+/*
+ * File: TIMER_private.h
+ *
+ * Description:
+ *     Private header file for the TIMER module for AVR ATmega32.
+ *     It defines the Timer0 register addresses, the bit positions used by the driver
+ *     and the prescaler selections available to TIMER_config.h.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+#ifndef TIMER_PRIVATE_H_
+#define TIMER_PRIVATE_H_
+
+/* Timer0 Registers */
+#define TCCR0          HW_REG8(0x53)
+#define TCNT0          HW_REG8(0x52)
+#define OCR0           HW_REG8(0x5C)
+
+/* Timer Interrupt Registers (shared by all timers) */
+#define TIMSK          HW_REG8(0x59)
+#define TIFR           HW_REG8(0x58)
+
+/* TCCR0 Bits */
+#define TCCR0_WGM00    6
+#define TCCR0_WGM01    3
+
+/* TIMSK / TIFR Bits */
+#define TIMSK_OCIE0    1
+#define TIFR_OCF0      1
+
+/* Timer0 Clock Select values (CS02:0) */
+#define TIMER_PRESCALER_1       1
+#define TIMER_PRESCALER_8       2
+#define TIMER_PRESCALER_64      3
+#define TIMER_PRESCALER_256     4
+#define TIMER_PRESCALER_1024    5
+
+/* Clock Select bits of TCCR0 */
+#define TIMER0_CLOCK_SELECT_MASK  0x07
+
+/* Division factor of each Clock Select value */
+#define TIMER_PRESCALER_DIVISION(Prescaler) \
+        ((Prescaler) == TIMER_PRESCALER_1    ? 1UL   : \
+         (Prescaler) == TIMER_PRESCALER_8    ? 8UL   : \
+         (Prescaler) == TIMER_PRESCALER_64   ? 64UL  : \
+         (Prescaler) == TIMER_PRESCALER_256  ? 256UL : 1024UL)
+
+#endif /* TIMER_PRIVATE_H_ */
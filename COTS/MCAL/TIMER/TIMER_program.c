@@ -0,0 +1,85 @@
+/*
+ * File: TIMER_program.c
+ *
+ * Description:
+ *     Implementation of the TIMER module for AVR ATmega32.
+ *     Timer0 is configured in CTC mode so the compare match interrupt fires once per
+ *     tick period without reloading the counter in software.
+ *
+ * Author:
+ * Date: [Specify Date Here]
+ */
+
+/* AVR LIB */
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+/* UTILS_LIB */
+#include "../../UTIL_LIB/STD_TYPES.h"
+#include "../../UTIL_LIB/BIT_MATH.h"
+
+/* MCAL */
+#include "../TIMER/TIMER_interface.h"
+#include "../TIMER/TIMER_private.h"
+#include "../TIMER/TIMER_config.h"
+
+/* Compare value giving one tick per TIMER0_TICK_PERIOD_US */
+#define TIMER0_TICK_COUNTS   ((F_CPU / TIMER_PRESCALER_DIVISION(TIMER0_PRESCALER)) * TIMER0_TICK_PERIOD_US / 1000000UL)
+
+#if (TIMER0_TICK_COUNTS < 1) || (TIMER0_TICK_COUNTS > 256)
+#error "TIMER0_TICK_PERIOD_US does not fit Timer0 with the selected TIMER0_PRESCALER"
+#endif
+
+/* Tick callback, called from the compare match interrupt */
+static void (*TIMER0_pvCallBack)(void) = NULL;
+
+/*
+ * Function: TIMER0_voidInitTick
+ * Description:
+ *     Stops the timer, selects CTC mode (WGM01:0 = 10), loads the compare value,
+ *     clears a pending compare flag, enables the interrupt and starts the clock.
+ */
+void TIMER0_voidInitTick(void)
+{
+	TCCR0 = 0;
+	TCNT0 = 0;
+	OCR0 = (u8)(TIMER0_TICK_COUNTS - 1);
+
+	SET_BIT(TIFR, TIFR_OCF0);      // Flag is cleared by writing one
+	SET_BIT(TIMSK, TIMSK_OCIE0);
+
+	TCCR0 = (1 << TCCR0_WGM01) | TIMER0_PRESCALER;
+}
+
+/*
+ * Function: TIMER0_voidSetCallBack
+ * Description:
+ *     Stores the tick callback. A function pointer is two bytes, so the store is done
+ *     with interrupts disabled to keep the ISR from calling a half-written pointer.
+ */
+void TIMER0_voidSetCallBack(void (*Copy_pvCallBack)(void))
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		TIMER0_pvCallBack = Copy_pvCallBack;
+	}
+}
+
+/*
+ * Function: TIMER0_voidStop
+ * Description:
+ *     Clears the clock select bits; the counter and configuration are kept.
+ */
+void TIMER0_voidStop(void)
+{
+	TCCR0 &= ~TIMER0_CLOCK_SELECT_MASK;
+}
+
+/* Timer0 Compare Match Interrupt */
+ISR(TIMER0_COMP_vect)
+{
+	if(TIMER0_pvCallBack != NULL)
+	{
+		TIMER0_pvCallBack();
+	}
+}
@@ -0,0 +1,48 @@
+################################################################################
+# File: pinmap.mk
+#
+# Pin map build step: regenerates PINMAP_generated.h and pinmap_report.txt from the
+# board pin map whenever it (or the generator) changes, and fails the build on a pin
+# conflict. Every object of the build depends on the header, so a wiring change
+# rebuilds the drivers with the new masks.
+#
+# Eclipse (Debug/makefile): the generated makefile includes ../makefile.defs; put
+#     include <path to COTS>/PINMAP/pinmap.mk
+# in that file. It must come after the subdir.mk files (which makefile.defs does) so
+# that OBJS is known.
+# Standalone:
+#     make -f PINMAP/pinmap.mk pinmap
+# Board variant: PINMAP_OPTIONS lists the IF blocks of the map to use, e.g.
+#     make -f PINMAP/pinmap.mk pinmap PINMAP_OPTIONS="LCD_8_BIT"
+# Run pinmap-clean after changing it (the header does not depend on the options).
+################################################################################
+
+PINMAP_DIR := $(patsubst %/,%,$(dir $(lastword $(MAKEFILE_LIST))))
+
+PINMAP_MAP ?= $(PINMAP_DIR)/pinmap.txt
+PINMAP_HEADER ?= $(PINMAP_DIR)/PINMAP_generated.h
+PINMAP_REPORT ?= $(PINMAP_DIR)/pinmap_report.txt
+PINMAP_OPTIONS ?=
+
+# Keep the default goal of the including makefile
+PINMAP_DEFAULT_GOAL := $(.DEFAULT_GOAL)
+
+$(PINMAP_HEADER): $(PINMAP_MAP) $(PINMAP_DIR)/pinmap.sh
+	@echo 'Generating pin map: $@'
+	@echo 'Invoking: pinmap.sh'
+	sh $(PINMAP_DIR)/pinmap.sh $(addprefix -D ,$(PINMAP_OPTIONS)) "$(PINMAP_MAP)" "$@" "$(PINMAP_REPORT)" || { cat "$(PINMAP_REPORT)"; exit 1; }
+	@echo 'Finished generating: $@'
+	@echo ' '
+
+pinmap: $(PINMAP_HEADER)
+
+ifneq ($(strip $(OBJS)),)
+$(OBJS): $(PINMAP_HEADER)
+endif
+
+pinmap-clean:
+	-rm -f $(PINMAP_HEADER) $(PINMAP_REPORT)
+
+.PHONY: pinmap pinmap-clean
+
+.DEFAULT_GOAL := $(PINMAP_DEFAULT_GOAL)
@@ -0,0 +1,334 @@
+#!/bin/sh
+#
+# File: pinmap.sh
+#
+# Description:
+#     Pin map generator. Reads the board pin map (pinmap.txt format) and writes:
+#       - a header with the DIO init masks (DIO_PORTx_DIRECTION / INITIAL_VALUE / PULL_UP,
+#         used by DIO_config.h when DIO_PIN_MAP is DIO_PIN_MAP_GENERATED) and, per driver,
+#         the port/pin/channel/id of every signal, its pin mask on every port and, per bus,
+#         the channel list, the converters and the masked writes for that wiring;
+#       - a report listing every pin of the ATmega32 with its users, and the conflicts.
+#     Bus converters are folded at generation time into one mask-and-shift per distinct
+#     shift, so a bus wired in order on one port is a single AND, and a bus write is one
+#     DIO_writePortMasked per port it uses.
+#     Each -D NAME option enables the IF NAME blocks of the map (board variants).
+#     On a conflict (or a syntax error) the header is not written and the exit status is 1,
+#     which stops the build.
+#
+# Usage:
+#     pinmap.sh [-D NAME]... pinmap.txt PINMAP_generated.h [pinmap_report.txt]
+#     (without a report file the report is printed on stdout; see pinmap.mk for the build step)
+#
+
+OPTIONS=""
+while [ "$1" = "-D" ]; do
+    if [ -z "$2" ]; then
+        echo "$0: -D needs an option name" >&2
+        exit 1
+    fi
+    OPTIONS="$OPTIONS $2"
+    shift 2
+done
+
+MAP=$1
+HEADER=$2
+REPORT=${3:-/dev/stdout}
+
+if [ -z "$MAP" ] || [ -z "$HEADER" ] || [ ! -f "$MAP" ]; then
+    echo "usage: $0 [-D NAME]... pinmap.txt header.h [report.txt]" >&2
+    exit 1
+fi
+
+TMP_HEADER="$HEADER.tmp"
+
+awk -v map="$MAP" -v mapname="$(basename "$MAP")" -v options="$OPTIONS" \
+    -v header="$TMP_HEADER" -v report="$REPORT" '
+function error(msg) {
+    printf("%s:%d: error: %s\n", map, NR, msg) > "/dev/stderr"
+    errors++
+}
+
+function bit(value, n) {
+    return int(value / 2 ^ n) % 2
+}
+
+function hex(value) {
+    return sprintf("0x%02X", value)
+}
+
+function pad(text, width) {
+    while (length(text) < width) text = text " "
+    return text
+}
+
+# Same SHARE group (or same driver) ?
+function shared(d1, d2,    g) {
+    if (d1 == d2) return 0
+    for (g in group_of) {
+        split(g, key, SUBSEP)
+        if (key[2] == d1 && ((key[1], d2) in group_of)) return 1
+    }
+    return 0
+}
+
+# Mask-and-shift expression of bus b for port p, one term per distinct shift
+function to_port(b, p, arg,    i, j, s, expr, term, m, seen) {
+    expr = ""
+    for (i = 0; i < 8; i++) {
+        if (!((b, i) in bus_pin) || substr(bus_pin[b, i], 1, 1) != p) continue
+        s = substr(bus_pin[b, i], 2, 1) - i
+        if (s in seen) continue
+        seen[s] = 1
+        m = 0
+        for (j = i; j < 8; j++)
+            if (((b, j) in bus_pin) && substr(bus_pin[b, j], 1, 1) == p && substr(bus_pin[b, j], 2, 1) - j == s)
+                m += 2 ^ j
+        if (s > 0)      term = "(((" arg ") & " hex(m) ") << " s ")"
+        else if (s < 0) term = "(((" arg ") & " hex(m) ") >> " (-s) ")"
+        else            term = "((" arg ") & " hex(m) ")"
+        expr = (expr == "") ? term : expr " | " term
+    }
+    return "((u8)(" expr "))"
+}
+
+function from_port(b, p, arg,    i, j, s, expr, term, m, seen) {
+    expr = ""
+    for (i = 0; i < 8; i++) {
+        if (!((b, i) in bus_pin) || substr(bus_pin[b, i], 1, 1) != p) continue
+        s = substr(bus_pin[b, i], 2, 1) - i
+        if (s in seen) continue
+        seen[s] = 1
+        m = 0
+        for (j = i; j < 8; j++)
+            if (((b, j) in bus_pin) && substr(bus_pin[b, j], 1, 1) == p && substr(bus_pin[b, j], 2, 1) - j == s)
+                m += 2 ^ (j + s)
+        if (s > 0)      term = "(((" arg ") & " hex(m) ") >> " s ")"
+        else if (s < 0) term = "(((" arg ") & " hex(m) ") << " (-s) ")"
+        else            term = "((" arg ") & " hex(m) ")"
+        expr = (expr == "") ? term : expr " | " term
+    }
+    return "((u8)(" expr "))"
+}
+
+BEGIN {
+    ports = "ABCD"
+    mode_dir["OUTPUT_LOW"] = 1;   mode_val["OUTPUT_LOW"] = 0
+    mode_dir["OUTPUT_HIGH"] = 1;  mode_val["OUTPUT_HIGH"] = 1
+    mode_dir["INPUT"] = 0;        mode_val["INPUT"] = 0
+    mode_dir["INPUT_PULLUP"] = 0; mode_val["INPUT_PULLUP"] = 1
+    mode_dir["OPEN_DRAIN"] = 0;   mode_val["OPEN_DRAIN"] = 0
+
+    option_count = split(options, option_list, " ")
+    for (i = 1; i <= option_count; i++) option_set[option_list[i]] = 1
+    options_text = (option_count ? options : " none")
+    sub(/^ /, "", options_text)
+
+    # IF nesting: active[depth] is 1 while every enclosing IF holds
+    depth = 0; active[0] = 1
+}
+
+{ sub(/\r$/, ""); sub(/#.*/, "") }
+NF == 0 { next }
+
+$1 == "IF" {
+    if (NF != 2 || $2 !~ /^!?[A-Za-z_][A-Za-z0-9_]*$/) { error("expected IF NAME or IF !NAME"); next }
+    name = $2; negate = sub(/^!/, "", name)
+    option_used[name] = 1
+    depth++
+    active[depth] = active[depth - 1] && ((name in option_set) != negate)
+    next
+}
+
+$1 == "ENDIF" {
+    if (NF != 1)    { error("ENDIF takes no argument"); next }
+    if (depth == 0) { error("ENDIF without IF"); next }
+    depth--
+    next
+}
+
+!active[depth] { next }
+
+$1 == "SHARE" {
+    if (NF < 4) { error("SHARE needs a group name and at least two drivers"); next }
+    for (i = 3; i <= NF; i++) group_of[$2, $i] = 1
+    next
+}
+
+{
+    if (NF < 4 || NF > 5)                 { error("expected DRIVER SIGNAL PIN MODE [BUS.BIT]"); next }
+    drv = $1; sig = $2; pin = toupper($3); mode = toupper($4)
+    if (pin !~ /^P[A-D][0-7]$/)          { error("bad pin \"" $3 "\" (PA0..PD7)"); next }
+    if (!(mode in mode_dir))              { error("bad mode \"" $4 "\""); next }
+    if ((drv, sig) in sig_pin)            { error(drv "_" sig " is defined twice"); next }
+
+    pin = substr(pin, 2)                  # "A3"
+    p = substr(pin, 1, 1); n = substr(pin, 2, 1) + 0
+
+    if (!(drv in drv_seen)) { drv_seen[drv] = 1; drv_list[++drv_count] = drv }
+    sig_pin[drv, sig] = pin
+    sig_list[drv, ++sig_count[drv]] = sig
+
+    if (NF == 5) {
+        if ($5 !~ /^[A-Za-z_][A-Za-z0-9_]*\.[0-7]$/) { error("bad bus bit \"" $5 "\" (NAME.0..NAME.7)"); next }
+        split($5, bb, ".")
+        b = drv "_" bb[1]
+        if ((b, bb[2]) in bus_pin)        { error("bit " bb[2] " of bus " b " is defined twice"); next }
+        if (!(b in bus_seen)) { bus_seen[b] = 1; bus_list[++bus_count] = b; bus_drv[b] = drv }
+        bus_pin[b, bb[2] + 0] = pin
+        bus_ports[b] = bus_ports[b] p
+    }
+
+    # Pin users and conflicts
+    for (i = 1; i <= user_count[pin]; i++) {
+        other = user_drv[pin, i]
+        if (other == drv) {
+            conflict[pin] = conflict[pin] "; " drv "_" sig " and " other "_" user_sig[pin, i] " use the same pin"
+        } else if (!shared(drv, other)) {
+            conflict[pin] = conflict[pin] "; " drv " and " other " are not in a SHARE group (" drv "_" sig ", " other "_" user_sig[pin, i] ")"
+        } else if (user_mode[pin, i] != mode) {
+            conflict[pin] = conflict[pin] "; " drv "_" sig " is " mode " but " user_drv[pin, i] "_" user_sig[pin, i] " is " user_mode[pin, i]
+        }
+    }
+    i = ++user_count[pin]
+    user_drv[pin, i] = drv; user_sig[pin, i] = sig; user_mode[pin, i] = mode
+    pin_mode[pin] = mode
+    drv_mask[drv, p] += (bit(drv_mask[drv, p], n) ? 0 : 2 ^ n)
+}
+
+END {
+    if (depth > 0) {
+        printf("%s: error: %d IF block(s) not closed by ENDIF\n", map, depth) > "/dev/stderr"
+        errors++
+    }
+    for (i = 1; i <= option_count; i++) {
+        if (!(option_list[i] in option_used)) {
+            printf("%s: error: option %s is not used by any IF of the map\n", map, option_list[i]) > "/dev/stderr"
+            errors++
+        }
+    }
+    # Buses: bits 0..WIDTH-1 without gaps, so the channel list is the bus order
+    for (bi = 1; bi <= bus_count; bi++) {
+        b = bus_list[bi]
+        bus_width[b] = 0
+        for (i = 0; i < 8; i++) if ((b, i) in bus_pin) bus_width[b] = i + 1
+        for (i = 0; i < bus_width[b]; i++) {
+            if (!((b, i) in bus_pin)) {
+                printf("%s: error: bit %d of bus %s is missing\n", map, i, b) > "/dev/stderr"
+                errors++
+            }
+        }
+    }
+    if (errors) exit 1
+
+    # Report
+    conflicts = 0
+    printf("Pin map %s, options: %s\n\n", mapname, options_text) > report
+    printf("PIN  MODE          USERS\n") > report
+    for (pi = 1; pi <= 4; pi++) {
+        p = substr(ports, pi, 1)
+        for (n = 0; n < 8; n++) {
+            pin = p n
+            users = ""
+            for (i = 1; i <= user_count[pin]; i++)
+                users = users (i > 1 ? ", " : "") user_drv[pin, i] "_" user_sig[pin, i]
+            if (user_count[pin] == 0)      { users = "-"; mode = "FREE" }
+            else                           { mode = pin_mode[pin] }
+            if (user_count[pin] > 1 && !(pin in conflict)) users = users " (shared)"
+            printf("P%s  %s %s\n", pin, pad(mode, 13), users) > report
+            if (pin in conflict) {
+                printf("     CONFLICT: %s\n", substr(conflict[pin], 3)) > report
+                conflicts++
+            }
+        }
+    }
+    printf("\nPORT  USED  DRIVERS\n") > report
+    for (pi = 1; pi <= 4; pi++) {
+        p = substr(ports, pi, 1)
+        used = 0; drivers = ""
+        for (d = 1; d <= drv_count; d++) {
+            if (drv_mask[drv_list[d], p]) drivers = drivers (drivers == "" ? "" : ", ") drv_list[d] " " hex(drv_mask[drv_list[d], p])
+        }
+        for (n = 0; n < 8; n++) if (user_count[p n]) used += 2 ^ n
+        printf("%s     %s  %s\n", p, hex(used), drivers == "" ? "-" : drivers) > report
+    }
+    printf("\n%d conflict(s)\n", conflicts) > report
+
+    if (conflicts) exit 1
+
+    # Header
+    print "/*" > header
+    print " * File: PINMAP_generated.h" > header
+    print " *" > header
+    print " * Description:" > header
+    print " *     Generated by PINMAP/pinmap.sh from " mapname " (options: " options_text ")." > header
+    print " *     Do not edit: change the pin map and rebuild." > header
+    print " */" > header
+    print "" > header
+    print "#ifndef PINMAP_GENERATED_H_" > header
+    print "#define PINMAP_GENERATED_H_" > header
+    print "" > header
+
+    print "/* DIO init masks (DIO_initPinsConfig) */" > header
+    for (pi = 1; pi <= 4; pi++) {
+        p = substr(ports, pi, 1)
+        dir = 0; val = 0; pull = 0
+        for (n = 0; n < 8; n++) {
+            if (user_count[p n] == 0) continue
+            mode = pin_mode[p n]
+            if (mode_dir[mode])      { dir += 2 ^ n; val += mode_val[mode] * 2 ^ n }
+            else                     { pull += mode_val[mode] * 2 ^ n }
+        }
+        printf("#define %s %s\n", pad("DIO_PORT" p "_DIRECTION", 30), hex(dir)) > header
+        printf("#define %s %s\n", pad("DIO_PORT" p "_INITIAL_VALUE", 30), hex(val)) > header
+        printf("#define %s %s\n", pad("DIO_PORT" p "_PULL_UP", 30), hex(pull)) > header
+    }
+
+    for (d = 1; d <= drv_count; d++) {
+        drv = drv_list[d]
+        printf("\n/* %s */\n", drv) > header
+        for (s = 1; s <= sig_count[drv]; s++) {
+            sig = sig_list[drv, s]; pin = sig_pin[drv, sig]
+            p = substr(pin, 1, 1); n = substr(pin, 2, 1)
+            name = "PINMAP_" drv "_" sig
+            printf("#define %s DIO_PORT%s\n", pad(name "_PORT", 40), p) > header
+            printf("#define %s DIO_PIN%s\n", pad(name "_PIN", 40), n) > header
+            printf("#define %s Dio_PIN%s_%s\n", pad(name "_CHANNEL", 40), p, n) > header
+            printf("#define %s DIO_PIN_ID(DIO_PORT%s, DIO_PIN%s)\n", pad(name "_ID", 40), p, n) > header
+        }
+        for (pi = 1; pi <= 4; pi++) {
+            p = substr(ports, pi, 1)
+            if (drv_mask[drv, p])
+                printf("#define %s %s\n", pad("PINMAP_" drv "_PORT" p "_MASK", 40), hex(drv_mask[drv, p])) > header
+        }
+
+        for (bi = 1; bi <= bus_count; bi++) {
+            b = bus_list[bi]
+            if (bus_drv[b] != drv) continue
+            channels = ""
+            for (i = 0; i < bus_width[b]; i++)
+                channels = channels (i ? ", " : "") "Dio_PIN" substr(bus_pin[b, i], 1, 1) "_" substr(bus_pin[b, i], 2, 1)
+            printf("#define %s %d\n", pad("PINMAP_" b "_WIDTH", 40), bus_width[b]) > header
+            printf("#define %s {%s}\n", pad("PINMAP_" b "_CHANNELS", 40), channels) > header
+            write = ""
+            for (pi = 1; pi <= 4; pi++) {
+                p = substr(ports, pi, 1)
+                if (index(bus_ports[b], p) == 0) continue
+                m = 0
+                for (i = 0; i < 8; i++)
+                    if (((b, i) in bus_pin) && substr(bus_pin[b, i], 1, 1) == p) m += 2 ^ substr(bus_pin[b, i], 2, 1)
+                printf("#define %s %s\n", pad("PINMAP_" b "_PORT" p "_MASK", 40), hex(m)) > header
+                printf("#define %s %s\n", pad("PINMAP_" b "_TO_PORT" p "(Value)", 40), to_port(b, p, "Value")) > header
+                printf("#define %s %s\n", pad("PINMAP_" b "_FROM_PORT" p "(Port)", 40), from_port(b, p, "Port")) > header
+                write = write " DIO_writePortMasked(DIO_PORT" p ", PINMAP_" b "_PORT" p "_MASK, PINMAP_" b "_TO_PORT" p "(Value));"
+            }
+            printf("#define %s do {%s } while (0)\n", pad("PINMAP_" b "_WRITE(Value)", 40), write) > header
+        }
+    }
+
+    print "" > header
+    print "#endif /* PINMAP_GENERATED_H_ */" > header
+}
+' "$MAP" || { rm -f "$TMP_HEADER"; exit 1; }
+
+mv "$TMP_HEADER" "$HEADER"
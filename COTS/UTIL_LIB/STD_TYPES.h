@@ -15,12 +15,20 @@
 /* Standard Unsigned Integer Types */
 typedef unsigned char            u8;   /* Unsigned 8-bit integer */
 typedef unsigned short int       u16;  /* Unsigned 16-bit integer */
+#ifndef HOST_BUILD
 typedef unsigned long int        u32;  /* Unsigned 32-bit integer */
+#else
+typedef unsigned int             u32;  /* Unsigned 32-bit integer (long is 64-bit on LP64 hosts) */
+#endif
 
 /* Standard Signed Integer Types */
 typedef signed char              s8;   /* Signed 8-bit integer */
 typedef signed short int         s16;  /* Signed 16-bit integer */
+#ifndef HOST_BUILD
 typedef signed long int          s32;  /* Signed 32-bit integer */
+#else
+typedef signed int               s32;  /* Signed 32-bit integer (long is 64-bit on LP64 hosts) */
+#endif
 
 /* Floating-point Types */
 typedef float                    f32;  /* Single precision floating-point */
@@ -43,4 +51,22 @@ typedef u8                       bool; /* Boolean data type */
     #define FALSE                0    /* Boolean false value */
 #endif
 
+/*
+ * Memory Mapped Register Access:
+ * Every *_private.h names its registers through these macros instead of
+ * dereferencing the address directly. On target they compile to the plain
+ * volatile access. With HOST_BUILD defined (see HOST/HOST_interface.h) they
+ * resolve to the host register file, so the drivers build and run unmodified
+ * with the host compiler.
+ */
+#ifndef HOST_BUILD
+    #define HW_REG8(Address)     (*(volatile u8*)(Address))
+    #define HW_REG16(Address)    (*(volatile u16*)(Address))
+#else
+    volatile u8* HOST_pu8Register(u16 Copy_u16Address);
+    volatile u16* HOST_pu16Register(u16 Copy_u16Address);
+    #define HW_REG8(Address)     (*HOST_pu8Register(Address))
+    #define HW_REG16(Address)    (*HOST_pu16Register(Address))
+#endif
+
 #endif /* STD_TYPES_H_ */